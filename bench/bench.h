@@ -0,0 +1,43 @@
+/*
+ * Common timing and reporting definitions for the benchmark harnesses.
+ *
+ * Copyright (C) 2026 J.M. Heisz.  All Rights Reserved.
+ * See the LICENSE file accompanying the distribution your rights to use
+ * this software.
+ */
+#ifndef WX_BENCH_H
+#define WX_BENCH_H 1
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+/* Number of timed repetitions per benchmark case */
+#define WXBENCH_REPS 5
+
+/* Monotonic nanosecond timestamp for interval measurement */
+static uint64_t WXBench_Time(void) {
+    struct timespec tmspec;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &tmspec);
+    return ((uint64_t) tmspec.tv_sec) * 1000000000ULL + tmspec.tv_nsec;
+}
+
+/*
+ * Machine-readable result line, one per benchmark case.  Keyed format is
+ * intended for mechanical diffing of runs between releases.
+ */
+static void WXBench_Report(const char *name, uint64_t ops, uint64_t bestNs,
+                           uint64_t totalNs, int reps) {
+    double meanNs = ((double) totalNs) / reps;
+
+    (void) fprintf(stdout,
+                   "WXBENCH name=%s reps=%d ops=%llu best_ns_op=%.2f "
+                   "mean_ns_op=%.2f ops_sec=%.0f\n",
+                   name, reps, (unsigned long long) ops,
+                   ((double) bestNs) / ((double) ops),
+                   meanNs / ((double) ops),
+                   ((double) ops) * 1.0e9 / meanNs);
+}
+
+#endif
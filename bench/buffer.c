@@ -0,0 +1,88 @@
+/*
+ * Benchmark harness for the buffer toolkit elements.
+ *
+ * Copyright (C) 2026 J.M. Heisz.  All Rights Reserved.
+ * See the LICENSE file accompanying the distribution your rights to use
+ * this software.
+ */
+#include "bench.h"
+#include "buffer.h"
+#include "mem.h"
+#include <stdlib.h>
+
+/* Operation counts, sized for sub-second repetitions */
+#define APPEND_OPS 1000000
+#define PACK_OPS 500000
+
+/* Timed small-chunk append throughput */
+static void benchAppend(void) {
+    uint64_t start, interval, best = 0, total = 0;
+    uint8_t chunk[16] = "0123456789abcde";
+    WXBuffer buffer;
+    uint32_t idx;
+    int rep;
+
+    if (WXBuffer_Init(&buffer, 1024) == NULL) {
+        (void) fprintf(stderr, "Error: unexpected memory failure\n");
+        exit(1);
+    }
+
+    for (rep = 0; rep < WXBENCH_REPS; rep++) {
+        WXBuffer_Empty(&buffer);
+        start = WXBench_Time();
+        for (idx = 0; idx < APPEND_OPS; idx++) {
+            if (WXBuffer_Append(&buffer, chunk, sizeof(chunk), TRUE) == NULL) {
+                (void) fprintf(stderr, "Error: unexpected memory failure\n");
+                exit(1);
+            }
+        }
+        interval = WXBench_Time() - start;
+        total += interval;
+        if ((best == 0) || (interval < best)) best = interval;
+    }
+    WXBuffer_Destroy(&buffer);
+
+    WXBench_Report("buffer.append16", APPEND_OPS, best, total, WXBENCH_REPS);
+}
+
+/* Timed binary pack throughput for a mixed record format */
+static void benchPack(void) {
+    uint64_t start, interval, best = 0, total = 0;
+    WXBuffer buffer;
+    uint32_t idx;
+    int rep;
+
+    if (WXBuffer_Init(&buffer, 1024) == NULL) {
+        (void) fprintf(stderr, "Error: unexpected memory failure\n");
+        exit(1);
+    }
+
+    for (rep = 0; rep < WXBENCH_REPS; rep++) {
+        WXBuffer_Empty(&buffer);
+        start = WXBench_Time();
+        for (idx = 0; idx < PACK_OPS; idx++) {
+            if (WXBuffer_Pack(&buffer, "CnNq", idx & 0xFF, idx & 0xFFFF,
+                              idx, (long long) idx) == NULL) {
+                (void) fprintf(stderr, "Error: unexpected memory failure\n");
+                exit(1);
+            }
+        }
+        interval = WXBench_Time() - start;
+        total += interval;
+        if ((best == 0) || (interval < best)) best = interval;
+    }
+    WXBuffer_Destroy(&buffer);
+
+    WXBench_Report("buffer.pack", PACK_OPS, best, total, WXBENCH_REPS);
+}
+
+/**
+ * Main benchmarking entry point.  Measures append and pack throughput for
+ * the common buffer assembly patterns.
+ */
+int main(int argc, char **argv) {
+    benchAppend();
+    benchPack();
+
+    return 0;
+}
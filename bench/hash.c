@@ -0,0 +1,82 @@
+/*
+ * Benchmark harness for the hashtable toolkit elements.
+ *
+ * Copyright (C) 2026 J.M. Heisz.  All Rights Reserved.
+ * See the LICENSE file accompanying the distribution your rights to use
+ * this software.
+ */
+#include "bench.h"
+#include "hash.h"
+#include "mem.h"
+#include <stdlib.h>
+
+/* Largest population measured, smaller cases reuse the same key block */
+#define MAX_ENTRIES 131072
+
+static char keys[MAX_ENTRIES][32];
+
+/* Timed put/get passes for the indicated table population */
+static void benchHashOps(uint32_t count) {
+    uint64_t start, putBest = 0, putTotal = 0, getBest = 0, getTotal = 0;
+    uint64_t interval;
+    WXHashTable table;
+    char name[64];
+    uint32_t idx;
+    int rep;
+
+    for (rep = 0; rep < WXBENCH_REPS; rep++) {
+        if (!WXHash_InitTable(&table, -1)) {
+            (void) fprintf(stderr, "Error: unexpected memory failure\n");
+            exit(1);
+        }
+
+        start = WXBench_Time();
+        for (idx = 0; idx < count; idx++) {
+            if (!WXHash_PutEntry(&table, keys[idx], keys[idx], NULL, NULL,
+                                 WXHash_StrHashFn, WXHash_StrEqualsFn)) {
+                (void) fprintf(stderr, "Error: unexpected memory failure\n");
+                exit(1);
+            }
+        }
+        interval = WXBench_Time() - start;
+        putTotal += interval;
+        if ((putBest == 0) || (interval < putBest)) putBest = interval;
+
+        start = WXBench_Time();
+        for (idx = 0; idx < count; idx++) {
+            if (WXHash_GetEntry(&table, keys[idx], WXHash_StrHashFn,
+                                WXHash_StrEqualsFn) != keys[idx]) {
+                (void) fprintf(stderr, "Error: benchmark get mismatch\n");
+                exit(1);
+            }
+        }
+        interval = WXBench_Time() - start;
+        getTotal += interval;
+        if ((getBest == 0) || (interval < getBest)) getBest = interval;
+
+        WXHash_Destroy(&table);
+    }
+
+    (void) sprintf(name, "hash.put.%d", count);
+    WXBench_Report(name, count, putBest, putTotal, WXBENCH_REPS);
+    (void) sprintf(name, "hash.get.%d", count);
+    WXBench_Report(name, count, getBest, getTotal, WXBENCH_REPS);
+}
+
+/**
+ * Main benchmarking entry point.  Measures put/get costs across a range of
+ * table populations.
+ */
+int main(int argc, char **argv) {
+    uint32_t idx;
+
+    for (idx = 0; idx < MAX_ENTRIES; idx++) {
+        (void) sprintf(keys[idx], "entry-%d", idx);
+    }
+
+    benchHashOps(1024);
+    benchHashOps(16384);
+    benchHashOps(MAX_ENTRIES);
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * Benchmark harness for the JSON toolkit elements.
+ *
+ * Copyright (C) 2026 J.M. Heisz.  All Rights Reserved.
+ * See the LICENSE file accompanying the distribution your rights to use
+ * this software.
+ */
+#include "bench.h"
+#include "json.h"
+#include "mem.h"
+#include <stdlib.h>
+
+/* Operation counts, sized for sub-second repetitions */
+#define DECODE_OPS 20000
+#define ENCODE_OPS 20000
+
+/* Representative mixed-content document (API response shape) */
+static const char *document =
+    "{"
+        "\"id\": 1234567,"
+        "\"name\": \"benchmark record\","
+        "\"active\": true,"
+        "\"score\": 98.6,"
+        "\"tags\": [\"alpha\", \"beta\", \"gamma\", \"delta\"],"
+        "\"attributes\": {"
+            "\"height\": 182,"
+            "\"width\": 77,"
+            "\"depth\": null,"
+            "\"label\": \"internal \\\"quoted\\\" content\""
+        "},"
+        "\"records\": ["
+            "{\"idx\": 1, \"val\": \"first\"},"
+            "{\"idx\": 2, \"val\": \"second\"},"
+            "{\"idx\": 3, \"val\": \"third\"}"
+        "]"
+    "}";
+
+/* Timed parse (and release) of the representative document */
+static void benchDecode(void) {
+    uint64_t start, interval, best = 0, total = 0;
+    WXJSONValue *value;
+    uint32_t idx;
+    int rep;
+
+    for (rep = 0; rep < WXBENCH_REPS; rep++) {
+        start = WXBench_Time();
+        for (idx = 0; idx < DECODE_OPS; idx++) {
+            value = WXJSON_Decode(document);
+            if ((value == NULL) || (value->type == WXJSONVALUE_ERROR)) {
+                (void) fprintf(stderr, "Error: benchmark document invalid\n");
+                exit(1);
+            }
+            WXJSON_Destroy(value);
+        }
+        interval = WXBench_Time() - start;
+        total += interval;
+        if ((best == 0) || (interval < best)) best = interval;
+    }
+
+    WXBench_Report("json.decode", DECODE_OPS, best, total, WXBENCH_REPS);
+}
+
+/* Timed re-encoding of the parsed document */
+static void benchEncode(void) {
+    uint64_t start, interval, best = 0, total = 0;
+    WXJSONValue *value;
+    WXBuffer buffer;
+    uint32_t idx;
+    int rep;
+
+    value = WXJSON_Decode(document);
+    if ((value == NULL) || (value->type == WXJSONVALUE_ERROR)) {
+        (void) fprintf(stderr, "Error: benchmark document invalid\n");
+        exit(1);
+    }
+    if (WXBuffer_Init(&buffer, 1024) == NULL) {
+        (void) fprintf(stderr, "Error: unexpected memory failure\n");
+        exit(1);
+    }
+
+    for (rep = 0; rep < WXBENCH_REPS; rep++) {
+        start = WXBench_Time();
+        for (idx = 0; idx < ENCODE_OPS; idx++) {
+            WXBuffer_Empty(&buffer);
+            if (WXJSON_Encode(&buffer, value, FALSE) == NULL) {
+                (void) fprintf(stderr, "Error: unexpected memory failure\n");
+                exit(1);
+            }
+        }
+        interval = WXBench_Time() - start;
+        total += interval;
+        if ((best == 0) || (interval < best)) best = interval;
+    }
+    WXBuffer_Destroy(&buffer);
+    WXJSON_Destroy(value);
+
+    WXBench_Report("json.encode", ENCODE_OPS, best, total, WXBENCH_REPS);
+}
+
+/**
+ * Main benchmarking entry point.  Measures decode and encode costs for a
+ * representative mixed-content document.
+ */
+int main(int argc, char **argv) {
+    benchDecode();
+    benchEncode();
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Benchmark harness for the threadpool toolkit elements.
+ *
+ * Copyright (C) 2026 J.M. Heisz.  All Rights Reserved.
+ * See the LICENSE file accompanying the distribution your rights to use
+ * this software.
+ */
+#include "bench.h"
+#include "threadpool.h"
+#include "thread.h"
+#include "mem.h"
+#include <stdlib.h>
+
+/* Operation counts, sized for sub-second repetitions */
+#define ENQUEUE_OPS 100000
+#define BATCH_SIZE 256
+
+/* Minimal work item, just counts executions for verification */
+static void *workFn(void *arg) {
+    (void) __sync_add_and_fetch((long *) arg, 1);
+    return NULL;
+}
+
+/* Timed item-at-a-time enqueue/drain throughput */
+static void benchEnqueue(WXThreadPool *pool) {
+    uint64_t start, interval, best = 0, total = 0;
+    long counter;
+    uint32_t idx;
+    int rep;
+
+    for (rep = 0; rep < WXBENCH_REPS; rep++) {
+        counter = 0;
+        start = WXBench_Time();
+        for (idx = 0; idx < ENQUEUE_OPS; idx++) {
+            if (WXThreadPool_Enqueue(pool, workFn, &counter) != WXTRC_OK) {
+                (void) fprintf(stderr, "Error: unexpected enqueue failure\n");
+                exit(1);
+            }
+        }
+        if (WXThreadPool_WaitAll(pool) != WXTRC_OK) {
+            (void) fprintf(stderr, "Error: unexpected wait failure\n");
+            exit(1);
+        }
+        interval = WXBench_Time() - start;
+        if (counter != ENQUEUE_OPS) {
+            (void) fprintf(stderr, "Error: benchmark work items lost\n");
+            exit(1);
+        }
+        total += interval;
+        if ((best == 0) || (interval < best)) best = interval;
+    }
+
+    WXBench_Report("thread.enqueue", ENQUEUE_OPS, best, total, WXBENCH_REPS);
+}
+
+/* Timed batched enqueue/drain throughput */
+static void benchEnqueueBatch(WXThreadPool *pool) {
+    uint64_t start, interval, best = 0, total = 0;
+    void *(*execFns[BATCH_SIZE])(void *);
+    void *args[BATCH_SIZE];
+    long counter;
+    uint32_t idx;
+    int rep;
+
+    for (rep = 0; rep < WXBENCH_REPS; rep++) {
+        counter = 0;
+        for (idx = 0; idx < BATCH_SIZE; idx++) {
+            execFns[idx] = workFn;
+            args[idx] = &counter;
+        }
+        start = WXBench_Time();
+        for (idx = 0; idx < ENQUEUE_OPS / BATCH_SIZE; idx++) {
+            if (WXThreadPool_EnqueueBatch(pool, execFns, args,
+                                          BATCH_SIZE) != WXTRC_OK) {
+                (void) fprintf(stderr, "Error: unexpected enqueue failure\n");
+                exit(1);
+            }
+        }
+        if (WXThreadPool_WaitAll(pool) != WXTRC_OK) {
+            (void) fprintf(stderr, "Error: unexpected wait failure\n");
+            exit(1);
+        }
+        interval = WXBench_Time() - start;
+        if (counter != (ENQUEUE_OPS / BATCH_SIZE) * BATCH_SIZE) {
+            (void) fprintf(stderr, "Error: benchmark work items lost\n");
+            exit(1);
+        }
+        total += interval;
+        if ((best == 0) || (interval < best)) best = interval;
+    }
+
+    WXBench_Report("thread.enqueuebatch",
+                   (ENQUEUE_OPS / BATCH_SIZE) * BATCH_SIZE, best, total,
+                   WXBENCH_REPS);
+}
+
+/**
+ * Main benchmarking entry point.  Measures threadpool work distribution
+ * throughput for trivial work items (scheduling overhead dominated).
+ */
+int main(int argc, char **argv) {
+    WXThreadPool pool;
+
+    if (WXThreadPool_Init(&pool, 4, 4, 0) != WXTRC_OK) {
+        (void) fprintf(stderr, "Error: unexpected pool init failure\n");
+        exit(1);
+    }
+
+    benchEnqueue(&pool);
+    benchEnqueueBatch(&pool);
+
+    if (WXThreadPool_Terminate(&pool) != WXTRC_OK) {
+        (void) fprintf(stderr, "Error: unexpected pool terminate failure\n");
+        exit(1);
+    }
+
+    return 0;
+}
@@ -8,6 +8,7 @@
 #include "dbxfint.h"
 #include <ctype.h>
 #include "mem.h"
+#include "stats.h"
 
 /* Share error messaging */
 static char *mtxErrorMsg = "Mutex init/lock error for connection pool";
@@ -58,6 +59,9 @@ const char *WXDB_GetLastErrorMessage(void *obj) {
     }
 }
 
+/* Statement cache teardown, defined with the statement methods below */
+static void flushStatementCache(WXDBConnection *conn);
+
 /* Common methods for connection pool cleanup */
 static int propFlush(WXHashTable *table, void *key, void *obj, void *userData) {
     WXFree(key); WXFree(obj);
@@ -138,12 +142,35 @@ static int createConnection(WXDBConnectionPool *pool,
     conn->pool = pool;
     conn->driver = pool->driver;
     conn->next = NULL;
+    conn->nextIdle = NULL;
     conn->inUse = inUse;
     *(conn->lastErrorMsg) = '\0';
 
+    /* Along with the (initially empty) prepared statement cache */
+    if (!WXHash_InitTable(&(conn->stmtCache), 0)) {
+        _dbxfMemFail(pool->lastErrorMsg);
+        (conn->driver->connDestroy)(conn);
+        WXFree(conn);
+        return WXDRC_MEM_ERROR;
+    }
+    conn->stmtCacheCount = 0;
+    conn->stmtCacheClock = 0;
+
     /* Got to here, record the connection instance (under lock share) */
     if (WXThread_MutexLock(&(pool->connLock)) != WXTRC_OK) {
         (void) strcpy(pool->lastErrorMsg, mtxErrorMsg);
+        WXHash_Destroy(&(conn->stmtCache));
+        (conn->driver->connDestroy)(conn);
+        WXFree(conn);
+        return WXDRC_SYS_ERROR;
+    }
+
+    /* Enforce the pool sizing bound (where configured) */
+    if ((pool->maxSize != 0) && (pool->connCount >= pool->maxSize)) {
+        (void) strcpy(pool->lastErrorMsg,
+                      "Connection pool exhausted (at maximum size)");
+        (void) WXThread_MutexUnlock(&(pool->connLock));
+        WXHash_Destroy(&(conn->stmtCache));
         (conn->driver->connDestroy)(conn);
         WXFree(conn);
         return WXDRC_SYS_ERROR;
@@ -156,10 +183,18 @@ static int createConnection(WXDBConnectionPool *pool,
         while (lastConn->next != NULL) lastConn = lastConn->next;
         lastConn->next = conn;
     }
+    pool->connCount++;
+    if (!inUse) {
+        conn->nextIdle = pool->idleConnections;
+        pool->idleConnections = conn;
+        pool->idleCount++;
+    }
     if (connRef != NULL) *connRef = conn;
+    WXSTATS_INCR(dbConnCreates);
 
     if (WXThread_MutexUnlock(&(pool->connLock)) != WXTRC_OK) {
         (void) strcpy(pool->lastErrorMsg, mtxErrorMsg);
+        WXHash_Destroy(&(conn->stmtCache));
         (conn->driver->connDestroy)(conn);
         WXFree(conn);
         return WXDRC_SYS_ERROR;
@@ -168,6 +203,87 @@ static int createConnection(WXDBConnectionPool *pool,
     return WXDRC_OK;
 }
 
+/* Remove a connection from the pool tracking list (called under lock) */
+static void unlinkConnection(WXDBConnectionPool *pool, WXDBConnection *conn) {
+    WXDBConnection **ptr = &(pool->connections);
+
+    while (*ptr != NULL) {
+        if (*ptr == conn) {
+            *ptr = conn->next;
+            break;
+        }
+        ptr = &((*ptr)->next);
+    }
+    pool->connCount--;
+}
+
+/* Background management, validates idle connections and pre-warms to the
+ * configured minimum, keeping both off of the checkout hot path */
+static void *poolMaintenance(void *arg) {
+    WXDBConnectionPool *pool = (WXDBConnectionPool *) arg;
+    WXDBConnection *scan, *live, *next;
+    WXThread_TimeSpec ts;
+
+    (void) WXThread_MutexLock(&(pool->connLock));
+    while (!pool->maintShutdown) {
+        WXThread_GetEpochTime(&ts);
+        ts.tv_sec += WXDB_POOL_MAINT_INTERVAL;
+        (void) WXThread_CondTimedWait(&(pool->maintCond), &(pool->connLock),
+                                      &ts);
+        if (pool->maintShutdown) break;
+
+        /* Claim the entire idle list for validation outside of the lock */
+        scan = pool->idleConnections;
+        pool->idleConnections = NULL;
+        pool->idleCount = 0;
+        (void) WXThread_MutexUnlock(&(pool->connLock));
+
+        live = NULL;
+        while (scan != NULL) {
+            next = scan->nextIdle;
+            WXSTATS_INCR(dbConnPings);
+            if ((pool->driver->connPing)(scan)) {
+                scan->nextIdle = live;
+                live = scan;
+            } else {
+                /* Connection has gone stale, quietly discard it */
+                WXSTATS_INCR(dbConnEvictions);
+                flushStatementCache(scan);
+                WXHash_Destroy(&(scan->stmtCache));
+                (void) WXThread_MutexLock(&(pool->connLock));
+                unlinkConnection(pool, scan);
+                (void) WXThread_MutexUnlock(&(pool->connLock));
+                (scan->driver->connDestroy)(scan);
+                WXFree(scan);
+            }
+            scan = next;
+        }
+
+        /* Return the survivors to circulation */
+        (void) WXThread_MutexLock(&(pool->connLock));
+        while (live != NULL) {
+            next = live->nextIdle;
+            live->nextIdle = pool->idleConnections;
+            pool->idleConnections = live;
+            pool->idleCount++;
+            live = next;
+        }
+
+        /* And pre-warm back up to the configured minimum size */
+        while ((pool->connCount < pool->minSize) && (!pool->maintShutdown)) {
+            (void) WXThread_MutexUnlock(&(pool->connLock));
+            if (createConnection(pool, NULL, FALSE) != WXDRC_OK) {
+                (void) WXThread_MutexLock(&(pool->connLock));
+                break;
+            }
+            (void) WXThread_MutexLock(&(pool->connLock));
+        }
+    }
+    (void) WXThread_MutexUnlock(&(pool->connLock));
+
+    return NULL;
+}
+
 /**
  * Initialize a connection pool instance for the target data source name.
  *
@@ -195,6 +311,11 @@ int WXDBConnectionPool_Init(WXDBConnectionPool *pool, const char *dsn,
     pool->lastErrorMsg[0] = '\0';
     (void) WXHash_InitTable(&(pool->options), 0);
     pool->connections = NULL;
+    pool->idleConnections = NULL;
+    pool->connCount = pool->idleCount = 0;
+    pool->minSize = 1;
+    pool->maxSize = 0;
+    pool->maintActive = pool->maintShutdown = FALSE;
     if (WXThread_MutexInit(&(pool->connLock), FALSE) != WXTRC_OK) {
         (void) strcpy(pool->lastErrorMsg, mtxErrorMsg);
         return WXDRC_SYS_ERROR;
@@ -269,8 +390,20 @@ int WXDBConnectionPool_Init(WXDBConnectionPool *pool, const char *dsn,
         }
     }
 
-    /* And away we go, create the initial connection set (validates login) */
+    /* Pull the dynamic sizing bounds from the DSN options, where given */
+    ptr = (char *) WXHash_GetEntry(&(pool->options), "pool_min",
+                                   WXHash_StrHashFn, WXHash_StrEqualsFn);
+    if (ptr != NULL) pool->minSize = (uint32_t) atoi(ptr);
+    ptr = (char *) WXHash_GetEntry(&(pool->options), "pool_max",
+                                   WXHash_StrHashFn, WXHash_StrEqualsFn);
+    if (ptr != NULL) pool->maxSize = (uint32_t) atoi(ptr);
     if (initialSize == 0) initialSize = 1;
+    if (pool->minSize < initialSize) pool->minSize = initialSize;
+    if ((pool->maxSize != 0) && (pool->maxSize < pool->minSize)) {
+        pool->maxSize = pool->minSize;
+    }
+
+    /* And away we go, create the initial connection set (validates login) */
     while (initialSize > 0) {
         rc = createConnection(pool, NULL, FALSE);
         if (rc != WXDRC_OK) {
@@ -288,6 +421,16 @@ int WXDBConnectionPool_Init(WXDBConnectionPool *pool, const char *dsn,
         initialSize--;
     }
 
+    /* Start the (best-effort) background maintenance instance */
+    if (WXThread_CondInit(&(pool->maintCond)) == WXTRC_OK) {
+        if (WXThread_Create(&(pool->maintThread), poolMaintenance,
+                            pool) == WXTRC_OK) {
+            pool->maintActive = TRUE;
+        } else {
+            (void) WXThread_CondDestroy(&(pool->maintCond));
+        }
+    }
+
     return WXDRC_OK;
 }
 
@@ -301,21 +444,19 @@ int WXDBConnectionPool_Init(WXDBConnectionPool *pool, const char *dsn,
 WXDBConnection *WXDBConnectionPool_Obtain(WXDBConnectionPool *pool) {
     WXDBConnection *conn;
 
-    /* Find an unused connection in the current pool (under lock) */
+    WXSTATS_INCR(dbConnObtains);
+
+    /* Checkout is a constant-time pop from the idle free-list (under lock) */
     if (WXThread_MutexLock(&(pool->connLock)) != WXTRC_OK) {
         (void) strcpy(pool->lastErrorMsg, mtxErrorMsg);
         return NULL;
     }
 
-    /* Let your fingers do the walking... */
-    conn = pool->connections;
-    while (conn != NULL) {
-        if (!conn->inUse) {
-            conn->inUse = TRUE;
-            break;
-        }
-
-        conn = conn->next;
+    if ((conn = pool->idleConnections) != NULL) {
+        pool->idleConnections = conn->nextIdle;
+        pool->idleCount--;
+        conn->nextIdle = NULL;
+        conn->inUse = TRUE;
     }
 
     if (WXThread_MutexUnlock(&(pool->connLock)) != WXTRC_OK) {
@@ -323,7 +464,7 @@ WXDBConnection *WXDBConnectionPool_Obtain(WXDBConnectionPool *pool) {
         return NULL;
     }
 
-    /* And if one isn't found, expand the pool (currently unlimited) */
+    /* And if one isn't found, expand the pool (up to any maximum bound) */
     if (conn == NULL) {
         if (createConnection(pool, &conn, TRUE) != WXDRC_OK) return NULL;
     }
@@ -338,8 +479,15 @@ WXDBConnection *WXDBConnectionPool_Obtain(WXDBConnectionPool *pool) {
  * @param conn Reference to connection to be returned to the pool.
  */
 void WXDBConnectionPool_Return(WXDBConnection *conn) {
-    /* Technically, this would be mutexed but a bit is pretty atomic */
+    WXDBConnectionPool *pool = conn->pool;
+
+    /* Constant-time push back onto the idle free-list */
+    (void) WXThread_MutexLock(&(pool->connLock));
     conn->inUse = FALSE;
+    conn->nextIdle = pool->idleConnections;
+    pool->idleConnections = conn;
+    pool->idleCount++;
+    (void) WXThread_MutexUnlock(&(pool->connLock));
 }
 
 /**
@@ -353,15 +501,30 @@ void WXDBConnectionPool_Return(WXDBConnection *conn) {
 void WXDBConnectionPool_Destroy(WXDBConnectionPool *pool) {
     WXDBConnection *conn, *next;
 
+    /* Stop the maintenance thread before tearing anything down */
+    if (pool->maintActive) {
+        (void) WXThread_MutexLock(&(pool->connLock));
+        pool->maintShutdown = TRUE;
+        (void) WXThread_CondSignal(&(pool->maintCond));
+        (void) WXThread_MutexUnlock(&(pool->connLock));
+        (void) WXThread_Join(pool->maintThread, NULL);
+        (void) WXThread_CondDestroy(&(pool->maintCond));
+        pool->maintActive = FALSE;
+    }
+
     /* Rip out connections array from pool */
     (void) WXThread_MutexLock(&(pool->connLock));
     conn = pool->connections;
     pool->connections = NULL;
+    pool->idleConnections = NULL;
+    pool->connCount = pool->idleCount = 0;
     (void) WXThread_MutexUnlock(&(pool->connLock));
 
     /* Shutdown all allocated connections where created */
     while (conn != NULL) {
         next = conn->next;
+        flushStatementCache(conn);
+        WXHash_Destroy(&(conn->stmtCache));
         conn->driver->connDestroy(conn);
         WXFree(conn);
         conn = next;
@@ -437,11 +600,80 @@ int WXDBConnection_Execute(WXDBConnection *conn, const char *query) {
  * @return A result set instance to retrieve data from (use Next() to get the
  *         first row, where applicable) or NULL on a query or memory failure.
  */
-WXDBResultSet *WXDBConnection_ExecuteQuery(WXDBConnection *conn, 
+WXDBResultSet *WXDBConnection_ExecuteQuery(WXDBConnection *conn,
                                            const char *query) {
     return (conn->driver->qryExecuteQuery)(conn, query);
 }
 
+/**
+ * As for ExecuteQuery, but rows are retrieved from the server incrementally
+ * as the result set is iterated instead of being buffered client-side,
+ * allowing constant-memory traversal of arbitrarily large results.  The
+ * connection must not be used for other operations until the result set has
+ * been fully iterated or closed.
+ *
+ * @param conn Reference to the connection to execute the query against.
+ * @param query The database query to be executed.
+ * @return A result set instance to retrieve data from (use Next() to get the
+ *         first row, where applicable) or NULL on a query or memory failure.
+ */
+WXDBResultSet *WXDBConnection_ExecuteStreamQuery(WXDBConnection *conn,
+                                                 const char *query) {
+    return (conn->driver->qryExecuteStreamQuery)(conn, query);
+}
+
+/**
+ * Submit a result set query for asynchronous execution, returning without
+ * waiting for the database round trip.  Use AsyncHandle to obtain a pollable
+ * descriptor (registerable with WXEvent_RegisterEvent for read events),
+ * AsyncPoll on readiness and AsyncResult on completion.  Only one
+ * asynchronous query may be in flight per connection and the connection
+ * must not be used for other operations until the result is harvested.
+ *
+ * @param conn Reference to the connection to execute the query against.
+ * @param query The database query to be executed.
+ * @return One of the WXDRC_* result codes, depending on (submission) outcome.
+ */
+int WXDBConnection_ExecuteQueryAsync(WXDBConnection *conn, const char *query) {
+    return (conn->driver->qryExecuteQueryAsync)(conn, query);
+}
+
+/**
+ * Obtain the underlying pollable descriptor for an asynchronously executing
+ * query, suitable for read-event registration in an event loop.
+ *
+ * @param conn Reference to the connection with a query in flight.
+ * @return The socket/file descriptor to poll, or -1 if unavailable.
+ */
+int WXDBConnection_AsyncHandle(WXDBConnection *conn) {
+    return (conn->driver->qryAsyncHandle)(conn);
+}
+
+/**
+ * Consume any pending input for an asynchronously executing query,
+ * typically called when the async handle signals readability.
+ *
+ * @param conn Reference to the connection with a query in flight.
+ * @return TRUE (positive) if the query has completed (harvest with
+ *         AsyncResult), FALSE (zero) if still in progress, or a negative
+ *         WXDRC_* error code on connection failure.
+ */
+int WXDBConnection_AsyncPoll(WXDBConnection *conn) {
+    return (conn->driver->qryAsyncPoll)(conn);
+}
+
+/**
+ * Harvest the result set of a completed asynchronous query (AsyncPoll has
+ * returned TRUE).  Note that the cursor is positioned before the first row.
+ *
+ * @param conn Reference to the connection with a completed query.
+ * @return A result set instance to retrieve data from or NULL on a query or
+ *         memory failure (refer to error buffer in connection).
+ */
+WXDBResultSet *WXDBConnection_AsyncResult(WXDBConnection *conn) {
+    return (conn->driver->qryAsyncResult)(conn);
+}
+
 /**
  * Retrieve a count of the number of rows affected by the last execute action
  * in the database.  This should only be used for connection-level execute
@@ -473,27 +705,115 @@ uint64_t WXDBConnection_LastRowId(WXDBConnection *conn) {
 
 /***********************/
 
+/* Scan handlers for statement cache teardown and LRU victim selection */
+static int stmtCacheFlush(WXHashTable *table, void *key, void *obj,
+                          void *userData) {
+    WXDBStatement *stmt = (WXDBStatement *) obj;
+
+    stmt->cacheKey = NULL;
+    (stmt->driver->stmtClose)(stmt);
+    WXFree(key);
+    return FALSE;
+}
+static int stmtCacheLRU(WXHashTable *table, void *key, void *obj,
+                        void *userData) {
+    WXDBStatement **victim = (WXDBStatement **) userData;
+    WXDBStatement *stmt = (WXDBStatement *) obj;
+
+    if ((!stmt->cacheInUse) &&
+            ((*victim == NULL) ||
+                 (stmt->cacheLastUse < (*victim)->cacheLastUse))) {
+        *victim = stmt;
+    }
+    return FALSE;
+}
+
+/* Common method to completely discard a connection statement cache */
+static void flushStatementCache(WXDBConnection *conn) {
+    (void) WXHash_Scan(&(conn->stmtCache), stmtCacheFlush, NULL);
+    WXHash_Empty(&(conn->stmtCache));
+    conn->stmtCacheCount = 0;
+}
+
+/* Best-effort cache insertion for a newly prepared statement */
+static void cacheStatement(WXDBConnection *conn, WXDBStatement *pstmt,
+                           const char *sql) {
+    WXDBStatement *victim = NULL;
+    int len = strlen(sql) + 1;
+    char *key;
+
+    /* Failures here just leave the statement uncached, not an error */
+    if ((key = (char *) WXMalloc(len)) == NULL) return;
+    (void) memcpy(key, sql, len);
+    if (!WXHash_InsertEntry(&(conn->stmtCache), key, pstmt, NULL, NULL,
+                            WXHash_StrHashFn, WXHash_StrEqualsFn)) {
+        WXFree(key);
+        return;
+    }
+    pstmt->cacheKey = key;
+    conn->stmtCacheCount++;
+
+    /* Bound the cache, discarding the least recently used idle entry */
+    if (conn->stmtCacheCount > WXDB_STMT_CACHE_LIMIT) {
+        (void) WXHash_Scan(&(conn->stmtCache), stmtCacheLRU, &victim);
+        if (victim == NULL) return;
+        (void) WXHash_RemoveEntry(&(conn->stmtCache), victim->cacheKey,
+                                  NULL, NULL,
+                                  WXHash_StrHashFn, WXHash_StrEqualsFn);
+        conn->stmtCacheCount--;
+        WXFree(victim->cacheKey);
+        victim->cacheKey = NULL;
+        (victim->driver->stmtClose)(victim);
+    }
+}
+
 /**
  * Create a prepared statement instance for the given SQL statement (standard
  * execute or result query).
  *
  * @param conn Reference to the connection to prepare the statement against.
  * @param stmt SQL statement to be prepared.  Per the standard, parameter
- *             insertion locations are marked by the '?' character.
+ *             insertion locations are marked by the '?' character.  Repeated
+ *             preparation of identical text transparently reuses a cached
+ *             driver statement (note that any previous parameter bindings
+ *             are retained, rebind before executing).
  * @return A prepared statement instance or NULL on memory or SQL error
  *         (refer to error buffer in connection).
  */
 WXDBStatement *WXDBConnection_Prepare(WXDBConnection *conn, const char *stmt) {
-    /* Let the driver create the base instance */
-    WXDBStatement *pstmt = (conn->driver->stmtPrepare)(conn, stmt);
+    WXDBStatement *pstmt;
+
+    /* First choice is an idle cached instance for the same SQL text */
+    pstmt = (WXDBStatement *) WXHash_GetEntry(&(conn->stmtCache),
+                                              (void *) stmt,
+                                              WXHash_StrHashFn,
+                                              WXHash_StrEqualsFn);
+    if ((pstmt != NULL) && (!pstmt->cacheInUse)) {
+        pstmt->cacheInUse = TRUE;
+        pstmt->cacheLastUse = ++(conn->stmtCacheClock);
+        *(pstmt->lastErrorMsg) = '\0';
+        return pstmt;
+    }
+
+    /* Otherwise, let the driver create the base instance */
+    pstmt = (conn->driver->stmtPrepare)(conn, stmt);
     if (pstmt == NULL) return pstmt;
 
     /* Complete the setup (common) */
     pstmt->magic = WXDB_MAGIC_STMT;
     pstmt->parentConn = conn;
     pstmt->driver = conn->driver;
+    pstmt->cacheKey = NULL;
+    pstmt->cacheInUse = TRUE;
+    pstmt->cacheLastUse = ++(conn->stmtCacheClock);
     *(pstmt->lastErrorMsg) = '\0';
 
+    /* Retain for reuse, unless a busy duplicate already holds the slot */
+    if (WXHash_GetEntry(&(conn->stmtCache), (void *) stmt,
+                        WXHash_StrHashFn, WXHash_StrEqualsFn) == NULL) {
+        cacheStatement(conn, pstmt, stmt);
+    }
+
     return pstmt;
 }
 
@@ -560,6 +880,27 @@ int WXDBStatement_Execute(WXDBStatement *stmt) {
     return (stmt->driver->stmtExecute)(stmt);
 }
 
+/**
+ * Execute a prepared statement once for each row of the provided value
+ * array, allowing the driver to collapse the operation into its optimal
+ * bulk form (e.g. multi-row INSERT).  Intended for high-volume ingest of
+ * insert/update statements, not result set queries.
+ *
+ * @param stmt Reference to the prepared statement to be executed.
+ * @param values Row-major array of parameter values (rowCount x paramCount
+ *               entries) in text form, exactly as would be provided to
+ *               BindString.  NULL entries bind SQL NULL.
+ * @param rowCount Number of parameter rows to apply.
+ * @return One of the WXDRC_* result codes, depending on outcome.  On error,
+ *         rows from earlier internal batches may already be applied, wrap
+ *         in a transaction where atomicity is required.  RowsModified
+ *         reflects only the final internal batch.
+ */
+int WXDBStatement_ExecuteBulk(WXDBStatement *stmt, char **values,
+                              uint32_t rowCount) {
+    return (stmt->driver->stmtExecuteBulk)(stmt, values, rowCount);
+}
+
 /**
  * Execute a prepared statement that returns a result set (select).  Note
  * that the cursor is positioned before the first row.
@@ -605,9 +946,27 @@ uint64_t WXDBStatement_LastRowId(WXDBStatement *stmt) {
  * @param conn Reference to the statement to release.
  */
 void WXDBStatement_Close(WXDBStatement *stmt) {
+    /* Cached statements just go idle, awaiting a re-prepare of the text */
+    if (stmt->cacheKey != NULL) {
+        stmt->cacheInUse = FALSE;
+        return;
+    }
+
     (stmt->driver->stmtClose)(stmt);
 }
 
+/**
+ * Discard all cached prepared statements for the given connection, releasing
+ * the underlying driver resources.  Used when resetting connection state
+ * (schema changes, pool recycling), there must be no outstanding statement
+ * references for this connection when invoked.
+ *
+ * @param conn Reference to the connection to flush cached statements for.
+ */
+void WXDBConnection_FlushStatementCache(WXDBConnection *conn) {
+    flushStatementCache(conn);
+}
+
 /***********************/
 
 /**
@@ -662,6 +1021,48 @@ const char *WXDBResultSet_ColumnData(WXDBResultSet *rs, uint32_t columnIdx) {
     return (rs->driver->rsColumnData)(rs, columnIdx);
 }
 
+/**
+ * Retrieve the integer conversion of the data for the indicated column,
+ * decoding directly from the wire representation where the driver supports
+ * it (avoiding text round-tripping for numeric-heavy result sets).
+ *
+ * @param rs Reference to the result set to retrieve the column data for.
+ * @param columnIdx Numeric index of the column, starting from zero.
+ * @return Integer value of the underlying column data for the current row,
+ *         zero for NULL or non-numeric content.
+ */
+int WXDBResultSet_ColumnInt(WXDBResultSet *rs, uint32_t columnIdx) {
+    return (rs->driver->rsColumnInt)(rs, columnIdx);
+}
+
+/**
+ * Retrieve the long integer conversion of the data for the indicated column,
+ * decoding directly from the wire representation where the driver supports
+ * it (avoiding text round-tripping for numeric-heavy result sets).
+ *
+ * @param rs Reference to the result set to retrieve the column data for.
+ * @param columnIdx Numeric index of the column, starting from zero.
+ * @return Long value of the underlying column data for the current row,
+ *         zero for NULL or non-numeric content.
+ */
+long long WXDBResultSet_ColumnLong(WXDBResultSet *rs, uint32_t columnIdx) {
+    return (rs->driver->rsColumnLong)(rs, columnIdx);
+}
+
+/**
+ * Retrieve the floating point conversion of the data for the indicated
+ * column, decoding directly from the wire representation where the driver
+ * supports it (avoiding text round-tripping for numeric-heavy result sets).
+ *
+ * @param rs Reference to the result set to retrieve the column data for.
+ * @param columnIdx Numeric index of the column, starting from zero.
+ * @return Double value of the underlying column data for the current row,
+ *         zero for NULL or non-numeric content.
+ */
+double WXDBResultSet_ColumnDouble(WXDBResultSet *rs, uint32_t columnIdx) {
+    return (rs->driver->rsColumnDouble)(rs, columnIdx);
+}
+
 /**
  * Advance the result set position to the next row (on creation, the cursor
  * location is before the first row).
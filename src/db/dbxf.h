@@ -60,6 +60,19 @@ typedef struct WXDBConnectionPool {
     WXDBConnection *connections;
     WXThread_Mutex connLock;
 
+    /* Idle connection free-list for constant-time checkout/return */
+    WXDBConnection *idleConnections;
+    uint32_t connCount, idleCount;
+
+    /* Dynamic sizing bounds, from pool_min/pool_max DSN options (a maximum
+     * of zero is unbounded) */
+    uint32_t minSize, maxSize;
+
+    /* Background maintenance (validation/pre-warming) thread management */
+    WXThread maintThread;
+    WXThread_Cond maintCond;
+    int maintActive, maintShutdown;
+
     /* Storage element for pool-level error conditions (alloc safe) */
     char lastErrorMsg[WXDB_FIXED_ERROR_SIZE];
 } WXDBConnectionPool;
@@ -177,6 +190,65 @@ int WXDBConnection_Execute(WXDBConnection *conn, const char *query);
 WXDBResultSet *WXDBConnection_ExecuteQuery(WXDBConnection *conn,
                                            const char *query);
 
+/**
+ * As for ExecuteQuery, but rows are retrieved from the server incrementally
+ * as the result set is iterated instead of being buffered client-side,
+ * allowing constant-memory traversal of arbitrarily large results.  The
+ * connection must not be used for other operations until the result set has
+ * been fully iterated or closed.
+ *
+ * @param conn Reference to the connection to execute the query against.
+ * @param query The database query to be executed.
+ * @return A result set instance to retrieve data from (use Next() to get the
+ *         first row, where applicable) or NULL on a query or memory failure.
+ */
+WXDBResultSet *WXDBConnection_ExecuteStreamQuery(WXDBConnection *conn,
+                                                 const char *query);
+
+/**
+ * Submit a result set query for asynchronous execution, returning without
+ * waiting for the database round trip.  Use AsyncHandle to obtain a pollable
+ * descriptor (registerable with WXEvent_RegisterEvent for read events),
+ * AsyncPoll on readiness and AsyncResult on completion.  Only one
+ * asynchronous query may be in flight per connection and the connection
+ * must not be used for other operations until the result is harvested.
+ *
+ * @param conn Reference to the connection to execute the query against.
+ * @param query The database query to be executed.
+ * @return One of the WXDRC_* result codes, depending on (submission) outcome.
+ */
+int WXDBConnection_ExecuteQueryAsync(WXDBConnection *conn, const char *query);
+
+/**
+ * Obtain the underlying pollable descriptor for an asynchronously executing
+ * query, suitable for read-event registration in an event loop.
+ *
+ * @param conn Reference to the connection with a query in flight.
+ * @return The socket/file descriptor to poll, or -1 if unavailable.
+ */
+int WXDBConnection_AsyncHandle(WXDBConnection *conn);
+
+/**
+ * Consume any pending input for an asynchronously executing query,
+ * typically called when the async handle signals readability.
+ *
+ * @param conn Reference to the connection with a query in flight.
+ * @return TRUE (positive) if the query has completed (harvest with
+ *         AsyncResult), FALSE (zero) if still in progress, or a negative
+ *         WXDRC_* error code on connection failure.
+ */
+int WXDBConnection_AsyncPoll(WXDBConnection *conn);
+
+/**
+ * Harvest the result set of a completed asynchronous query (AsyncPoll has
+ * returned TRUE).  Note that the cursor is positioned before the first row.
+ *
+ * @param conn Reference to the connection with a completed query.
+ * @return A result set instance to retrieve data from or NULL on a query or
+ *         memory failure (refer to error buffer in connection).
+ */
+WXDBResultSet *WXDBConnection_AsyncResult(WXDBConnection *conn);
+
 /**
  * Retrieve a count of the number of rows affected by the last execute action
  * in the database.  This should only be used for connection-level execute
@@ -208,12 +280,25 @@ uint64_t WXDBConnection_LastRowId(WXDBConnection *conn);
  *
  * @param conn Reference to the connection to prepare the statement against.
  * @param stmt SQL statement to be prepared.  Per the standard, parameter
- *             insertion locations are marked by the '?' character.
+ *             insertion locations are marked by the '?' character.  Repeated
+ *             preparation of identical text transparently reuses a cached
+ *             driver statement (note that any previous parameter bindings
+ *             are retained, rebind before executing).
  * @return A prepared statement instance or NULL on memory or SQL error
  *         (refer to error buffer in connection).
  */
 WXDBStatement *WXDBConnection_Prepare(WXDBConnection *conn, const char *stmt);
 
+/**
+ * Discard all cached prepared statements for the given connection, releasing
+ * the underlying driver resources.  Used when resetting connection state
+ * (schema changes, pool recycling), there must be no outstanding statement
+ * references for this connection when invoked.
+ *
+ * @param conn Reference to the connection to flush cached statements for.
+ */
+void WXDBConnection_FlushStatementCache(WXDBConnection *conn);
+
 /**
  * Bind an integer parameter for a subsequent prepared statement execution.
  *
@@ -267,6 +352,25 @@ int WXDBStatement_BindString(WXDBStatement *stmt, int paramIdx, char *val);
  */
 int WXDBStatement_Execute(WXDBStatement *stmt);
 
+/**
+ * Execute a prepared statement once for each row of the provided value
+ * array, allowing the driver to collapse the operation into its optimal
+ * bulk form (e.g. multi-row INSERT).  Intended for high-volume ingest of
+ * insert/update statements, not result set queries.
+ *
+ * @param stmt Reference to the prepared statement to be executed.
+ * @param values Row-major array of parameter values (rowCount x paramCount
+ *               entries) in text form, exactly as would be provided to
+ *               BindString.  NULL entries bind SQL NULL.
+ * @param rowCount Number of parameter rows to apply.
+ * @return One of the WXDRC_* result codes, depending on outcome.  On error,
+ *         rows from earlier internal batches may already be applied, wrap
+ *         in a transaction where atomicity is required.  RowsModified
+ *         reflects only the final internal batch.
+ */
+int WXDBStatement_ExecuteBulk(WXDBStatement *stmt, char **values,
+                              uint32_t rowCount);
+
 /**
  * Execute a prepared statement that returns a result set (select).  Note
  * that the cursor is positioned before the first row.
@@ -351,6 +455,42 @@ int WXDBResultSet_ColumnIsNull(WXDBResultSet *rs, uint32_t columnIdx);
  */
 const char *WXDBResultSet_ColumnData(WXDBResultSet *rs, uint32_t columnIdx);
 
+/**
+ * Retrieve the integer conversion of the data for the indicated column,
+ * decoding directly from the wire representation where the driver supports
+ * it (avoiding text round-tripping for numeric-heavy result sets).
+ *
+ * @param rs Reference to the result set to retrieve the column data for.
+ * @param columnIdx Numeric index of the column, starting from zero.
+ * @return Integer value of the underlying column data for the current row,
+ *         zero for NULL or non-numeric content.
+ */
+int WXDBResultSet_ColumnInt(WXDBResultSet *rs, uint32_t columnIdx);
+
+/**
+ * Retrieve the long integer conversion of the data for the indicated column,
+ * decoding directly from the wire representation where the driver supports
+ * it (avoiding text round-tripping for numeric-heavy result sets).
+ *
+ * @param rs Reference to the result set to retrieve the column data for.
+ * @param columnIdx Numeric index of the column, starting from zero.
+ * @return Long value of the underlying column data for the current row,
+ *         zero for NULL or non-numeric content.
+ */
+long long WXDBResultSet_ColumnLong(WXDBResultSet *rs, uint32_t columnIdx);
+
+/**
+ * Retrieve the floating point conversion of the data for the indicated
+ * column, decoding directly from the wire representation where the driver
+ * supports it (avoiding text round-tripping for numeric-heavy result sets).
+ *
+ * @param rs Reference to the result set to retrieve the column data for.
+ * @param columnIdx Numeric index of the column, starting from zero.
+ * @return Double value of the underlying column data for the current row,
+ *         zero for NULL or non-numeric content.
+ */
+double WXDBResultSet_ColumnDouble(WXDBResultSet *rs, uint32_t columnIdx);
+
 /**
  * Advance the result set position to the next row (on creation, the cursor
  * location is before the first row).
@@ -21,6 +21,12 @@ void _dbxfMemFail(char *dst);
 #define WXDB_MAGIC_STMT 0x6AC23B48
 #define WXDB_MAGIC_RSLT 0x3E1ACAB1
 
+/* Upper bound on retained (idle or active) statements per connection */
+#define WXDB_STMT_CACHE_LIMIT 32
+
+/* Seconds between background pool validation/pre-warming passes */
+#define WXDB_POOL_MAINT_INTERVAL 30
+
 /* Complete the opaque data structures */
 struct WXDBResultSet {
     /* All structures start with this to support abstract methods */
@@ -43,6 +49,11 @@ struct WXDBStatement {
     WXDBConnection *parentConn;
     WXDBDriver *driver;
 
+    /* Cache residency (managed by dbxf.c), owned SQL key and LRU details */
+    char *cacheKey;
+    int cacheInUse;
+    uint64_t cacheLastUse;
+
     /* Like the others, use a local buffer for statement error messaging */
     char lastErrorMsg[WXDB_FIXED_ERROR_SIZE];
 };
@@ -58,9 +69,18 @@ struct WXDBConnection {
     /* Tracking of the pool connections is done through a linked list */
     WXDBConnection *next;
 
+    /* Along with a separate linkage for the idle (checkout) free-list */
+    WXDBConnection *nextIdle;
+
     /* Marker for tracking pool entries that are in use */
     int inUse;
 
+    /* Prepared statement cache, keyed by SQL text, with LRU accounting */
+    /* (no locking, connections are single-owner while checked out) */
+    WXHashTable stmtCache;
+    uint32_t stmtCacheCount;
+    uint64_t stmtCacheClock;
+
     /* Like the pool, use a local buffer for connection error messaging */
     char lastErrorMsg[WXDB_FIXED_ERROR_SIZE];
 };
@@ -84,9 +104,17 @@ struct WXDBDriver {
     /* Standard connection-level query elements */
     int (*qryExecute)(WXDBConnection *conn, const char *query);
     WXDBResultSet *(*qryExecuteQuery)(WXDBConnection *conn, const char *query);
+    WXDBResultSet *(*qryExecuteStreamQuery)(WXDBConnection *conn,
+                                            const char *query);
     int64_t (*qryRowsModified)(WXDBConnection *conn);
     uint64_t (*qryLastRowId)(WXDBConnection *conn);
 
+    /* Asynchronous (event-loop) query submission and harvesting */
+    int (*qryExecuteQueryAsync)(WXDBConnection *conn, const char *query);
+    int (*qryAsyncHandle)(WXDBConnection *conn);
+    int (*qryAsyncPoll)(WXDBConnection *conn);
+    WXDBResultSet *(*qryAsyncResult)(WXDBConnection *conn);
+
     /* Prepared statement fun */
     WXDBStatement *(*stmtPrepare)(WXDBConnection *conn, const char *stmt);
     int (*stmtBindInt)(WXDBStatement *stmt, int paramIdx, int val);
@@ -94,6 +122,8 @@ struct WXDBDriver {
     int (*stmtBindDouble)(WXDBStatement *stmt, int paramIdx, double val);
     int (*stmtBindString)(WXDBStatement *stmt, int paramIdx, char *val);
     int (*stmtExecute)(WXDBStatement *stmt);
+    int (*stmtExecuteBulk)(WXDBStatement *stmt, char **values,
+                           uint32_t rowCount);
     WXDBResultSet *(*stmtExecuteQuery)(WXDBStatement *stmt);
     int64_t (*stmtRowsModified)(WXDBStatement *stmt);
     uint64_t (*stmtLastRowId)(WXDBStatement *stmt);
@@ -104,6 +134,9 @@ struct WXDBDriver {
     const char *(*rsColumnName)(WXDBResultSet *rs, uint32_t columnIdx);
     int (*rsColumnIsNull)(WXDBResultSet *rs, uint32_t columnIdx);
     const char *(*rsColumnData)(WXDBResultSet *rs, uint32_t columnIdx);
+    int (*rsColumnInt)(WXDBResultSet *rs, uint32_t columnIdx);
+    long long (*rsColumnLong)(WXDBResultSet *rs, uint32_t columnIdx);
+    double (*rsColumnDouble)(WXDBResultSet *rs, uint32_t columnIdx);
     int (*rsNextRow)(WXDBResultSet *rs);
     void (*rsClose)(WXDBResultSet *rs);
 };
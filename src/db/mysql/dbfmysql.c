@@ -321,6 +321,33 @@ static WXDBResultSet *WXDBMYSQLQry_ExecuteQuery(WXDBConnection *conn,
     return createResultSet(conn, NULL, stmt);
 }
 
+static int WXDBMYSQLQry_ExecuteQueryAsync(WXDBConnection *conn,
+                                          const char *query) {
+    /* Stock client library has no completion polling (MariaDB-only) */
+    (void) strcpy(conn->lastErrorMsg,
+                  "Asynchronous queries not supported by the mysql driver");
+    return WXDRC_SYS_ERROR;
+}
+
+static int WXDBMYSQLQry_AsyncHandle(WXDBConnection *conn) {
+    return -1;
+}
+
+static int WXDBMYSQLQry_AsyncPoll(WXDBConnection *conn) {
+    return WXDRC_SYS_ERROR;
+}
+
+static WXDBResultSet *WXDBMYSQLQry_AsyncResult(WXDBConnection *conn) {
+    return NULL;
+}
+
+static WXDBResultSet *WXDBMYSQLQry_ExecuteStreamQuery(WXDBConnection *conn,
+                                                      const char *query) {
+    /* The standard path already streams via the read-only server cursor
+     * (no mysql_stmt_store_result), so retrieval is identical */
+    return WXDBMYSQLQry_ExecuteQuery(conn, query);
+}
+
 static int64_t WXDBMYSQLQry_RowsModified(WXDBConnection *conn) {
     MYSQL *db = ((WXMYSQLConnection *) conn)->db;
     uint64_t rows = mysql_affected_rows(db);
@@ -371,6 +398,12 @@ static int WXDBMYSQLStmt_Execute(WXDBStatement *stmt) {
     return 0;
 }
 
+static int WXDBMYSQLStmt_ExecuteBulk(WXDBStatement *stmt, char **values,
+                                     uint32_t rowCount) {
+    /* Pending the statement implementation above, batch via STMT_ATTR_ARRAY */
+    return 0;
+}
+
 static WXDBResultSet *WXDBMYSQLStmt_ExecuteQuery(WXDBStatement *stmt) {
     return NULL;
 }
@@ -422,6 +455,26 @@ static const char *WXDBMYSQLRsltSet_ColumnData(WXDBResultSet *rs,
     return buffer;
 }
 
+static int WXDBMYSQLRsltSet_ColumnInt(WXDBResultSet *rs, uint32_t colIdx) {
+    const char *data = WXDBMYSQLRsltSet_ColumnData(rs, colIdx);
+
+    return (data == NULL) ? 0 : atoi(data);
+}
+
+static long long WXDBMYSQLRsltSet_ColumnLong(WXDBResultSet *rs,
+                                             uint32_t colIdx) {
+    const char *data = WXDBMYSQLRsltSet_ColumnData(rs, colIdx);
+
+    return (data == NULL) ? 0 : atoll(data);
+}
+
+static double WXDBMYSQLRsltSet_ColumnDouble(WXDBResultSet *rs,
+                                            uint32_t colIdx) {
+    const char *data = WXDBMYSQLRsltSet_ColumnData(rs, colIdx);
+
+    return (data == NULL) ? 0.0 : strtod(data, NULL);
+}
+
 static int WXDBMYSQLRsltSet_NextRow(WXDBResultSet *rs) {
     WXMYSQLResultSet *rsltSet = (WXMYSQLResultSet *) rs;
     unsigned long len;
@@ -494,15 +547,22 @@ WXDBDriver _WXDBMYSQLDriver = {
 
     WXDBMYSQLQry_Execute,
     WXDBMYSQLQry_ExecuteQuery,
+    WXDBMYSQLQry_ExecuteStreamQuery,
     WXDBMYSQLQry_RowsModified,
     WXDBMYSQLQry_LastRowId,
 
+    WXDBMYSQLQry_ExecuteQueryAsync,
+    WXDBMYSQLQry_AsyncHandle,
+    WXDBMYSQLQry_AsyncPoll,
+    WXDBMYSQLQry_AsyncResult,
+
     WXDBMYSQLStmt_Prepare,
     WXDBMYSQLStmt_BindInt,
     WXDBMYSQLStmt_BindLong,
     WXDBMYSQLStmt_BindDouble,
     WXDBMYSQLStmt_BindString,
     WXDBMYSQLStmt_Execute,
+    WXDBMYSQLStmt_ExecuteBulk,
     WXDBMYSQLStmt_ExecuteQuery,
     WXDBMYSQLStmt_RowsModified,
     WXDBMYSQLStmt_LastRowId,
@@ -512,6 +572,9 @@ WXDBDriver _WXDBMYSQLDriver = {
     WXDBMYSQLRsltSet_ColumnName,
     WXDBMYSQLRsltSet_ColumnIsNull,
     WXDBMYSQLRsltSet_ColumnData,
+    WXDBMYSQLRsltSet_ColumnInt,
+    WXDBMYSQLRsltSet_ColumnLong,
+    WXDBMYSQLRsltSet_ColumnDouble,
     WXDBMYSQLRsltSet_NextRow,
     WXDBMYSQLRsltSet_Close
 };
@@ -7,6 +7,7 @@
  */
 #include "dbxfint.h"
 #include <libpq-fe.h>
+#include <ctype.h>
 #include "buffer.h"
 #include "hash.h"
 
@@ -19,6 +20,9 @@ typedef struct WXPGSQLConnection {
     PGconn *db;
     PGresult *lastConnRslt;
     uint32_t pstmtCount;
+
+    /* If set, statement queries request binary (wire) result format */
+    int binaryResults;
 } WXPGSQLConnection;
 
 /* Local copies of non-string bound variable content */
@@ -45,6 +49,9 @@ typedef struct WXPGSQLStatement {
     /* Local storage instance for non-string parameters */
     WXPGSQLLocalParam *localParams;
 
+    /* Retained ($-translated) statement text for bulk execution rewrites */
+    char *stmtText;
+
     /* Last execution result for the prepared statement (exec or query) */
     PGresult *lastRslt;
 } WXPGSQLStatement;
@@ -58,6 +65,12 @@ typedef struct WXPGSQLResultSet {
 
     /* Store the column count for optimized error checking */
     uint32_t columnCount, currentRow, rowCount;
+
+    /* Render target for text access against binary numeric columns */
+    char scratch[64];
+
+    /* Single-row (streaming) retrieval state */
+    int isStreaming, streamDone;
 } WXPGSQLResultSet;
 
 /* Common method for result set creation from statement execution */
@@ -80,6 +93,7 @@ static WXDBResultSet *createResultSet(WXDBConnection *conn,
     res->columnCount = (uint32_t) PQnfields(rslt);
     res->currentRow = (uint32_t) -1;
     res->rowCount = PQntuples(rslt);
+    res->isStreaming = res->streamDone = FALSE;
 
     return (WXDBResultSet *) res;
 }
@@ -173,6 +187,12 @@ static int WXDBPGSQLConnection_Create(WXDBConnectionPool *pool,
         if (!appendParameter(&params, "password", opt)) return WXDRC_MEM_ERROR;
     }
 
+    /* Binary result transfers are an opt-in connection setting */
+    opt = (char *) WXHash_GetEntry(options, "binary_results",
+                                   WXHash_StrHashFn, WXHash_StrEqualsFn);
+    conn->binaryResults = ((opt != NULL) && (strcmp(opt, "0") != 0) &&
+                               (strcasecmp(opt, "false") != 0)) ? 1 : 0;
+
     /* Reach out and touch someone... */
     conn->db = PQconnectdb((char *) params.buffer);
     conn->lastConnRslt = NULL;
@@ -329,6 +349,115 @@ static WXDBResultSet *WXDBPGSQLQry_ExecuteQuery(WXDBConnection *conn,
     return NULL;
 }
 
+static WXDBResultSet *WXDBPGSQLQry_ExecuteStreamQuery(WXDBConnection *conn,
+                                                      const char *query) {
+    WXPGSQLConnection *pgConn = (WXPGSQLConnection *) conn;
+    WXPGSQLResultSet *res;
+    ExecStatusType status;
+    PGresult *rslt, *next;
+
+    /* Submit and switch to single-row retrieval before consuming */
+    resetConnResults(conn);
+    if (!PQsendQuery(pgConn->db, query)) {
+        _dbxfStrNCpy(conn->lastErrorMsg, PQerrorMessage(pgConn->db),
+                     WXDB_FIXED_ERROR_SIZE);
+        return NULL;
+    }
+    (void) PQsetSingleRowMode(pgConn->db);
+
+    /* Pull the first row result, which also validates the query */
+    if ((rslt = PQgetResult(pgConn->db)) == NULL) {
+        (void) strcpy(conn->lastErrorMsg, "Missing streaming query result");
+        return NULL;
+    }
+    status = PQresultStatus(rslt);
+    if ((status != PGRES_SINGLE_TUPLE) && (status != PGRES_TUPLES_OK)) {
+        if (status == PGRES_COMMAND_OK) {
+            (void) strcpy(conn->lastErrorMsg,
+                          "ExecuteQuery called with non-result-set query");
+        } else {
+            _dbxfStrNCpy(conn->lastErrorMsg, PQresultErrorMessage(rslt),
+                         WXDB_FIXED_ERROR_SIZE);
+        }
+        PQclear(rslt);
+        while ((next = PQgetResult(pgConn->db)) != NULL) PQclear(next);
+        return NULL;
+    }
+
+    /* Note: the first-row result is held directly, not as lastConnRslt */
+    res = (WXPGSQLResultSet *) createResultSet(conn, NULL, rslt);
+    if (res == NULL) {
+        PQclear(rslt);
+        while ((next = PQgetResult(pgConn->db)) != NULL) PQclear(next);
+        return NULL;
+    }
+    res->isStreaming = TRUE;
+    res->streamDone = (status == PGRES_TUPLES_OK) ? TRUE : FALSE;
+    if (res->streamDone) {
+        /* Empty result, drain the completion state immediately */
+        while ((next = PQgetResult(pgConn->db)) != NULL) PQclear(next);
+    }
+    return (WXDBResultSet *) res;
+}
+
+static int WXDBPGSQLQry_ExecuteQueryAsync(WXDBConnection *conn,
+                                          const char *query) {
+    WXPGSQLConnection *pgConn = (WXPGSQLConnection *) conn;
+
+    resetConnResults(conn);
+    if (!PQsendQuery(pgConn->db, query)) {
+        _dbxfStrNCpy(conn->lastErrorMsg, PQerrorMessage(pgConn->db),
+                     WXDB_FIXED_ERROR_SIZE);
+        return WXDRC_DB_ERROR;
+    }
+    (void) PQflush(pgConn->db);
+    return WXDRC_OK;
+}
+
+static int WXDBPGSQLQry_AsyncHandle(WXDBConnection *conn) {
+    return PQsocket(((WXPGSQLConnection *) conn)->db);
+}
+
+static int WXDBPGSQLQry_AsyncPoll(WXDBConnection *conn) {
+    PGconn *db = ((WXPGSQLConnection *) conn)->db;
+
+    if (!PQconsumeInput(db)) {
+        _dbxfStrNCpy(conn->lastErrorMsg, PQerrorMessage(db),
+                     WXDB_FIXED_ERROR_SIZE);
+        return WXDRC_DB_ERROR;
+    }
+    return (PQisBusy(db)) ? FALSE : TRUE;
+}
+
+static WXDBResultSet *WXDBPGSQLQry_AsyncResult(WXDBConnection *conn) {
+    WXPGSQLConnection *pgConn = (WXPGSQLConnection *) conn;
+    ExecStatusType status;
+    PGresult *rslt, *next;
+
+    /* Collect the query result, draining the completion marker(s) */
+    if ((rslt = PQgetResult(pgConn->db)) == NULL) {
+        (void) strcpy(conn->lastErrorMsg, "No asynchronous query in flight");
+        return NULL;
+    }
+    while ((next = PQgetResult(pgConn->db)) != NULL) {
+        PQclear(rslt);
+        rslt = next;
+    }
+
+    if ((status = PQresultStatus(rslt)) == PGRES_TUPLES_OK) {
+        pgConn->lastConnRslt = rslt;
+        return createResultSet(conn, NULL, rslt);
+    } else if (status == PGRES_COMMAND_OK) {
+        (void) strcpy(conn->lastErrorMsg,
+                      "ExecuteQuery called with non-result-set query");
+    } else {
+        _dbxfStrNCpy(conn->lastErrorMsg, PQresultErrorMessage(rslt),
+                     WXDB_FIXED_ERROR_SIZE);
+    }
+    PQclear(rslt);
+    return NULL;
+}
+
 static int64_t WXDBPGSQLQry_RowsModified(WXDBConnection *conn) {
     PGresult *rslt = ((WXPGSQLConnection *) conn)->lastConnRslt;
     const char *cnt;
@@ -360,6 +489,7 @@ static void freeStatement(WXPGSQLStatement *pstmt) {
     if (pstmt->paramLengths != NULL) WXFree(pstmt->paramLengths);
     if (pstmt->paramFormats != NULL) WXFree(pstmt->paramFormats);
     if (pstmt->localParams != NULL) WXFree(pstmt->localParams);
+    if (pstmt->stmtText != NULL) WXFree(pstmt->stmtText);
     WXFree(pstmt);
 }
 
@@ -427,11 +557,11 @@ static WXDBStatement *WXDBPGSQLStmt_Prepare(WXDBConnection *conn,
         return NULL;
     }
 
-    /* All set, create the statement */
+    /* All set, create the statement (retain text for bulk rewriting) */
     resetConnResults(conn);
     rslt = PQprepare(pgConn->db, pstmt->stmtName, fstmt, 0, NULL);
     status = PQresultStatus(rslt);
-    WXFree(fstmt);
+    pstmt->stmtText = fstmt;
 
     if ((status == PGRES_EMPTY_QUERY) || (status == PGRES_COMMAND_OK) ||
             (status == PGRES_TUPLES_OK)) {
@@ -526,6 +656,161 @@ static int WXDBPGSQLStmt_Execute(WXDBStatement *stmt) {
     return WXDRC_DB_ERROR;
 }
 
+/* The wire protocol carries parameter counts as 16-bit, cap accordingly */
+#define PGSQL_MAX_BULK_PARAMS 65535
+
+/* Locate the trailing VALUES (...) group of an INSERT for multi-row use */
+static int locateValuesGroup(const char *stmtText, const char **grpStart,
+                             const char **grpEnd) {
+    const char *ptr = stmtText, *vals = NULL, *close;
+    char ch, qt = '\0';
+
+    /* Only an INSERT statement qualifies for value list expansion */
+    while (isspace((int) *ptr)) ptr++;
+    if (strncasecmp(ptr, "insert", 6) != 0) return FALSE;
+
+    /* Find the last VALUES keyword, outside of any quoted content */
+    while ((ch = *ptr) != '\0') {
+        if (qt != '\0') {
+            if (ch == qt) qt = '\0';
+        } else if ((ch == '\'') || (ch == '"')) {
+            qt = ch;
+        } else if (((ch == 'v') || (ch == 'V')) &&
+                (strncasecmp(ptr, "values", 6) == 0) &&
+                (isspace((int) *(ptr - 1)) || (*(ptr - 1) == ')')) &&
+                (isspace((int) *(ptr + 6)) || (*(ptr + 6) == '('))) {
+            vals = ptr;
+        }
+        ptr++;
+    }
+    if (vals == NULL) return FALSE;
+
+    /* And the remainder must be exactly one parenthesized value group */
+    ptr = vals + 6;
+    while (isspace((int) *ptr)) ptr++;
+    if (*ptr != '(') return FALSE;
+    *grpStart = ptr;
+    if ((close = strrchr(ptr, ')')) == NULL) return FALSE;
+    *grpEnd = close + 1;
+    ptr = close + 1;
+    while ((*ptr == ';') || (isspace((int) *ptr))) ptr++;
+    return (*ptr == '\0') ? TRUE : FALSE;
+}
+
+/* Append a copy of the value group with the $n markers offset by shift */
+static uint8_t *appendShiftedGroup(WXBuffer *buffer, const char *grpStart,
+                                   const char *grpEnd, uint32_t shift) {
+    const char *ptr = grpStart, *blk = grpStart;
+    char num[16];
+    uint32_t val;
+    int len;
+
+    while (ptr < grpEnd) {
+        if (*ptr != '$') {
+            ptr++;
+            continue;
+        }
+
+        if ((len = (ptr - blk)) > 0) {
+            if (WXBuffer_Append(buffer, (char *) blk, len, TRUE) == NULL)
+                                                                 return NULL;
+        }
+        val = 0; ptr++;
+        while (isdigit((int) *ptr)) val = val * 10 + (*(ptr++) - '0');
+        len = sprintf(num, "$%u", val + shift);
+        if (WXBuffer_Append(buffer, num, len, TRUE) == NULL) return NULL;
+        blk = ptr;
+    }
+    if ((len = (grpEnd - blk)) > 0) {
+        if (WXBuffer_Append(buffer, (char *) blk, len, TRUE) == NULL)
+                                                                 return NULL;
+    }
+
+    return buffer->buffer;
+}
+
+static int WXDBPGSQLStmt_ExecuteBulk(WXDBStatement *stmt, char **values,
+                                     uint32_t rowCount) {
+    WXPGSQLStatement *pgStmt = (WXPGSQLStatement *) stmt;
+    WXPGSQLConnection *pgConn = (WXPGSQLConnection *) pgStmt->base.parentConn;
+    uint32_t row, cnt, chunk, maxRows, paramCount = pgStmt->paramCount;
+    const char *grpStart, *grpEnd;
+    ExecStatusType status;
+    char sqlBuff[4096];
+    PGresult *rslt;
+    WXBuffer sql;
+
+    if (paramCount == 0) {
+        (void) strcpy(stmt->lastErrorMsg,
+                      "Bulk execution requires statement parameters");
+        return WXDRC_SYS_ERROR;
+    }
+    resetStmtResults(pgStmt);
+    if (rowCount == 0) return WXDRC_OK;
+
+    /* Statements without an expandable value list just execute row-wise */
+    if (!locateValuesGroup(pgStmt->stmtText, &grpStart, &grpEnd)) {
+        for (row = 0; row < rowCount; row++) {
+            rslt = PQexecPrepared(pgConn->db, pgStmt->stmtName, paramCount,
+                                  (const char **) (values + row * paramCount),
+                                  NULL, NULL, 0);
+            status = PQresultStatus(rslt);
+            if ((status != PGRES_COMMAND_OK) && (status != PGRES_TUPLES_OK)) {
+                _dbxfStrNCpy(stmt->lastErrorMsg, PQresultErrorMessage(rslt),
+                             WXDB_FIXED_ERROR_SIZE);
+                PQclear(rslt);
+                return WXDRC_DB_ERROR;
+            }
+            if (row == rowCount - 1) pgStmt->lastRslt = rslt;
+            else PQclear(rslt);
+        }
+        return WXDRC_OK;
+    }
+
+    /* Otherwise, rewrite as multi-row inserts in maximal chunks */
+    if ((maxRows = PGSQL_MAX_BULK_PARAMS / paramCount) == 0) maxRows = 1;
+    WXBuffer_InitLocal(&sql, sqlBuff, sizeof(sqlBuff));
+    for (row = 0; row < rowCount; row += chunk) {
+        chunk = rowCount - row;
+        if (chunk > maxRows) chunk = maxRows;
+
+        sql.length = 0;
+        if (WXBuffer_Append(&sql, pgStmt->stmtText,
+                            grpStart - pgStmt->stmtText, TRUE) == NULL)
+                                                                  goto memfail;
+        for (cnt = 0; cnt < chunk; cnt++) {
+            if ((cnt != 0) &&
+                    (WXBuffer_Append(&sql, ", ", 2, TRUE) == NULL))
+                                                                  goto memfail;
+            if (appendShiftedGroup(&sql, grpStart, grpEnd,
+                                   cnt * paramCount) == NULL) goto memfail;
+        }
+        if (WXBuffer_Append(&sql, "", 1, TRUE) == NULL) goto memfail;
+
+        rslt = PQexecParams(pgConn->db, (char *) sql.buffer,
+                            chunk * paramCount, NULL,
+                            (const char **) (values + row * paramCount),
+                            NULL, NULL, 0);
+        status = PQresultStatus(rslt);
+        if ((status != PGRES_COMMAND_OK) && (status != PGRES_TUPLES_OK)) {
+            _dbxfStrNCpy(stmt->lastErrorMsg, PQresultErrorMessage(rslt),
+                         WXDB_FIXED_ERROR_SIZE);
+            PQclear(rslt);
+            WXBuffer_Destroy(&sql);
+            return WXDRC_DB_ERROR;
+        }
+        if (row + chunk >= rowCount) pgStmt->lastRslt = rslt;
+        else PQclear(rslt);
+    }
+    WXBuffer_Destroy(&sql);
+    return WXDRC_OK;
+
+memfail:
+    WXBuffer_Destroy(&sql);
+    _dbxfMemFail(stmt->lastErrorMsg);
+    return WXDRC_MEM_ERROR;
+}
+
 static WXDBResultSet *WXDBPGSQLStmt_ExecuteQuery(WXDBStatement *stmt) {
     WXPGSQLStatement *pgStmt = (WXPGSQLStatement *) stmt;
     WXPGSQLConnection *pgConn = (WXPGSQLConnection *) pgStmt->base.parentConn;
@@ -535,7 +820,8 @@ static WXDBResultSet *WXDBPGSQLStmt_ExecuteQuery(WXDBStatement *stmt) {
     resetStmtResults(pgStmt);
     rslt = PQexecPrepared(pgConn->db, pgStmt->stmtName, pgStmt->paramCount,
                           (const char **) pgStmt->paramValues,
-                          pgStmt->paramLengths, pgStmt->paramFormats, 0);
+                          pgStmt->paramLengths, pgStmt->paramFormats,
+                          pgConn->binaryResults);
     if ((status = PQresultStatus(rslt)) == PGRES_TUPLES_OK) {
         pgStmt->lastRslt = rslt;
         return createResultSet(&(pgConn->base), stmt, rslt);
@@ -607,26 +893,194 @@ static int WXDBPGSQLRsltSet_ColumnIsNull(WXDBResultSet *rs,
                                                               TRUE : FALSE;
 }
 
+/* Type OIDs for the fixed-size numeric binary representations */
+#define PGSQL_OID_INT8 20
+#define PGSQL_OID_INT2 21
+#define PGSQL_OID_INT4 23
+#define PGSQL_OID_OID 26
+#define PGSQL_OID_FLOAT4 700
+#define PGSQL_OID_FLOAT8 701
+
+/* Assemble the network (big-endian) ordered bits of a binary field */
+static uint64_t binFieldBits(const unsigned char *ptr, int len) {
+    uint64_t val = 0;
+
+    while (len-- > 0) val = (val << 8) | *(ptr++);
+    return val;
+}
+
+/* Typed extraction cores, decoding wire format or falling back to text */
+static long long pgColumnLong(WXPGSQLResultSet *rsltSet, uint32_t colIdx) {
+    PGresult *rslt = rsltSet->rslt;
+    const unsigned char *ptr;
+    uint32_t fbits;
+    uint64_t bits;
+    double dval;
+    float fval;
+
+    if (PQgetisnull(rslt, rsltSet->currentRow, colIdx)) return 0;
+    ptr = (const unsigned char *) PQgetvalue(rslt, rsltSet->currentRow,
+                                             colIdx);
+    if (!PQbinaryTuples(rslt)) return atoll((const char *) ptr);
+
+    bits = binFieldBits(ptr, PQgetlength(rslt, rsltSet->currentRow, colIdx));
+    switch (PQftype(rslt, colIdx)) {
+        case PGSQL_OID_INT2:
+            return (int16_t) bits;
+        case PGSQL_OID_INT4:
+            return (int32_t) bits;
+        case PGSQL_OID_INT8:
+            return (int64_t) bits;
+        case PGSQL_OID_OID:
+            return (uint32_t) bits;
+        case PGSQL_OID_FLOAT4:
+            fbits = (uint32_t) bits;
+            (void) memcpy(&fval, &fbits, sizeof(fval));
+            return (long long) fval;
+        case PGSQL_OID_FLOAT8:
+            (void) memcpy(&dval, &bits, sizeof(dval));
+            return (long long) dval;
+    }
+    return 0;
+}
+static double pgColumnDouble(WXPGSQLResultSet *rsltSet, uint32_t colIdx) {
+    PGresult *rslt = rsltSet->rslt;
+    const unsigned char *ptr;
+    uint32_t fbits;
+    uint64_t bits;
+    double dval;
+    float fval;
+
+    if (PQgetisnull(rslt, rsltSet->currentRow, colIdx)) return 0.0;
+    ptr = (const unsigned char *) PQgetvalue(rslt, rsltSet->currentRow,
+                                             colIdx);
+    if (!PQbinaryTuples(rslt)) return strtod((const char *) ptr, NULL);
+
+    bits = binFieldBits(ptr, PQgetlength(rslt, rsltSet->currentRow, colIdx));
+    switch (PQftype(rslt, colIdx)) {
+        case PGSQL_OID_INT2:
+            return (double) ((int16_t) bits);
+        case PGSQL_OID_INT4:
+            return (double) ((int32_t) bits);
+        case PGSQL_OID_INT8:
+            return (double) ((int64_t) bits);
+        case PGSQL_OID_OID:
+            return (double) ((uint32_t) bits);
+        case PGSQL_OID_FLOAT4:
+            fbits = (uint32_t) bits;
+            (void) memcpy(&fval, &fbits, sizeof(fval));
+            return fval;
+        case PGSQL_OID_FLOAT8:
+            (void) memcpy(&dval, &bits, sizeof(dval));
+            return dval;
+    }
+    return 0.0;
+}
+
 static const char *WXDBPGSQLRsltSet_ColumnData(WXDBResultSet *rs,
                                                uint32_t colIdx) {
     WXPGSQLResultSet *rsltSet = (WXPGSQLResultSet *) rs;
 
     if (colIdx >= rsltSet->columnCount) return NULL;
     if (PQgetisnull(rsltSet->rslt, rsltSet->currentRow, colIdx)) return NULL;
+
+    /* For binary transfers, render numerics for text-based access */
+    if (PQbinaryTuples(rsltSet->rslt)) {
+        switch (PQftype(rsltSet->rslt, colIdx)) {
+            case PGSQL_OID_INT2:
+            case PGSQL_OID_INT4:
+            case PGSQL_OID_INT8:
+            case PGSQL_OID_OID:
+                (void) sprintf(rsltSet->scratch, "%lld",
+                               pgColumnLong(rsltSet, colIdx));
+                return rsltSet->scratch;
+            case PGSQL_OID_FLOAT4:
+            case PGSQL_OID_FLOAT8:
+                (void) sprintf(rsltSet->scratch, "%.17g",
+                               pgColumnDouble(rsltSet, colIdx));
+                return rsltSet->scratch;
+            default:
+                /* Raw wire form, only useful to type-aware callers */
+                break;
+        }
+    }
+
     return PQgetvalue(rsltSet->rslt, rsltSet->currentRow, colIdx);
 }
 
+static int WXDBPGSQLRsltSet_ColumnInt(WXDBResultSet *rs, uint32_t colIdx) {
+    WXPGSQLResultSet *rsltSet = (WXPGSQLResultSet *) rs;
+
+    if (colIdx >= rsltSet->columnCount) return 0;
+    return (int) pgColumnLong(rsltSet, colIdx);
+}
+
+static long long WXDBPGSQLRsltSet_ColumnLong(WXDBResultSet *rs,
+                                             uint32_t colIdx) {
+    WXPGSQLResultSet *rsltSet = (WXPGSQLResultSet *) rs;
+
+    if (colIdx >= rsltSet->columnCount) return 0;
+    return pgColumnLong(rsltSet, colIdx);
+}
+
+static double WXDBPGSQLRsltSet_ColumnDouble(WXDBResultSet *rs,
+                                            uint32_t colIdx) {
+    WXPGSQLResultSet *rsltSet = (WXPGSQLResultSet *) rs;
+
+    if (colIdx >= rsltSet->columnCount) return 0.0;
+    return pgColumnDouble(rsltSet, colIdx);
+}
+
 static int WXDBPGSQLRsltSet_NextRow(WXDBResultSet *rs) {
     WXPGSQLResultSet *rsltSet = (WXPGSQLResultSet *) rs;
+    WXPGSQLConnection *pgConn;
+    PGresult *rslt;
+
+    if (!rsltSet->isStreaming) {
+        rsltSet->currentRow++;
+        return (rsltSet->currentRow < rsltSet->rowCount) ? TRUE : FALSE;
+    }
 
-    rsltSet->currentRow++;
-    return (rsltSet->currentRow < rsltSet->rowCount) ? TRUE : FALSE;
+    /* Streaming, the held result is always the current (single) row */
+    if (rsltSet->currentRow == (uint32_t) -1) {
+        /* First row was fetched at submission time */
+        rsltSet->currentRow = 0;
+        return (rsltSet->streamDone) ? FALSE : TRUE;
+    }
+    if (rsltSet->streamDone) return FALSE;
+
+    /* Release the delivered row and pull the next from the server */
+    pgConn = (WXPGSQLConnection *) rs->parentConn;
+    PQclear(rsltSet->rslt);
+    rsltSet->rslt = NULL;
+    if ((rslt = PQgetResult(pgConn->db)) == NULL) {
+        rsltSet->streamDone = TRUE;
+        return FALSE;
+    }
+    rsltSet->rslt = rslt;
+    if (PQresultStatus(rslt) == PGRES_SINGLE_TUPLE) return TRUE;
+
+    /* Completion (or error) marker, drain any remaining state */
+    rsltSet->streamDone = TRUE;
+    while ((rslt = PQgetResult(pgConn->db)) != NULL) PQclear(rslt);
+    return FALSE;
 }
 
 static void WXDBPGSQLRsltSet_Close(WXDBResultSet *rs) {
     WXPGSQLConnection *conn = (WXPGSQLConnection *) rs->parentConn;
     WXPGSQLStatement *stmt = (WXPGSQLStatement *) rs->parentStmt;
     WXPGSQLResultSet *rsltSet = (WXPGSQLResultSet *) rs;
+    PGresult *rslt;
+
+    if (rsltSet->isStreaming) {
+        /* Drain unconsumed streaming results to free up the connection */
+        if (!rsltSet->streamDone) {
+            while ((rslt = PQgetResult(conn->db)) != NULL) PQclear(rslt);
+        }
+        if (rsltSet->rslt != NULL) PQclear(rsltSet->rslt);
+        WXFree(rsltSet);
+        return;
+    }
 
     if ((conn->lastConnRslt != rsltSet->rslt) &&
             ((stmt == NULL) || (stmt->lastRslt != rsltSet->rslt))) {
@@ -650,15 +1104,22 @@ WXDBDriver _WXDBPGSQLDriver = {
 
     WXDBPGSQLQry_Execute,
     WXDBPGSQLQry_ExecuteQuery,
+    WXDBPGSQLQry_ExecuteStreamQuery,
     WXDBPGSQLQry_RowsModified,
     WXDBPGSQLQry_LastRowId,
 
+    WXDBPGSQLQry_ExecuteQueryAsync,
+    WXDBPGSQLQry_AsyncHandle,
+    WXDBPGSQLQry_AsyncPoll,
+    WXDBPGSQLQry_AsyncResult,
+
     WXDBPGSQLStmt_Prepare,
     WXDBPGSQLStmt_BindInt,
     WXDBPGSQLStmt_BindLong,
     WXDBPGSQLStmt_BindDouble,
     WXDBPGSQLStmt_BindString,
     WXDBPGSQLStmt_Execute,
+    WXDBPGSQLStmt_ExecuteBulk,
     WXDBPGSQLStmt_ExecuteQuery,
     WXDBPGSQLStmt_RowsModified,
     WXDBPGSQLStmt_LastRowId,
@@ -668,6 +1129,9 @@ WXDBDriver _WXDBPGSQLDriver = {
     WXDBPGSQLRsltSet_ColumnName,
     WXDBPGSQLRsltSet_ColumnIsNull,
     WXDBPGSQLRsltSet_ColumnData,
+    WXDBPGSQLRsltSet_ColumnInt,
+    WXDBPGSQLRsltSet_ColumnLong,
+    WXDBPGSQLRsltSet_ColumnDouble,
     WXDBPGSQLRsltSet_NextRow,
     WXDBPGSQLRsltSet_Close
 };
@@ -31,6 +31,51 @@ uint8_t *WXIndent(WXBuffer *buffer, unsigned int indent) {
     return buffer->buffer;
 }
 
+/* Character requires no JSON escape handling (note '/' is escaped here) */
+#define JSON_ESC_PLAIN_CH(ch) \
+    (((unsigned char) (ch) >= 0x20) && (((unsigned char) (ch)) < 0x80) && \
+         ((ch) != '"') && ((ch) != '\\') && ((ch) != '/'))
+
+/* Per-byte condition markers (high bit) for word-parallel scanning */
+#define ESC_WORD_HIGH 0x8080808080808080ULL
+#define ESC_WORD_LOW 0x0101010101010101ULL
+#define ESC_WORD_FILL(ch) (ESC_WORD_LOW * ((unsigned char) (ch)))
+#define ESC_WORD_MATCH(word, ch) \
+    ((((word) ^ ESC_WORD_FILL(ch)) - ESC_WORD_LOW) & \
+         ~((word) ^ ESC_WORD_FILL(ch)) & ESC_WORD_HIGH)
+
+/*
+ * Determine the length of content from the given position that passes
+ * through the JSON escaper untouched, eight bytes per test for the bulk of
+ * the run.  Word access is bounded by the provided length (content is not
+ * assumed to be terminated), the byte-match borrows can only misfire above
+ * an actual match so the trailing byte walk lands on the real boundary.
+ */
+static size_t jsonEscPlainScan(const char *str, size_t len) {
+    const char *ptr = str, *end = str + len;
+    uint64_t word;
+
+    /* Lead in to word alignment */
+    while (((((uintptr_t) ptr) & 7) != 0) && (ptr < end)) {
+        if (!JSON_ESC_PLAIN_CH(*ptr)) return ptr - str;
+        ptr++;
+    }
+
+    /* Full words while they last */
+    while (ptr + 8 <= end) {
+        word = *((const uint64_t *) ptr);
+        if (((word & ESC_WORD_HIGH) |
+                 ((word - ESC_WORD_FILL(0x20)) & ~word & ESC_WORD_HIGH) |
+                 ESC_WORD_MATCH(word, '"') | ESC_WORD_MATCH(word, '\\') |
+                 ESC_WORD_MATCH(word, '/')) != 0) break;
+        ptr += 8;
+    }
+
+    /* And the remainder (or the word that flagged) byte-wise */
+    while ((ptr < end) && JSON_ESC_PLAIN_CH(*ptr)) ptr++;
+    return ptr - str;
+}
+
 /**
  * Escape unsafe JSON character sequences in the provided string.
  *
@@ -48,6 +93,12 @@ uint8_t *WXJSON_EscapeString(WXBuffer *buffer, char *str, int len) {
     if (len < 0) len = strlen(str);
     escBuff[0] = '\\';
     while (len > 0) {
+        /* Hop over the untouched run, the block append picks it up */
+        l = (int) jsonEscPlainScan(str, (size_t) len);
+        str += l;
+        len -= l;
+        if (len <= 0) break;
+
         ch = (unsigned char) *(str++);
         len--;
 
@@ -159,6 +210,38 @@ static uint8_t xmlEscFlags[] = {
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
 };
 
+/*
+ * XML counterpart to the scanner above, determines the length of content
+ * that is untouched by every escaping mode (zero flag entries, which also
+ * covers the upper/multi-byte range).  The word tests mirror the union of
+ * the flagged characters; a flagged stop that turns out to be clean for the
+ * active mode is simply absorbed by the block tracking in the callers.
+ */
+static size_t xmlEscPlainScan(const char *str, size_t len) {
+    const char *ptr = str, *end = str + len;
+    uint64_t word;
+
+    /* Lead in to word alignment */
+    while (((((uintptr_t) ptr) & 7) != 0) && (ptr < end)) {
+        if (xmlEscFlags[(unsigned char) *ptr] != 0) return ptr - str;
+        ptr++;
+    }
+
+    /* Full words while they last */
+    while (ptr + 8 <= end) {
+        word = *((const uint64_t *) ptr);
+        if ((((word - ESC_WORD_FILL(0x20)) & ~word & ESC_WORD_HIGH) |
+                 ESC_WORD_MATCH(word, '&') | ESC_WORD_MATCH(word, '<') |
+                 ESC_WORD_MATCH(word, '>') | ESC_WORD_MATCH(word, '"') |
+                 ESC_WORD_MATCH(word, '\'')) != 0) break;
+        ptr += 8;
+    }
+
+    /* And the remainder (or the word that flagged) byte-wise */
+    while ((ptr < end) && (xmlEscFlags[(unsigned char) *ptr] == 0)) ptr++;
+    return ptr - str;
+}
+
 static uint8_t *xmlEnc(WXBuffer *buffer, unsigned char ch) {
     switch (ch) {
         case '&':
@@ -200,7 +283,17 @@ uint8_t *WXML_EscapeAttribute(WXBuffer *buffer, char *str, int len,
     int l;
 
     if (len < 0) len = strlen(str);
+
+    /* Exact reservation for the (typical) clean case, single growth */
+    if (WXBuffer_EnsureCapacity(buffer, len + 1, TRUE) == NULL) return NULL;
+
     while (len > 0) {
+        /* Hop over the untouched run, the block append picks it up */
+        l = (int) xmlEscPlainScan(str, (size_t) len);
+        str += l;
+        len -= l;
+        if (len <= 0) break;
+
         ch = (unsigned char) *(str++);
         len--;
 
@@ -239,7 +332,17 @@ uint8_t *WXML_EscapeContent(WXBuffer *buffer, char *str, int len,
     int l;
 
     if (len < 0) len = strlen(str);
+
+    /* Exact reservation for the (typical) clean case, single growth */
+    if (WXBuffer_EnsureCapacity(buffer, len + 1, TRUE) == NULL) return NULL;
+
     while (len > 0) {
+        /* Hop over the untouched run, the block append picks it up */
+        l = (int) xmlEscPlainScan(str, (size_t) len);
+        str += l;
+        len -= l;
+        if (len <= 0) break;
+
         ch = (unsigned char) *(str++);
         len--;
 
@@ -292,31 +395,153 @@ static char uriHex[] = { '0', '1', '2', '3', '4', '5', '6', '7',
  * @return Pointer to the buffer contents or NULL on memory error.
  */
 uint8_t *WXURL_EscapeURI(WXBuffer *buffer, char *str, int len) {
+    const unsigned char *ptr, *end;
     unsigned char ch;
-    char *blk = str;
-    int l;
+    uint8_t *dst;
+    size_t cnt;
 
     if (len < 0) len = strlen(str);
-    while (len > 0) {
-        ch = (unsigned char) *(str++);
-        len--;
+    ptr = (const unsigned char *) str;
+    end = ptr + len;
 
-        if (uriEscFlag[ch]) {
-            if ((l = (str - blk) - 1) > 0) {
-                if (WXBuffer_Append(buffer, blk, l, TRUE) == NULL) return NULL;
+    /* First pass sizes the output exactly, flag entries are handily one */
+    cnt = 0;
+    while (ptr + 8 <= end) {
+        cnt += uriEscFlag[ptr[0]] + uriEscFlag[ptr[1]] +
+               uriEscFlag[ptr[2]] + uriEscFlag[ptr[3]] +
+               uriEscFlag[ptr[4]] + uriEscFlag[ptr[5]] +
+               uriEscFlag[ptr[6]] + uriEscFlag[ptr[7]];
+        ptr += 8;
+    }
+    while (ptr < end) cnt += uriEscFlag[*(ptr++)];
+
+    /* Single growth to the escaped length, each flagged byte takes three */
+    if (WXBuffer_EnsureCapacity(buffer, len + 2 * cnt,
+                                TRUE) == NULL) return NULL;
+
+    /* Second pass can then write through without capacity checking */
+    dst = buffer->buffer + buffer->length;
+    ptr = (const unsigned char *) str;
+    if (cnt == 0) {
+        (void) memcpy(dst, ptr, len);
+        dst += len;
+    } else {
+        while (ptr < end) {
+            ch = *(ptr++);
+            if (uriEscFlag[ch]) {
+                *(dst++) = '%';
+                *(dst++) = uriHex[(ch >> 4) & 0x0F];
+                *(dst++) = uriHex[ch & 0x0F];
+            } else {
+                *(dst++) = ch;
             }
-            if (WXBuffer_EnsureCapacity(buffer, 3, TRUE) == NULL) return NULL;
-            buffer->buffer[buffer->length++] = '%';
-            buffer->buffer[buffer->length++] = uriHex[(ch >> 4) & 0x0F];
-            buffer->buffer[buffer->length++] = uriHex[ch & 0x0F];
-            blk = str;
-        } else {
-            /* Just a regular character, track as a block */
         }
     }
-    if ((l = (str - blk)) > 0) {
-        if (WXBuffer_Append(buffer, blk, l, TRUE) == NULL) return NULL;
-    }
+    buffer->length = dst - buffer->buffer;
 
     return buffer->buffer;
 }
+
+/**
+ * Determine the length of the leading pure-ASCII (seven-bit) run in the
+ * provided content, processing multiple bytes per test for long runs.
+ *
+ * @param str Content to be scanned (not presumed to be terminated).
+ * @param len Number of bytes available to scan.
+ * @return Number of leading bytes below 0x80, up to len for a full match.
+ */
+size_t WXUTF8_ScanASCII(const char *str, size_t len) {
+    const char *ptr = str, *end = str + len;
+    const uint64_t *wptr;
+
+    /* Lead in to word alignment */
+    while (((((uintptr_t) ptr) & 7) != 0) && (ptr < end)) {
+        if ((*ptr & 0x80) != 0) return ptr - str;
+        ptr++;
+    }
+
+    /* Biggest strides first, four words at a time while clean */
+    while (ptr + 32 <= end) {
+        wptr = (const uint64_t *) ptr;
+        if (((wptr[0] | wptr[1] | wptr[2] | wptr[3]) & ESC_WORD_HIGH) != 0) {
+            break;
+        }
+        ptr += 32;
+    }
+    while (ptr + 8 <= end) {
+        if ((*((const uint64_t *) ptr) & ESC_WORD_HIGH) != 0) break;
+        ptr += 8;
+    }
+
+    /* And the remainder (or the word that flagged) byte-wise */
+    while ((ptr < end) && ((*ptr & 0x80) == 0)) ptr++;
+    return ptr - str;
+}
+
+/* Trailing byte counts by lead byte value, 9 marks an invalid lead */
+/* (trailers cannot lead, 0xC0/0xC1/0xF5+ only give overlong/high forms) */
+static uint8_t utf8TrailCounts[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9
+};
+
+/**
+ * Validate UTF-8 well-formedness of the provided content, rejecting
+ * overlong encodings, surrogate codepoints and values above U+10FFFF.
+ * ASCII stretches are skipped with the scanner above, only multi-byte
+ * sequences fall through to table-driven inspection.
+ *
+ * @param str Content to be validated (not presumed to be terminated).
+ * @param len Number of bytes available to validate.
+ * @return The number of leading bytes forming complete valid sequences,
+ *         len exactly for fully valid content (a short return marks the
+ *         offset of the offending or truncated sequence).
+ */
+size_t WXUTF8_Validate(const char *str, size_t len) {
+    const uint8_t *ptr = (const uint8_t *) str, *end = ptr + len;
+    uint8_t lead, trail, min, max;
+    unsigned int idx, cnt;
+
+    while (ptr < end) {
+        /* Burst through the ASCII, which is most real-world content */
+        ptr += WXUTF8_ScanASCII((const char *) ptr, end - ptr);
+        if (ptr >= end) break;
+
+        /* Anything else leads (or fails to lead) a multi-byte sequence */
+        lead = *ptr;
+        cnt = utf8TrailCounts[lead];
+        if ((cnt == 9) || (ptr + cnt >= end)) break;
+
+        /* The first trailing byte carries the overlong/range restrictions */
+        min = 0x80; max = 0xBF;
+        if (lead == 0xE0) min = 0xA0;
+        else if (lead == 0xED) max = 0x9F;
+        else if (lead == 0xF0) min = 0x90;
+        else if (lead == 0xF4) max = 0x8F;
+        trail = *(ptr + 1);
+        if ((trail < min) || (trail > max)) break;
+
+        /* Any remaining trailers are simple continuation bytes */
+        for (idx = 2; idx <= cnt; idx++) {
+            if ((*(ptr + idx) & 0xC0) != 0x80) break;
+        }
+        if (idx <= cnt) break;
+        ptr += cnt + 1;
+    }
+
+    return ptr - (const uint8_t *) str;
+}
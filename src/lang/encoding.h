@@ -66,4 +66,28 @@ uint8_t *WXML_EscapeContent(WXBuffer *buffer, char *str, int len,
  */
 uint8_t *WXURL_EscapeURI(WXBuffer *buffer, char *str, int len);
 
+/**
+ * Determine the length of the leading pure-ASCII (seven-bit) run in the
+ * provided content, processing multiple bytes per test for long runs.
+ *
+ * @param str Content to be scanned (not presumed to be terminated).
+ * @param len Number of bytes available to scan.
+ * @return Number of leading bytes below 0x80, up to len for a full match.
+ */
+size_t WXUTF8_ScanASCII(const char *str, size_t len);
+
+/**
+ * Validate UTF-8 well-formedness of the provided content, rejecting
+ * overlong encodings, surrogate codepoints and values above U+10FFFF.
+ * ASCII stretches are skipped with the scanner above, only multi-byte
+ * sequences fall through to table-driven inspection.
+ *
+ * @param str Content to be validated (not presumed to be terminated).
+ * @param len Number of bytes available to validate.
+ * @return The number of leading bytes forming complete valid sequences,
+ *         len exactly for fully valid content (a short return marks the
+ *         offset of the offending or truncated sequence).
+ */
+size_t WXUTF8_Validate(const char *str, size_t len);
+
 #endif
@@ -74,6 +74,55 @@ void WXJSONLexerInit(WXJSONLexer *lexer, const char *content) {
 #define WAS_VALUE() \
     ((lexer->lastToken.type & WXJSONTK_VALUE) == WXJSONTK_VALUE)
 
+/* Plain string bytes need no unescaping or validation attention below */
+#define WXJSON_PLAIN_STR_CH(ch) \
+    (((unsigned char) (ch) >= 0x20) && (((unsigned char) (ch)) < 0x80) && \
+         ((ch) != '"') && ((ch) != '\\'))
+
+/* Word-parallel detectors, high bit flags per-byte conditions */
+#define WXJSON_WORD_HIGH 0x8080808080808080ULL
+#define WXJSON_WORD_LOW 0x0101010101010101ULL
+#define WXJSON_WORD_FILL(ch) (WXJSON_WORD_LOW * ((unsigned char) (ch)))
+#define WXJSON_WORD_MATCH(word, ch) \
+    ((((word) ^ WXJSON_WORD_FILL(ch)) - WXJSON_WORD_LOW) & \
+         ~((word) ^ WXJSON_WORD_FILL(ch)) & WXJSON_WORD_HIGH)
+
+/*
+ * Measure the run of plain string content (no quote, escape, control or
+ * high/multi-byte characters) from the given position, a word at a time
+ * where possible.  Aligned word reads cannot cross a page boundary and the
+ * terminating NUL always stops the scan, so this cannot overrun the
+ * document content.  Match detection can only false-positive in bytes above
+ * a genuine hit in the same word, which the per-byte tail walk absorbs.
+ */
+static size_t WXJSONPlainStrScan(const char *str) {
+    const char *ptr = str;
+    const uint64_t *wptr;
+    uint64_t word;
+
+    /* Walk up to the word boundary, bailing on any byte of interest */
+    while ((((uintptr_t) ptr) & 7) != 0) {
+        if (!WXJSON_PLAIN_STR_CH(*ptr)) return ptr - str;
+        ptr++;
+    }
+
+    /* Word-at-a-time for the body of the run */
+    wptr = (const uint64_t *) ptr;
+    while (TRUE) {
+        word = *wptr;
+        if (((word & WXJSON_WORD_HIGH) |
+                 ((word - WXJSON_WORD_FILL(0x20)) & ~word & WXJSON_WORD_HIGH) |
+                 WXJSON_WORD_MATCH(word, '"') |
+                 WXJSON_WORD_MATCH(word, '\\')) != 0) break;
+        wptr++;
+    }
+
+    /* Close out to the specific byte in the final word */
+    ptr = (const char *) wptr;
+    while (WXJSON_PLAIN_STR_CH(*ptr)) ptr++;
+    return ptr - str;
+}
+
 /**
  * Internal method (except for testing) to obtain the next token from the
  * lexer.
@@ -87,6 +136,7 @@ WXJSONToken *WXJSONLexerNext(WXJSONLexer *lexer) {
     uint8_t strBufferData[1024], utf[4];
     unsigned int idx, uchr, ucnt;
     WXBuffer strBuffer;
+    size_t runLen;
 
     /* Flush prior content */
     (void) memset(&lexer->lastToken.value, 0, sizeof(lexer->lastToken.value));
@@ -214,7 +264,20 @@ WXJSONToken *WXJSONLexerNext(WXJSONLexer *lexer) {
 
                 WXBuffer_InitLocal(&strBuffer, strBufferData,
                                    sizeof(strBufferData));
-                while ((ch = *(ptr++)) != '"') {
+                while (TRUE) {
+                    /* Bulk-append the plain run up to the next point of
+                     * interest, only escapes/errors go byte-by-byte */
+                    runLen = WXJSONPlainStrScan(ptr);
+                    if (runLen != 0) {
+                        if (WXBuffer_Append(&strBuffer, (uint8_t *) ptr,
+                                            runLen, TRUE) == NULL) {
+                            WXBuffer_Destroy(&strBuffer);
+                            RETURN_ERROR(WXJSONERR_ALLOC_FAILURE);
+                        }
+                        ptr += runLen;
+                    }
+
+                    if ((ch = *(ptr++)) == '"') break;
                     if (ch == '\\') {
                         switch (ch = *(ptr++)) {
                             case '"':
@@ -601,6 +664,7 @@ WXJSONValue *WXJSON_Decode(const char *content) {
     /* Prepare for parsing and return */
     retval = (WXJSONValue *) WXMalloc(sizeof(WXJSONValue));
     if (retval == NULL) return NULL;
+    (void) memset(retval, 0, sizeof(WXJSONValue));
     WXJSONLexerInit(&lexer, content);
 
     /* And away we go! */
@@ -628,6 +692,493 @@ WXJSONValue *WXJSON_Decode(const char *content) {
     return retval;
 }
 
+/* Standard underlying block size for arena-based parsing (see below) */
+#define WXJSON_ARENA_BLOCK_SIZE 8192
+
+/*
+ * Transfer an allocated (heap) string from the lexer into the arena.  The
+ * original is always released, returns NULL on allocation failure.
+ */
+static char *WXJSON_ArenaStrDup(WXArena *arena, char *str) {
+    size_t len = strlen(str) + 1;
+    char *copy = (char *) WXArena_Alloc(arena, len);
+
+    if (copy != NULL) (void) memcpy(copy, str, len);
+    WXFree(str);
+    return copy;
+}
+
+/*
+ * Arena-based counterpart to the parse method above.  Identical grammar
+ * handling, but all retained content is drawn from the arena and the
+ * container backing storage is sealed (relocated) into the arena once each
+ * container completes.  Error cleanup therefore only needs to release the
+ * in-progress container storage at each level, everything else belongs to
+ * the arena.
+ */
+static WXJSONErrorCode WXJSON_ParseArenaValue(WXJSONLexer *lexer,
+                                              WXJSONValue *value,
+                                              WXArena *arena,
+                                              int allowArrayClosure) {
+    WXJSONValue inner, *propVal, *dupVal;
+    char *propName = NULL, *dupName;
+    WXJSONToken *token;
+    size_t storageSize;
+    void *storage;
+    int rc;
+
+    /* Grab next token and check for validation from lexer */
+    token = WXJSONLexerNext(lexer);
+    if (token->type == WXJSONTK_ERROR) {
+        value->type = WXJSONVALUE_ERROR;
+        return token->value.errorCode;
+    }
+
+    /* Translate value tokens appropriately */
+    (void) memset(value, 0, sizeof(WXJSONValue));
+    switch (token->type) {
+        case WXJSONTK_VALUE_TRUE:
+            value->type = WXJSONVALUE_TRUE;
+            break;
+
+        case WXJSONTK_VALUE_FALSE:
+            value->type = WXJSONVALUE_FALSE;
+            break;
+
+        case WXJSONTK_VALUE_NULL:
+            value->type = WXJSONVALUE_NULL;
+            break;
+
+        case WXJSONTK_VALUE_INT:
+            value->type = WXJSONVALUE_INT;
+            value->value.ival = token->value.ival;
+            break;
+
+        case WXJSONTK_VALUE_DBL:
+            value->type = WXJSONVALUE_DOUBLE;
+            value->value.dval = token->value.dval;
+            break;
+
+        case WXJSONTK_VALUE_STR:
+            value->type = WXJSONVALUE_STRING;
+            value->value.sval = WXJSON_ArenaStrDup(arena, token->value.sval);
+            if (value->value.sval == NULL) return WXJSONERR_ALLOC_FAILURE;
+            break;
+
+        case WXJSONTK_OBJ_START:
+            /* Recursive iteration over object content */
+            value->type = WXJSONVALUE_OBJECT;
+            (void) WXHash_InitTable(&(value->value.oval), 0);
+            while (lexer->lastToken.type != WXJSONTK_EOF) {
+                /* Need an object property */
+                token = WXJSONLexerNext(lexer);
+                if (token->type == WXJSONTK_VALUE_STR) {
+                    propName = WXJSON_ArenaStrDup(arena, token->value.sval);
+                    if (propName == NULL) {
+                        WXHash_Destroy(&(value->value.oval));
+                        return WXJSONERR_ALLOC_FAILURE;
+                    }
+                } else if ((token->type == WXJSONTK_VALUE_OBJ_END) &&
+                               (value->value.oval.entryCount == 0)) {
+                    /* Empty object... */
+                    break;
+                } else {
+                    WXJSONLexerDiscard(token);
+                    WXHash_Destroy(&(value->value.oval));
+                    return (token->type == WXJSONTK_ERROR) ?
+                        token->value.errorCode : WXJSONERR_MISSING_PROPERTY;
+                }
+
+                /* And a colon */
+                token = WXJSONLexerNext(lexer);
+                if (token->type == WXJSONTK_COLON) {
+                    /* Do nothing, just moving along */
+                } else {
+                    WXJSONLexerDiscard(token);
+                    WXHash_Destroy(&(value->value.oval));
+                    return (token->type == WXJSONTK_ERROR) ?
+                        token->value.errorCode : WXJSONERR_MISSING_COLON;
+                }
+
+                /* Next a value, once we have that, push to hashtable */
+                propVal = (WXJSONValue *) WXArena_Alloc(arena,
+                                                        sizeof(WXJSONValue));
+                if (propVal == NULL) {
+                    WXHash_Destroy(&(value->value.oval));
+                    return WXJSONERR_ALLOC_FAILURE;
+                }
+                rc = WXJSON_ParseArenaValue(lexer, propVal, arena, FALSE);
+                if (rc != WXJSONERR_NONE_OK) {
+                    WXHash_Destroy(&(value->value.oval));
+                    return rc;
+                }
+                if (!WXHash_PutEntry(&(value->value.oval), propName, propVal,
+                                     (void **) &dupName, (void **) &dupVal,
+                                     WXHash_StrHashFn, WXHash_StrEqualsFn)) {
+                    WXHash_Destroy(&(value->value.oval));
+                    return WXJSONERR_ALLOC_FAILURE;
+                }
+
+                /* Duplicate/overlaid properties just wait for arena release */
+
+                /* Finally a comma or end of object */
+                token = WXJSONLexerNext(lexer);
+                if (token->type == WXJSONTK_COMMA) {
+                    /* Do nothing, just moving along */
+                } else if (token->type == WXJSONTK_VALUE_OBJ_END) {
+                    /* Object is complete, exit loop */
+                    break;
+                } else {
+                    WXHash_Destroy(&(value->value.oval));
+                    return (token->type == WXJSONTK_ERROR) ?
+                        token->value.errorCode : WXJSONERR_OBJECT_CONTINUE;
+                }
+            }
+
+            /* Seal the entry storage into the arena, single release point */
+            storageSize = WXHash_EntryStorageSize(&(value->value.oval));
+            if (storageSize != 0) {
+                storage = WXArena_Alloc(arena, storageSize);
+                if (storage == NULL) {
+                    WXHash_Destroy(&(value->value.oval));
+                    return WXJSONERR_ALLOC_FAILURE;
+                }
+                WXHash_RelocateEntryStorage(&(value->value.oval), storage);
+            }
+            break;
+
+        case WXJSONTK_ARR_START:
+            /* Recursive iteration over array content */
+            value->type = WXJSONVALUE_ARRAY;
+            (void) WXArray_Init(&(value->value.aval), WXJSONValue, 0);
+            while (lexer->lastToken.type != WXJSONTK_EOF) {
+                /* Value must be first, get it and add to array */
+                rc = WXJSON_ParseArenaValue(lexer, &inner, arena, TRUE);
+                if (rc != WXJSONERR_NONE_OK) {
+                    WXArray_Destroy(&(value->value.aval));
+                    return rc;
+                }
+                if (inner.type == WXJSONVALUE_NONE) {
+                    /* Empty array instance */
+                    break;
+                }
+                if (WXArray_Push(&(value->value.aval), &inner) == NULL) {
+                    WXArray_Destroy(&(value->value.aval));
+                    return WXJSONERR_ALLOC_FAILURE;
+                }
+
+                /* Followed by a comma or end of array */
+                token = WXJSONLexerNext(lexer);
+                if (token->type == WXJSONTK_COMMA) {
+                    /* Do nothing, just moving along */
+                } else if (token->type == WXJSONTK_VALUE_ARR_END) {
+                    /* Array is complete, exit loop */
+                    break;
+                } else {
+                    WXArray_Destroy(&(value->value.aval));
+                    return (token->type == WXJSONTK_ERROR) ?
+                        token->value.errorCode : WXJSONERR_ARRAY_CONTINUE;
+                }
+            }
+
+            /* Seal content into the arena, local marking prevents release */
+            if (value->value.aval.length != 0) {
+                storageSize = value->value.aval.length * sizeof(WXJSONValue);
+                storage = WXArena_Alloc(arena, storageSize);
+                if (storage == NULL) {
+                    WXArray_Destroy(&(value->value.aval));
+                    return WXJSONERR_ALLOC_FAILURE;
+                }
+                (void) memcpy(storage, value->value.aval.array, storageSize);
+                WXFree(value->value.aval.array);
+                value->value.aval.array = storage;
+                value->value.aval.allocLength =
+                                 -((ssize_t) value->value.aval.length);
+            }
+            break;
+
+        case WXJSONTK_VALUE_ARR_END:
+            /* Special bypass for empty array */
+            if (allowArrayClosure) {
+                value->type = WXJSONVALUE_NONE;
+                break;
+            }
+            return WXJSONERR_INVALID_VALUE;
+
+        default:
+            /* Lexer should capture these but just in case */
+            return WXJSONERR_INVALID_VALUE;
+    }
+
+    return WXJSONERR_NONE_OK;
+}
+
+/**
+ * Identical in contract to the decode method above, except that all of the
+ * parsing allocations (values, strings and container storage) are drawn from
+ * a single growable arena owned by the root value, so that the destroy method
+ * releases the entire tree in one pass instead of walking it.  Intended for
+ * the (dominant) parse-then-discard usage pattern - the resulting tree is
+ * fully readable (find/encode/bind) but must not be structurally modified,
+ * as container growth and entry removal assume discretely allocated content.
+ *
+ * @param content The JSON document/content to be parsed.
+ * @return The root value of the JSON data, note that this contains an error
+ *         item for any parsing error.  NULL for memory failure.
+ */
+WXJSONValue *WXJSON_DecodeArena(const char *content) {
+    WXJSONValue *retval;
+    WXJSONToken *token;
+    WXJSONLexer lexer;
+    WXArena *arena;
+    int rc;
+
+    /* Arena header plus the root value are the first carves */
+    arena = (WXArena *) WXMalloc(sizeof(WXArena));
+    if (arena == NULL) return NULL;
+    if (!WXArena_Init(arena, WXJSON_ARENA_BLOCK_SIZE)) {
+        WXFree(arena);
+        return NULL;
+    }
+    retval = (WXJSONValue *) WXArena_Alloc(arena, sizeof(WXJSONValue));
+    if (retval == NULL) {
+        WXArena_Destroy(arena);
+        WXFree(arena);
+        return NULL;
+    }
+    (void) memset(retval, 0, sizeof(WXJSONValue));
+    WXJSONLexerInit(&lexer, content);
+
+    /* And away we go! */
+    rc = WXJSON_ParseArenaValue(&lexer, retval, arena, FALSE);
+    if (rc == WXJSONERR_NONE_OK) {
+        /* There can be only one */
+        token = WXJSONLexerNext(&lexer);
+        if (token->type != WXJSONTK_EOF) {
+            rc = (token->type == WXJSONTK_ERROR) ?
+                           token->value.errorCode : WXJSONERR_NONSINGULAR_ROOT;
+            WXJSONLexerDiscard(token);
+        }
+    }
+    if (rc != WXJSONERR_NONE_OK) {
+        /* Parsed content is just left for the arena release */
+        retval->type = WXJSONVALUE_ERROR;
+        retval->value.error.errorCode = rc;
+        retval->value.error.lineNumber = lexer.lineNumber;
+    }
+
+    retval->arena = arena;
+    WXJSONLexerDestroy(&lexer);
+    return retval;
+}
+
+/* Internal halt indicator for the streaming parser, outside the error enum */
+#define WXJSON_STREAM_HALT -1
+
+/*
+ * Streaming counterpart to the parse method above, dispatching events in
+ * document order instead of accumulating values.  Same recursion pattern,
+ * same lexer.  Returns 0 (WXJSONERR_NONE_OK) if successful, error code or
+ * the halt indicator otherwise.
+ */
+static int WXJSON_StreamValue(WXJSONLexer *lexer, WXJSONEventHandler handler,
+                              void *userData, const char *name,
+                              unsigned int depth, int allowArrayClosure,
+                              int *closedRef) {
+    int rc, isFirst, closed;
+    WXJSONToken *token;
+    WXJSONEvent event;
+    char *propName;
+
+    if (closedRef != NULL) *closedRef = FALSE;
+
+    /* Grab next token and check for validation from lexer */
+    token = WXJSONLexerNext(lexer);
+    if (token->type == WXJSONTK_ERROR) return token->value.errorCode;
+
+    /* Common elements of any event issued at this level */
+    (void) memset(&event, 0, sizeof(event));
+    event.name = name;
+    event.depth = depth;
+    event.value.type = WXJSONVALUE_NONE;
+
+    switch (token->type) {
+        case WXJSONTK_VALUE_TRUE:
+            event.type = WXJSONEVT_SCALAR;
+            event.value.type = WXJSONVALUE_TRUE;
+            break;
+
+        case WXJSONTK_VALUE_FALSE:
+            event.type = WXJSONEVT_SCALAR;
+            event.value.type = WXJSONVALUE_FALSE;
+            break;
+
+        case WXJSONTK_VALUE_NULL:
+            event.type = WXJSONEVT_SCALAR;
+            event.value.type = WXJSONVALUE_NULL;
+            break;
+
+        case WXJSONTK_VALUE_INT:
+            event.type = WXJSONEVT_SCALAR;
+            event.value.type = WXJSONVALUE_INT;
+            event.value.value.ival = token->value.ival;
+            break;
+
+        case WXJSONTK_VALUE_DBL:
+            event.type = WXJSONEVT_SCALAR;
+            event.value.type = WXJSONVALUE_DOUBLE;
+            event.value.value.dval = token->value.dval;
+            break;
+
+        case WXJSONTK_VALUE_STR:
+            /* String staging is released on callback return, copy to keep */
+            event.type = WXJSONEVT_SCALAR;
+            event.value.type = WXJSONVALUE_STRING;
+            event.value.value.sval = token->value.sval;
+            rc = (*handler)(&event, userData) ? WXJSONERR_NONE_OK :
+                                                WXJSON_STREAM_HALT;
+            WXFree(token->value.sval);
+            return rc;
+
+        case WXJSONTK_OBJ_START:
+            /* Recursive iteration over object content */
+            event.type = WXJSONEVT_OBJECT_START;
+            if (!(*handler)(&event, userData)) return WXJSON_STREAM_HALT;
+            isFirst = TRUE;
+            while (lexer->lastToken.type != WXJSONTK_EOF) {
+                /* Need an object property */
+                token = WXJSONLexerNext(lexer);
+                if (token->type == WXJSONTK_VALUE_STR) {
+                    propName = token->value.sval;
+                } else if ((token->type == WXJSONTK_VALUE_OBJ_END) &&
+                               isFirst) {
+                    /* Empty object... */
+                    break;
+                } else {
+                    WXJSONLexerDiscard(token);
+                    return (token->type == WXJSONTK_ERROR) ?
+                        token->value.errorCode : WXJSONERR_MISSING_PROPERTY;
+                }
+                isFirst = FALSE;
+
+                /* And a colon */
+                token = WXJSONLexerNext(lexer);
+                if (token->type != WXJSONTK_COLON) {
+                    WXFree(propName);
+                    WXJSONLexerDiscard(token);
+                    return (token->type == WXJSONTK_ERROR) ?
+                        token->value.errorCode : WXJSONERR_MISSING_COLON;
+                }
+
+                /* Next a value, delivered with the property name attached */
+                rc = WXJSON_StreamValue(lexer, handler, userData, propName,
+                                        depth + 1, FALSE, NULL);
+                WXFree(propName);
+                if (rc != WXJSONERR_NONE_OK) return rc;
+
+                /* Finally a comma or end of object */
+                token = WXJSONLexerNext(lexer);
+                if (token->type == WXJSONTK_COMMA) {
+                    /* Do nothing, just moving along */
+                } else if (token->type == WXJSONTK_VALUE_OBJ_END) {
+                    /* Object is complete, exit loop */
+                    break;
+                } else {
+                    return (token->type == WXJSONTK_ERROR) ?
+                        token->value.errorCode : WXJSONERR_OBJECT_CONTINUE;
+                }
+            }
+            event.type = WXJSONEVT_OBJECT_END;
+            if (!(*handler)(&event, userData)) return WXJSON_STREAM_HALT;
+            return WXJSONERR_NONE_OK;
+
+        case WXJSONTK_ARR_START:
+            /* Recursive iteration over array content */
+            event.type = WXJSONEVT_ARRAY_START;
+            if (!(*handler)(&event, userData)) return WXJSON_STREAM_HALT;
+            while (lexer->lastToken.type != WXJSONTK_EOF) {
+                /* Value must be first (closure indicates empty array) */
+                rc = WXJSON_StreamValue(lexer, handler, userData, NULL,
+                                        depth + 1, TRUE, &closed);
+                if (rc != WXJSONERR_NONE_OK) return rc;
+                if (closed) break;
+
+                /* Followed by a comma or end of array */
+                token = WXJSONLexerNext(lexer);
+                if (token->type == WXJSONTK_COMMA) {
+                    /* Do nothing, just moving along */
+                } else if (token->type == WXJSONTK_VALUE_ARR_END) {
+                    /* Array is complete, exit loop */
+                    break;
+                } else {
+                    return (token->type == WXJSONTK_ERROR) ?
+                        token->value.errorCode : WXJSONERR_ARRAY_CONTINUE;
+                }
+            }
+            event.type = WXJSONEVT_ARRAY_END;
+            if (!(*handler)(&event, userData)) return WXJSON_STREAM_HALT;
+            return WXJSONERR_NONE_OK;
+
+        case WXJSONTK_VALUE_ARR_END:
+            /* Special bypass for empty array */
+            if (allowArrayClosure) {
+                if (closedRef != NULL) *closedRef = TRUE;
+                return WXJSONERR_NONE_OK;
+            }
+            return WXJSONERR_INVALID_VALUE;
+
+        default:
+            /* Lexer should capture these but just in case */
+            return WXJSONERR_INVALID_VALUE;
+    }
+
+    /* Fallthrough dispatch for the unallocated scalar cases */
+    return ((*handler)(&event, userData)) ? WXJSONERR_NONE_OK :
+                                            WXJSON_STREAM_HALT;
+}
+
+/**
+ * Streaming counterpart to the decode method, delivering parse events
+ * through a callback instead of materializing a full data value tree.
+ * Aside from the transient staging of individual string values, parsing
+ * runs in constant memory regardless of the document size, for extracting
+ * selected content from very large documents.
+ *
+ * @param content The JSON document/content to be parsed.
+ * @param handler Callback method to deliver parsing events to.
+ * @param userData Opaque data element passed through to the callback.
+ * @param lineNumberRef If non-NULL, returns the line number at which parsing
+ *                      ended (for error reporting).
+ * @return WXJSONERR_NONE_OK on successful or callback-halted parsing,
+ *         otherwise the associated parse/allocation error code.
+ */
+WXJSONErrorCode WXJSON_DecodeStream(const char *content,
+                                    WXJSONEventHandler handler, void *userData,
+                                    unsigned int *lineNumberRef) {
+    WXJSONToken *token;
+    WXJSONLexer lexer;
+    int rc;
+
+    WXJSONLexerInit(&lexer, content);
+    rc = WXJSON_StreamValue(&lexer, handler, userData, NULL, 0, FALSE, NULL);
+    if (rc == WXJSON_STREAM_HALT) {
+        /* Caller got what they came for, halt is not an error */
+        rc = WXJSONERR_NONE_OK;
+    } else if (rc == WXJSONERR_NONE_OK) {
+        /* There can be only one */
+        token = WXJSONLexerNext(&lexer);
+        if (token->type != WXJSONTK_EOF) {
+            rc = (token->type == WXJSONTK_ERROR) ?
+                token->value.errorCode : WXJSONERR_NONSINGULAR_ROOT;
+            WXJSONLexerDiscard(token);
+        }
+    }
+
+    if (lineNumberRef != NULL) *lineNumberRef = lexer.lineNumber;
+    WXJSONLexerDestroy(&lexer);
+    return (WXJSONErrorCode) rc;
+}
+
 /* Tracking element for separator handling */
 typedef struct {
     WXBuffer *buffer;
@@ -772,17 +1323,223 @@ char *WXJSON_Encode(WXBuffer *buffer, WXJSONValue *value, int prettyPrint) {
     return (char *) buffer->buffer;
 }
 
+/* Tracking state for the streaming (sink-based) encoder */
+typedef struct {
+    WXBuffer buffer;
+    size_t watermark;
+    WXJSONEncodeSink sink;
+    void *userData;
+    int prettyPrint;
+} WXJSONSinkEncodeTracker;
+
+/* Hand the staged encoding content off through the sink */
+static int _sinkDrain(WXJSONSinkEncodeTracker *strk) {
+    if (strk->buffer.length == 0) return 0;
+    if ((*(strk->sink))(strk->buffer.buffer, strk->buffer.length,
+                        strk->userData) < 0) return -1;
+    WXBuffer_Empty(&(strk->buffer));
+    return 0;
+}
+
+/* But only once the staged content crosses the watermark */
+static int _sinkDrainCheck(WXJSONSinkEncodeTracker *strk) {
+    if (strk->buffer.length < strk->watermark) return 0;
+    return _sinkDrain(strk);
+}
+
+/* Streaming equivalent of the list tracker, carries the sink state */
+typedef struct {
+    WXJSONSinkEncodeTracker *strk;
+    int isFirstElement, indent;
+} WXJSONSinkListTracker;
+
+/* Forward declaration for nested looping */
+static int WXJSON_SinkEncodeValue(WXJSONSinkEncodeTracker *strk,
+                                  WXJSONValue *value, int indent);
+
+/* Scanners for streaming complex values, draining between elements */
+static int _objectSinkScanner(WXHashTable *table, void *key, void *object,
+                              void *userData) {
+    WXJSONSinkListTracker *trk = (WXJSONSinkListTracker *) userData;
+    WXJSONSinkEncodeTracker *strk = trk->strk;
+    WXBuffer *buffer = &(strk->buffer);
+
+    if (!trk->isFirstElement) {
+        if (WXBuffer_Append(buffer, ",", 1, TRUE) == NULL) return -1;
+        if (strk->prettyPrint) {
+            if (WXBuffer_Append(buffer, "\n", 1, TRUE) == NULL) return -1;
+        }
+    }
+    trk->isFirstElement = FALSE;
+
+    if (strk->prettyPrint) {
+        if (WXIndent(buffer, trk->indent * 4) == NULL) return -1;
+    }
+    if (_escapeJSONString(buffer, (char *) key) == NULL) return -1;
+    if (strk->prettyPrint) {
+        if (WXBuffer_Append(buffer, ": ", 2, TRUE) == NULL) return -1;
+    } else {
+        if (WXBuffer_Append(buffer, ":", 1, TRUE) == NULL) return -1;
+    }
+
+    if (WXJSON_SinkEncodeValue(strk, (WXJSONValue *) object,
+                               trk->indent) < 0) return -1;
+
+    /* Member boundary, hand off a full watermark block if staged */
+    return _sinkDrainCheck(strk);
+}
+static int _arraySinkScanner(WXArray *array, void *object, void *userData) {
+    WXJSONSinkListTracker *trk = (WXJSONSinkListTracker *) userData;
+    WXJSONSinkEncodeTracker *strk = trk->strk;
+    WXBuffer *buffer = &(strk->buffer);
+
+    if (!trk->isFirstElement) {
+        if (strk->prettyPrint) {
+            if (WXBuffer_Append(buffer, ", ", 2, TRUE) == NULL) return -1;
+        } else {
+            if (WXBuffer_Append(buffer, ",", 1, TRUE) == NULL) return -1;
+        }
+    }
+    trk->isFirstElement = FALSE;
+
+    if (WXJSON_SinkEncodeValue(strk, (WXJSONValue *) object,
+                               trk->indent) < 0) return -1;
+
+    /* Element boundary, hand off a full watermark block if staged */
+    return _sinkDrainCheck(strk);
+}
+
+static int WXJSON_SinkEncodeValue(WXJSONSinkEncodeTracker *strk,
+                                  WXJSONValue *value, int indent) {
+    WXBuffer *buffer = &(strk->buffer);
+    WXJSONSinkListTracker trk;
+
+    /* Common preparation for nested iteration processing */
+    trk.strk = strk;
+    trk.isFirstElement = TRUE;
+    trk.indent = indent + 1;
+
+    switch (value->type) {
+        case WXJSONVALUE_OBJECT:
+            if (WXBuffer_Append(buffer, "{", 1, TRUE) == NULL) return -1;
+            if (strk->prettyPrint && (value->value.oval.entryCount != 0)) {
+                if (WXBuffer_Append(buffer, "\n", 1, TRUE) == NULL) return -1;
+            }
+            if (WXHash_Scan(&(value->value.oval), _objectSinkScanner,
+                            &trk) != 0) return -1;
+            if (strk->prettyPrint && (value->value.oval.entryCount != 0)) {
+                if (WXBuffer_Append(buffer, "\n", 1, TRUE) == NULL) return -1;
+                if (WXIndent(buffer, indent * 4) == NULL) return -1;
+            }
+            if (WXBuffer_Append(buffer, "}", 1, TRUE) == NULL) return -1;
+            break;
+        case WXJSONVALUE_ARRAY:
+            if (WXBuffer_Append(buffer, "[", 1, TRUE) == NULL) return -1;
+            if (WXArray_Scan(&(value->value.aval), _arraySinkScanner,
+                             &trk) != 0) return -1;
+            if (WXBuffer_Append(buffer, "]", 1, TRUE) == NULL) return -1;
+            break;
+        default:
+            /* Leaf values are bounded, stage through the standard encoder */
+            if (WXJSON_EncodeValue(buffer, value, strk->prettyPrint,
+                                   indent) < 0) return -1;
+            break;
+    }
+
+    return 0;
+}
+
+/**
+ * Streaming form of the above, incrementally encoding the JSON data content
+ * through the provided sink instead of accumulating the entire document.
+ * Staged content is handed to the sink whenever it crosses the watermark (at
+ * element boundaries), so encoding proceeds in bounded memory and overlaps
+ * with transmission for sinks that write to the network (for example, the
+ * WXSockStream_SinkWrite adapter in the network streaming toolkit).  Note
+ * that the streamed content is not null-terminated (unlike WXJSON_Encode).
+ *
+ * @param value The root JSON value to be encoded.
+ * @param prettyPrint If TRUE (non-zero), pretty-print the JSON output,
+ *                    otherwise (false/zero) output in compact format.
+ * @param watermark Staging threshold (in bytes) at which accumulated content
+ *                  is pushed through the sink.  Zero for a suitable default.
+ * @param sink Callback to receive the encoded content segments, in order.
+ * @param userData Opaque data reference passed to each sink callback.
+ * @return TRUE if the encoding completed, FALSE on a memory allocation
+ *         failure or a sink error (per the sink return value).
+ */
+int WXJSON_EncodeToSink(WXJSONValue *value, int prettyPrint, size_t watermark,
+                        WXJSONEncodeSink sink, void *userData) {
+    WXJSONSinkEncodeTracker strk;
+    int rc;
+
+    if (watermark == 0) watermark = 8192;
+    strk.watermark = watermark;
+    strk.sink = sink;
+    strk.userData = userData;
+    strk.prettyPrint = prettyPrint;
+
+    /* Headroom so a leaf landing near the watermark rarely reallocates */
+    if (WXBuffer_Init(&(strk.buffer), watermark + 1024) == NULL) return FALSE;
+
+    rc = WXJSON_SinkEncodeValue(&strk, value, 0);
+    if (rc == 0) rc = _sinkDrain(&strk);
+    WXBuffer_Destroy(&(strk.buffer));
+
+    return (rc < 0) ? FALSE : TRUE;
+}
+
 /**
  * Destroy/release the contents of the provided data value (and all nested
  * values).  This method will also free the value itself (consistent with
- * the allocated return from the parse method).
+ * the allocated return from the parse method).  For arena-backed trees
+ * (per WXJSON_DecodeArena), this is a single release of the storage chain.
  *
  * @param value The value to be destroyed/freed.
  */
 void WXJSON_Destroy(WXJSONValue *value) {
+    /* The entire tree (including this root) lives in the arena */
+    if (value->arena != NULL) {
+        WXArena *arena = value->arena;
+        WXArena_Destroy(arena);
+        WXFree(arena);
+        return;
+    }
+
     _WXJSON_Destroy(value, TRUE);
 }
 
+/* Pre-split, pre-hashed element of a compiled path or binding name */
+typedef struct {
+    const char *name;
+    unsigned int hashCode;
+} WXJSONPathSegment;
+
+/* Compiled path instance, segment/name storage trails the allocation */
+struct WXJSONPath {
+    unsigned int segmentCount;
+    WXJSONPathSegment *segments;
+};
+
+/* Shared hashed descent for the compiled path and binding evaluators */
+static WXJSONValue *WXJSON_DescendPath(WXJSONValue *val,
+                                       WXJSONPathSegment *segment,
+                                       unsigned int segmentCount) {
+    unsigned int idx;
+
+    for (idx = 0; idx < segmentCount; idx++, segment++) {
+        /* Looking for the child of a non-object is (still) a fail... */
+        if (val->type != WXJSONVALUE_OBJECT) return NULL;
+        val = (WXJSONValue *) WXHash_GetHashedEntry(&(val->value.oval),
+                                                    (void *) segment->name,
+                                                    segment->hashCode,
+                                                    WXHash_StrEqualsFn);
+        if (val == NULL) return NULL;
+    }
+
+    return val;
+}
+
 /**
  * Quick utility method to locate a JSON value entry based on a fully qualified
  * child node name.  Cannot (currently) cross array boundaries...
@@ -823,6 +1580,70 @@ WXJSONValue *WXJSON_Find(WXJSONValue *root, const char *childName) {
     return NULL;
 }
 
+/**
+ * Compile a fully qualified (period-delimited) child node name into a
+ * reusable path instance, with the name segments pre-split and hashed.  For
+ * paths evaluated against every message (e.g. routing), this reduces the
+ * per-evaluation cost to the hash probes themselves.  Unlike the find
+ * method above, compiled names are not subject to a length limit.
+ *
+ * @param spec Fully qualified (period-delimited) name of the child node the
+ *             path should retrieve.
+ * @return The compiled path instance or NULL on memory failure.
+ */
+WXJSONPath *WXJSON_CompilePath(const char *spec) {
+    unsigned int segmentCount = 1;
+    WXJSONPathSegment *segment;
+    WXJSONPath *path;
+    const char *str;
+    char *nm, *ptr;
+
+    /* Measure, then single allocation with trailing segments and name */
+    for (str = spec; *str != '\0'; str++) {
+        if (*str == '.') segmentCount++;
+    }
+    path = (WXJSONPath *) WXMalloc(sizeof(WXJSONPath) +
+                                   segmentCount * sizeof(WXJSONPathSegment) +
+                                   (str - spec) + 1);
+    if (path == NULL) return NULL;
+    path->segmentCount = segmentCount;
+    path->segments = segment = (WXJSONPathSegment *) (path + 1);
+    nm = (char *) (segment + segmentCount);
+
+    /* Split the specification and pre-hash the segment keys */
+    (void) strcpy(nm, spec);
+    for (ptr = nm; ptr != NULL; ) {
+        segment->name = ptr;
+        ptr = strchr(ptr, '.');
+        if (ptr != NULL) *(ptr++) = '\0';
+        segment->hashCode = WXHash_StrHashFn((void *) segment->name);
+        segment++;
+    }
+
+    return path;
+}
+
+/**
+ * Evaluate a compiled path against a parsed JSON node, per the find method.
+ *
+ * @param root The parsed JSON node value to search from.
+ * @param path Compiled path instance from WXJSON_CompilePath.
+ * @return The child node, if located, or NULL if any entry in the path is
+ *         not found.
+ */
+WXJSONValue *WXJSON_FindCompiled(WXJSONValue *root, WXJSONPath *path) {
+    return WXJSON_DescendPath(root, path->segments, path->segmentCount);
+}
+
+/**
+ * Release a compiled path instance.
+ *
+ * @param path The compiled path to be released.
+ */
+void WXJSON_ReleasePath(WXJSONPath *path) {
+    WXFree(path);
+}
+
 /* Internal messaging method to delineate types */
 static char *descJSONType(WXJSONValueType type) {
     switch (type) {
@@ -848,6 +1669,104 @@ static char *descJSONType(WXJSONValueType type) {
     return "unknown";
 }
 
+/*
+ * Common value transfer for both of the binding entry points below, name
+ * is only used for error messaging.  Returns TRUE on success, FALSE with
+ * message on a binding error.
+ */
+static int WXJSON_BindValue(WXJSONValue *val, void *data, const char *name,
+                            WXJSONBindType type, uint32_t offset,
+                            char *errorMsg, int errorMsgLen) {
+    char *ptr = ((char *) data) + offset;
+
+    switch (type) {
+        case WXJSONBIND_STR:
+            if ((val->type != WXJSONVALUE_STRING) &&
+                    (val->type != WXJSONVALUE_NULL)) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Expecting string/null value for '%s', "
+                                "found %s instead", name,
+                                descJSONType(val->type));
+                return FALSE;
+            }
+            if (val->type == WXJSONVALUE_NULL) val = NULL;
+
+            /* Lots of jiggerypokery to manage string (re)allocation */
+            if (val != NULL) {
+                if (*((char **) ptr) != NULL) WXFree(*((char **) ptr));
+                *((char **) ptr) = WXMalloc(strlen(val->value.sval) + 1);
+                if (*((char **) ptr) != NULL) {
+                    (void) strcpy(*((char **) ptr), val->value.sval);
+                }
+            } else {
+                *((char **) ptr) = NULL;
+            }
+            break;
+        case WXJSONBIND_BOOLEAN:
+            if ((val->type != WXJSONVALUE_TRUE) &&
+                    (val->type != WXJSONVALUE_FALSE)) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Expecting true/false value for '%s', "
+                                "found %s instead", name,
+                                descJSONType(val->type));
+                return FALSE;
+            }
+            *((int *) ptr) = (val->type == WXJSONVALUE_TRUE) ? TRUE : FALSE;
+            break;
+        case WXJSONBIND_INT:
+        case WXJSONBIND_SIZE:
+        case WXJSONBIND_LONG:
+            if (val->type != WXJSONVALUE_INT) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Expecting integer value for '%s', "
+                                "found %s instead", name,
+                                descJSONType(val->type));
+                return FALSE;
+            }
+            if (type == WXJSONBIND_INT) {
+                *((int *) ptr) = (int) val->value.ival;
+            } else if (type == WXJSONBIND_SIZE) {
+                *((size_t *) ptr) = (size_t) val->value.ival;
+            } else {
+                *((long long int *) ptr) = val->value.ival;
+            }
+            break;
+        case WXJSONBIND_DOUBLE:
+            /* Only convenience conversion, as int is a double as well */
+            if ((val->type != WXJSONVALUE_INT) &&
+                    (val->type != WXJSONVALUE_DOUBLE)) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Expecting numeric value for '%s', "
+                                "found %s instead", name,
+                                descJSONType(val->type));
+                return FALSE;
+            }
+            if (val->type == WXJSONVALUE_INT) {
+                *((double *) ptr) = (double) val->value.ival;
+            } else {
+                *((double *) ptr) = val->value.dval;
+            }
+            break;
+        case WXJSONBIND_REF:
+            if ((val->type != WXJSONVALUE_OBJECT) &&
+                    (val->type != WXJSONVALUE_ARRAY)) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Expecting object/array value for '%s', "
+                                "found %s instead", name,
+                                descJSONType(val->type));
+                return FALSE;
+            }
+            *((WXJSONValue **) ptr) = val;
+            break;
+        default:
+            (void) snprintf(errorMsg, errorMsgLen,
+                            "Internal error, unrecognized bind type");
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
 /**
  * Utility method to bind a JSON data object (hierarchy) into a physical
  * data structure.  The binding method is reasonably strict, will not convert
@@ -866,7 +1785,6 @@ static char *descJSONType(WXJSONValueType type) {
 int WXJSON_Bind(WXJSONValue *root, void *data, WXJSONBindDefn *defn,
                 int defnCount, char *errorMsg, int errorMsgLen) {
     WXJSONValue *val;
-    char *ptr;
     int idx;
 
     /* Zoom through the provided binding definitions */
@@ -881,94 +1799,145 @@ int WXJSON_Bind(WXJSONValue *root, void *data, WXJSONBindDefn *defn,
             }
             continue;
         }
-        ptr = ((char *) data) + defn->offset;
 
         /* Bind away! */
-        switch (defn->type) {
-            case WXJSONBIND_STR:
-                if ((val->type != WXJSONVALUE_STRING) &&
-                        (val->type != WXJSONVALUE_NULL)) {
-                    (void) snprintf(errorMsg, errorMsgLen,
-                                    "Expecting string/null value for '%s', "
-                                    "found %s instead", defn->name,
-                                    descJSONType(val->type));
-                    return FALSE;
-                }
-                if (val->type == WXJSONVALUE_NULL) val = NULL;
-
-                /* Lots of jiggerypokery to manage string (re)allocation */
-                if (val != NULL) {
-                    if (*((char **) ptr) != NULL) WXFree(*((char **) ptr));
-                    *((char **) ptr) = WXMalloc(strlen(val->value.sval) + 1);
-                    if (*((char **) ptr) != NULL) {
-                        (void) strcpy(*((char **) ptr), val->value.sval);
-                    }
-                } else {
-                    *((char **) ptr) = NULL;
-                }
-                break;
-            case WXJSONBIND_BOOLEAN:
-                if ((val->type != WXJSONVALUE_TRUE) &&
-                        (val->type != WXJSONVALUE_FALSE)) {
-                    (void) snprintf(errorMsg, errorMsgLen,
-                                    "Expecting true/false value for '%s', "
-                                    "found %s instead", defn->name,
-                                    descJSONType(val->type));
-                    return FALSE;
-                }
-                *((int *) ptr) = (val->type == WXJSONVALUE_TRUE) ? TRUE : FALSE;
-                break;
-            case WXJSONBIND_INT:
-            case WXJSONBIND_SIZE:
-            case WXJSONBIND_LONG:
-                if (val->type != WXJSONVALUE_INT) {
-                    (void) snprintf(errorMsg, errorMsgLen,
-                                    "Expecting integer value for '%s', "
-                                    "found %s instead", defn->name,
-                                    descJSONType(val->type));
-                    return FALSE;
-                }
-                if (defn->type == WXJSONBIND_INT) {
-                    *((int *) ptr) = (int) val->value.ival;
-                } else if (defn->type == WXJSONBIND_SIZE) {
-                    *((size_t *) ptr) = (size_t) val->value.ival;
-                } else {
-                    *((long long int *) ptr) = val->value.ival;
-                }
-                break;
-            case WXJSONBIND_DOUBLE:
-                /* Only convenience conversion, as int is a double as well */
-                if ((val->type != WXJSONVALUE_INT) &&
-                        (val->type != WXJSONVALUE_DOUBLE)) {
-                    (void) snprintf(errorMsg, errorMsgLen,
-                                    "Expecting numeric value for '%s', "
-                                    "found %s instead", defn->name,
-                                    descJSONType(val->type));
-                    return FALSE;
-                }
-                if (defn->type == WXJSONBIND_INT) {
-                    *((double *) ptr) = (double) val->value.ival;
-                } else {
-                    *((double *) ptr) = val->value.dval;
-                }
-                break;
-            case WXJSONBIND_REF:
-                if ((val->type != WXJSONVALUE_OBJECT) &&
-                        (val->type != WXJSONVALUE_ARRAY)) {
-                    (void) snprintf(errorMsg, errorMsgLen,
-                                    "Expecting object/array value for '%s', "
-                                    "found %s instead", defn->name,
-                                    descJSONType(val->type));
-                    return FALSE;
-                }
-                *((WXJSONValue **) ptr) = val;
-                break;
-            default:
+        if (!WXJSON_BindValue(val, data, defn->name, defn->type, defn->offset,
+                              errorMsg, errorMsgLen)) return FALSE;
+    }
+
+    return TRUE;
+}
+
+/* Prepared form of a single binding definition, path segments pre-hashed */
+typedef struct {
+    const char *name;
+    WXJSONBindType type;
+    uint32_t offset;
+    int required;
+    unsigned int segmentCount;
+    WXJSONPathSegment *segments;
+} WXJSONBindPath;
+
+/* And the overall descriptor, all of the above in a single allocation */
+struct WXJSONBindings {
+    int defnCount;
+    WXJSONBindPath *paths;
+};
+
+/**
+ * Compile a set of binding definitions into a prepared descriptor, with the
+ * qualified names pre-split and the per-segment hashcodes pre-computed.  For
+ * fixed message schemas that are bound repeatedly, this moves all of the
+ * name processing cost out of the per-message bind calls.  The definition
+ * content is copied, the provided array has no lifetime requirement.
+ *
+ * @param defn Binding information for translating JSON to physical elements.
+ * @param defnCount Number of elements in the binding information array.
+ * @return The prepared binding descriptor or NULL on memory failure.
+ */
+WXJSONBindings *WXJSON_PrepareBindings(WXJSONBindDefn *defn, int defnCount) {
+    unsigned int totalSegments = 0;
+    WXJSONPathSegment *segment;
+    size_t size, nameSize = 0;
+    WXJSONBindings *bindings;
+    WXJSONBindPath *path;
+    const char *str;
+    char *nm, *ptr;
+    int idx;
+
+    /* First pass to measure segments and name storage (original name is
+     * retained intact for error messages, a second copy is split) */
+    for (idx = 0; idx < defnCount; idx++) {
+        totalSegments++;
+        for (str = defn[idx].name; *str != '\0'; str++) {
+            if (*str == '.') totalSegments++;
+        }
+        nameSize += 2 * ((str - defn[idx].name) + 1);
+    }
+
+    /* Single allocation, header then paths then segments then names */
+    size = sizeof(WXJSONBindings) + defnCount * sizeof(WXJSONBindPath) +
+               totalSegments * sizeof(WXJSONPathSegment) + nameSize;
+    bindings = (WXJSONBindings *) WXMalloc(size);
+    if (bindings == NULL) return NULL;
+    bindings->defnCount = defnCount;
+    bindings->paths = path = (WXJSONBindPath *) (bindings + 1);
+    segment = (WXJSONPathSegment *) (path + defnCount);
+    nm = (char *) (segment + totalSegments);
+
+    /* Second pass copies/splits the names and hashes the segments */
+    for (idx = 0; idx < defnCount; idx++, path++) {
+        path->type = defn[idx].type;
+        path->offset = defn[idx].offset;
+        path->required = defn[idx].required;
+        path->segments = segment;
+        path->segmentCount = 0;
+
+        /* Intact copy for messaging, split copy for the segment keys */
+        path->name = nm;
+        (void) strcpy(nm, defn[idx].name);
+        nm += strlen(defn[idx].name) + 1;
+        (void) strcpy(nm, defn[idx].name);
+        for (ptr = nm; ptr != NULL; ) {
+            segment->name = ptr;
+            ptr = strchr(ptr, '.');
+            if (ptr != NULL) *(ptr++) = '\0';
+            segment->hashCode = WXHash_StrHashFn((void *) segment->name);
+            path->segmentCount++;
+            segment++;
+        }
+        nm += strlen(defn[idx].name) + 1;
+    }
+
+    return bindings;
+}
+
+/**
+ * Bind a JSON data object into a physical data structure using a prepared
+ * binding descriptor.  Identical in behaviour to WXJSON_Bind with the
+ * original definitions, without the per-call name splitting and hashing.
+ *
+ * @param root Parsed JSON data node to bind information from.
+ * @param data Pointer to physical data structure to bind into.
+ * @param bindings Prepared binding descriptor from WXJSON_PrepareBindings.
+ * @param errorMsg Externally provided buffer for returning binding error
+ *                 information.
+ * @param errorMsgLen Length of provided buffer.
+ * @return TRUE if bind processing was successful, FALSE on error (message
+ *         in provided buffer).
+ */
+int WXJSON_BindPrepared(WXJSONValue *root, void *data,
+                        WXJSONBindings *bindings, char *errorMsg,
+                        int errorMsgLen) {
+    WXJSONBindPath *path = bindings->paths;
+    WXJSONValue *val;
+    int idx;
+
+    for (idx = 0; idx < bindings->defnCount; idx++, path++) {
+        /* Hashed direct descent in place of the find/split of the name */
+        val = WXJSON_DescendPath(root, path->segments, path->segmentCount);
+        if (val == NULL) {
+            if (path->required != 0) {
                 (void) snprintf(errorMsg, errorMsgLen,
-                                "Internal error, unrecognized bind type");
+                                "Missing JSON value for '%s'", path->name);
                 return FALSE;
+            }
+            continue;
         }
+
+        /* Bind away! */
+        if (!WXJSON_BindValue(val, data, path->name, path->type, path->offset,
+                              errorMsg, errorMsgLen)) return FALSE;
     }
 
     return TRUE;
 }
+
+/**
+ * Release a prepared binding descriptor.
+ *
+ * @param bindings The descriptor to be released.
+ */
+void WXJSON_ReleaseBindings(WXJSONBindings *bindings) {
+    WXFree(bindings);
+}
@@ -115,6 +115,9 @@ typedef struct {
             unsigned int lineNumber;
         } error;
     } value;
+
+    /* For arena-backed trees (root value only), the owning allocator */
+    WXArena *arena;
 } WXJSONValue;
 
 /**
@@ -126,6 +129,80 @@ typedef struct {
  */
 WXJSONValue *WXJSON_Decode(const char *content);
 
+/**
+ * Identical in contract to the decode method above, except that all of the
+ * parsing allocations (values, strings and container storage) are drawn from
+ * a single growable arena owned by the root value, so that the destroy method
+ * releases the entire tree in one pass instead of walking it.  Intended for
+ * the (dominant) parse-then-discard usage pattern - the resulting tree is
+ * fully readable (find/encode/bind) but must not be structurally modified,
+ * as container growth and entry removal assume discretely allocated content.
+ *
+ * @param content The JSON document/content to be parsed.
+ * @return The root value of the JSON data, note that this contains an error
+ *         item for any parsing error.  NULL for memory failure.
+ */
+WXJSONValue *WXJSON_DecodeArena(const char *content);
+
+/**
+ * Enumeration of the event types delivered by the streaming decoder below.
+ */
+typedef enum {
+    WXJSONEVT_OBJECT_START = 1,
+    WXJSONEVT_OBJECT_END = 2,
+    WXJSONEVT_ARRAY_START = 3,
+    WXJSONEVT_ARRAY_END = 4,
+    WXJSONEVT_SCALAR = 5
+} WXJSONEventType;
+
+/**
+ * Parse event record handed to the streaming decode callback.  All referenced
+ * content (name and string value storage) belongs to the parser and is only
+ * valid for the duration of the callback, copy anything that needs to live
+ * longer.
+ */
+typedef struct {
+    /* The type of parse event being delivered */
+    WXJSONEventType type;
+
+    /* Property name for events directly inside an object, NULL otherwise */
+    const char *name;
+
+    /* Scalar content for WXJSONEVT_SCALAR events (type NONE otherwise) */
+    WXJSONValue value;
+
+    /* Container nesting depth, zero for the root value */
+    unsigned int depth;
+} WXJSONEvent;
+
+/**
+ * Callback prototype for the streaming decoder.
+ *
+ * @param event The parse event being delivered (see above for lifespan).
+ * @param userData The opaque data element provided to the decode call.
+ * @return TRUE to continue parsing, FALSE to halt (without error).
+ */
+typedef int (*WXJSONEventHandler)(WXJSONEvent *event, void *userData);
+
+/**
+ * Streaming counterpart to the decode method, delivering parse events
+ * through a callback instead of materializing a full data value tree.
+ * Aside from the transient staging of individual string values, parsing
+ * runs in constant memory regardless of the document size, for extracting
+ * selected content from very large documents.
+ *
+ * @param content The JSON document/content to be parsed.
+ * @param handler Callback method to deliver parsing events to.
+ * @param userData Opaque data element passed through to the callback.
+ * @param lineNumberRef If non-NULL, returns the line number at which parsing
+ *                      ended (for error reporting).
+ * @return WXJSONERR_NONE_OK on successful or callback-halted parsing,
+ *         otherwise the associated parse/allocation error code.
+ */
+WXJSONErrorCode WXJSON_DecodeStream(const char *content,
+                                    WXJSONEventHandler handler, void *userData,
+                                    unsigned int *lineNumberRef);
+
 /**
  * Converse to the above, translate the JSON data content to a document.
  *
@@ -138,10 +215,46 @@ WXJSONValue *WXJSON_Decode(const char *content);
  */
 char *WXJSON_Encode(WXBuffer *buffer, WXJSONValue *value, int prettyPrint);
 
+/**
+ * Callback definition for receiving encoded content segments from the
+ * streaming encoder, in document order.
+ *
+ * @param content Reference to the encoded content segment (not terminated).
+ * @param length Number of bytes in the encoded content segment.
+ * @param userData The opaque data reference provided to the encode call.
+ * @return Zero (or positive) to continue encoding, negative on a sink
+ *         error (aborts the encode, returned value is lost).
+ */
+typedef int (*WXJSONEncodeSink)(uint8_t *content, size_t length,
+                                void *userData);
+
+/**
+ * Streaming form of the above, incrementally encoding the JSON data content
+ * through the provided sink instead of accumulating the entire document.
+ * Staged content is handed to the sink whenever it crosses the watermark (at
+ * element boundaries), so encoding proceeds in bounded memory and overlaps
+ * with transmission for sinks that write to the network (for example, the
+ * WXSockStream_SinkWrite adapter in the network streaming toolkit).  Note
+ * that the streamed content is not null-terminated (unlike WXJSON_Encode).
+ *
+ * @param value The root JSON value to be encoded.
+ * @param prettyPrint If TRUE (non-zero), pretty-print the JSON output,
+ *                    otherwise (false/zero) output in compact format.
+ * @param watermark Staging threshold (in bytes) at which accumulated content
+ *                  is pushed through the sink.  Zero for a suitable default.
+ * @param sink Callback to receive the encoded content segments, in order.
+ * @param userData Opaque data reference passed to each sink callback.
+ * @return TRUE if the encoding completed, FALSE on a memory allocation
+ *         failure or a sink error (per the sink return value).
+ */
+int WXJSON_EncodeToSink(WXJSONValue *value, int prettyPrint, size_t watermark,
+                        WXJSONEncodeSink sink, void *userData);
+
 /**
  * Destroy/release the contents of the provided data value (and all nested
  * values).  This method will also free the value itself (consistent with
- * the allocated return from the parse method).
+ * the allocated return from the parse method).  For arena-backed trees
+ * (per WXJSON_DecodeArena), this is a single release of the storage chain.
  *
  * @param value The value to be destroyed/freed.
  */
@@ -160,6 +273,39 @@ void WXJSON_Destroy(WXJSONValue *value);
  */
 WXJSONValue *WXJSON_Find(WXJSONValue *root, const char *childName);
 
+/* Opaque compiled form of a find/path expression (see below) */
+typedef struct WXJSONPath WXJSONPath;
+
+/**
+ * Compile a fully qualified (period-delimited) child node name into a
+ * reusable path instance, with the name segments pre-split and hashed.  For
+ * paths evaluated against every message (e.g. routing), this reduces the
+ * per-evaluation cost to the hash probes themselves.  Unlike the find
+ * method above, compiled names are not subject to a length limit.
+ *
+ * @param spec Fully qualified (period-delimited) name of the child node the
+ *             path should retrieve.
+ * @return The compiled path instance or NULL on memory failure.
+ */
+WXJSONPath *WXJSON_CompilePath(const char *spec);
+
+/**
+ * Evaluate a compiled path against a parsed JSON node, per the find method.
+ *
+ * @param root The parsed JSON node value to search from.
+ * @param path Compiled path instance from WXJSON_CompilePath.
+ * @return The child node, if located, or NULL if any entry in the path is
+ *         not found.
+ */
+WXJSONValue *WXJSON_FindCompiled(WXJSONValue *root, WXJSONPath *path);
+
+/**
+ * Release a compiled path instance.
+ *
+ * @param path The compiled path to be released.
+ */
+void WXJSON_ReleasePath(WXJSONPath *path);
+
 /* Enumeration of data types for physical JSON binding (below) */
 typedef enum {
     /* Data type is an allocated string pointer, recognizes string values */
@@ -210,4 +356,45 @@ typedef struct {
 int WXJSON_Bind(WXJSONValue *root, void *data, WXJSONBindDefn *defn,
                 int defnCount, char *errorMsg, int errorMsgLen);
 
+/* Opaque precompiled form of a binding definition set (see below) */
+typedef struct WXJSONBindings WXJSONBindings;
+
+/**
+ * Compile a set of binding definitions into a prepared descriptor, with the
+ * qualified names pre-split and the per-segment hashcodes pre-computed.  For
+ * fixed message schemas that are bound repeatedly, this moves all of the
+ * name processing cost out of the per-message bind calls.  The definition
+ * content is copied, the provided array has no lifetime requirement.
+ *
+ * @param defn Binding information for translating JSON to physical elements.
+ * @param defnCount Number of elements in the binding information array.
+ * @return The prepared binding descriptor or NULL on memory failure.
+ */
+WXJSONBindings *WXJSON_PrepareBindings(WXJSONBindDefn *defn, int defnCount);
+
+/**
+ * Bind a JSON data object into a physical data structure using a prepared
+ * binding descriptor.  Identical in behaviour to WXJSON_Bind with the
+ * original definitions, without the per-call name splitting and hashing.
+ *
+ * @param root Parsed JSON data node to bind information from.
+ * @param data Pointer to physical data structure to bind into.
+ * @param bindings Prepared binding descriptor from WXJSON_PrepareBindings.
+ * @param errorMsg Externally provided buffer for returning binding error
+ *                 information.
+ * @param errorMsgLen Length of provided buffer.
+ * @return TRUE if bind processing was successful, FALSE on error (message
+ *         in provided buffer).
+ */
+int WXJSON_BindPrepared(WXJSONValue *root, void *data,
+                        WXJSONBindings *bindings, char *errorMsg,
+                        int errorMsgLen);
+
+/**
+ * Release a prepared binding descriptor.
+ *
+ * @param bindings The descriptor to be released.
+ */
+void WXJSON_ReleaseBindings(WXJSONBindings *bindings);
+
 #endif
@@ -13,50 +13,73 @@
 
 /* These appear up front so the parser can use them... */
 
+/* Zero-filled node allocation, from the heap or a parsing arena */
+static void *_nodeAlloc(WXArena *arena, size_t size) {
+    void *retval;
+
+    if (arena == NULL) return WXCalloc(size);
+    retval = WXArena_Alloc(arena, size);
+    if (retval != NULL) (void) memset(retval, 0, size);
+    return retval;
+}
+
 /* Wrap with duplication and NULL handling */
-static char *_xmlStrDup(const char *val) {
+static char *_xmlStrDup(WXArena *arena, const char *val) {
     char *retval;
 
     if (val == NULL) return NULL;
-    retval = (char *) WXMalloc(strlen(val) + 1);
+    retval = (arena == NULL) ? (char *) WXMalloc(strlen(val) + 1) :
+                         (char *) WXArena_Alloc(arena, strlen(val) + 1);
     if (retval != NULL) (void) strcpy(retval, val);
     return retval;
 }
 
-/**
- * Utility method for allocating XML element instances, for manually creating
- * a DOM tree.
- *
- * @param parent The parent element, NULL for allocating a root element.
- * @param name The name of the element, may be duplicated based on flag.
- * @param namespace Reference to the namespace associated to this element, if
- *                  applicable.  If the origin of the provided namespace is
- *                  NULL (locally allocated), a namespace is created for this
- *                  element instead, obeying the duplicate flag.
- * @param content Optional content for this element, may be duplicated based
- *                on flag.
- * @param duplicate If FALSE, *all* provided information is allocated and
- *                  belongs to the element.  If TRUE, name, content and
- *                  namespace details are duplicated.
- * @return The element instance or NULL on memory allocation failure.
+/*
+ * Ownership adoption for non-duplicating allocation, heap strings (from the
+ * lexer) migrate into the arena, releasing the original on success.  A
+ * straight passthrough (including NULL) when there is no arena.
  */
-WXMLElement *WXML_AllocateElement(WXMLElement *parent, const char *name,
-                                  WXMLNamespace *ns, const char *content,
-                                  int duplicate) {
-    WXMLElement *elmnt = (WXMLElement *) WXCalloc(sizeof(WXMLElement));
+static char *_xmlStrAdopt(WXArena *arena, char *str) {
+    char *retval;
+
+    if ((arena == NULL) || (str == NULL)) return str;
+    retval = _xmlStrDup(arena, str);
+    if (retval != NULL) WXFree(str);
+    return retval;
+}
+
+/*
+ * Arena-aware core for the public element/namespace/attribute allocators
+ * below.  When an arena is provided, the node and any retained strings are
+ * carved from it (non-duplicated strings are adopted, see above) and error
+ * paths release nothing, the caller discards the whole arena instead.
+ */
+static WXMLNamespace *_allocNamespace(WXArena *arena, WXMLElement *origin,
+                                      const char *prefix, const char *href,
+                                      int duplicate);
+
+static WXMLElement *_allocElement(WXArena *arena, WXMLElement *parent,
+                                  const char *name, WXMLNamespace *ns,
+                                  const char *content, int duplicate) {
+    WXMLElement *elmnt = (WXMLElement *) _nodeAlloc(arena,
+                                                    sizeof(WXMLElement));
     if (elmnt == NULL) return NULL;
 
     if (!duplicate) {
-        elmnt->name = (char *) name;
-        elmnt->content = (char *) content;
+        elmnt->name = _xmlStrAdopt(arena, (char *) name);
+        elmnt->content = _xmlStrAdopt(arena, (char *) content);
+        if (((name != NULL) && (elmnt->name == NULL)) ||
+                ((content != NULL) && (elmnt->content == NULL))) return NULL;
     } else {
-        elmnt->name = (name != NULL) ? _xmlStrDup(name) : NULL;
-        if (content != NULL) elmnt->content = _xmlStrDup(content);
+        elmnt->name = (name != NULL) ? _xmlStrDup(arena, name) : NULL;
+        if (content != NULL) elmnt->content = _xmlStrDup(arena, content);
         if (((name != NULL) && (elmnt->name == NULL)) ||
                 ((content != NULL) && (elmnt->content == NULL))) {
-            if (elmnt->content != NULL) WXFree(elmnt->content);
-            if (elmnt->name != NULL) WXFree(elmnt->name);
-            WXFree(elmnt);
+            if (arena == NULL) {
+                if (elmnt->content != NULL) WXFree(elmnt->content);
+                if (elmnt->name != NULL) WXFree(elmnt->name);
+                WXFree(elmnt);
+            }
             return NULL;
         }
     }
@@ -64,12 +87,14 @@ WXMLElement *WXML_AllocateElement(WXMLElement *parent, const char *name,
     /* Create the local element namespace if unassociated */
     if (ns != NULL) {
         if (ns->origin == NULL) {
-            elmnt->namespace = WXML_AllocateNamespace(elmnt, ns->prefix,
-                                                      ns->href, duplicate);
+            elmnt->namespace = _allocNamespace(arena, elmnt, ns->prefix,
+                                               ns->href, duplicate);
             if (elmnt->namespace == NULL) {
-                if (elmnt->content != NULL) WXFree(elmnt->content);
-                if (elmnt->name != NULL) WXFree(elmnt->name);
-                WXFree(elmnt);
+                if (arena == NULL) {
+                    if (elmnt->content != NULL) WXFree(elmnt->content);
+                    if (elmnt->name != NULL) WXFree(elmnt->name);
+                    WXFree(elmnt);
+                }
                 return NULL;
             }
         } else {
@@ -97,33 +122,27 @@ WXMLElement *WXML_AllocateElement(WXMLElement *parent, const char *name,
     return elmnt;
 }
 
-/**
- * Utility method for allocating XML namespace instances, for manually creating
- * a DOM tree.
- *
- * @param origin The element to which this namespace is associated (scope).
- * @param prefix The prefix identifier for the namespace, may be duplicated.
- * @param href The URI associated to the namespace, may be duplicated.
- * @param duplicate If FALSE, *all* provided information is allocated and
- *                  belongs to the namespace.  If TRUE, prefix and href details
- *                  are duplicated.
- * @return The namespace instance or NULL on memory allocation failure.
- */
-WXMLNamespace *WXML_AllocateNamespace(WXMLElement *origin, const char *prefix,
-                                      const char *href, int duplicate) {
-    WXMLNamespace *ns = (WXMLNamespace *) WXCalloc(sizeof(WXMLNamespace));
+static WXMLNamespace *_allocNamespace(WXArena *arena, WXMLElement *origin,
+                                      const char *prefix, const char *href,
+                                      int duplicate) {
+    WXMLNamespace *ns = (WXMLNamespace *) _nodeAlloc(arena,
+                                                     sizeof(WXMLNamespace));
     if (ns == NULL) return NULL;
 
     if (!duplicate) {
-        ns->prefix = (char *) prefix;
-        ns->href = (char *) href;
+        ns->prefix = _xmlStrAdopt(arena, (char *) prefix);
+        ns->href = _xmlStrAdopt(arena, (char *) href);
+        if (((prefix != NULL) && (ns->prefix == NULL)) ||
+                ((href != NULL) && (ns->href == NULL))) return NULL;
     } else {
-        ns->prefix = _xmlStrDup(prefix);
-        ns->href = _xmlStrDup(href);
+        ns->prefix = _xmlStrDup(arena, prefix);
+        ns->href = _xmlStrDup(arena, href);
         if ((ns->prefix == NULL) || (ns->href == NULL)) {
-            if (ns->href != NULL) WXFree(ns->href);
-            if (ns->prefix != NULL) WXFree(ns->prefix);
-            WXFree(ns);
+            if (arena == NULL) {
+                if (ns->href != NULL) WXFree(ns->href);
+                if (ns->prefix != NULL) WXFree(ns->prefix);
+                WXFree(ns);
+            }
             return NULL;
         }
     }
@@ -136,38 +155,29 @@ WXMLNamespace *WXML_AllocateNamespace(WXMLElement *origin, const char *prefix,
     return ns;
 }
 
-/**
- * Utility method for allocating XML attribute instances, for manually creating
- * a DOM tree.
- *
- * @param elmnt The element to which this attribute is attached.
- * @param name The name/identifier of the attribute, may be duplicated
- * @param namespace Reference to the namespace associated to this attribute, if
- *                  applicable.  Pay attention to the origin/scoping of the
- *                  namespace and related elements.
- * @param value The optional associated attribute value, may be duplicated.
- * @param duplicate If FALSE, *all* provided information is allocated and
- *                  belongs to the namespace.  If TRUE, name and value details
- *                  are duplicated.
- * @return The attribute instance or NULL on memory allocation failure.
- */
-WXMLAttribute *WXML_AllocateAttribute(WXMLElement *elmnt, const char *name,
-                                      WXMLNamespace *namespace, const char *val,
-                                      int duplicate) {
-    WXMLAttribute *attr = (WXMLAttribute *) WXCalloc(sizeof(WXMLAttribute));
+static WXMLAttribute *_allocAttribute(WXArena *arena, WXMLElement *elmnt,
+                                      const char *name, WXMLNamespace *ns,
+                                      const char *val, int duplicate) {
+    WXMLAttribute *attr = (WXMLAttribute *) _nodeAlloc(arena,
+                                                       sizeof(WXMLAttribute));
     if (attr == NULL) return NULL;
 
     attr->element = elmnt;
+    attr->namespace = ns;
     if (!duplicate) {
-        attr->name = (char *) name;
-        attr->value = (char *) val;
+        attr->name = _xmlStrAdopt(arena, (char *) name);
+        attr->value = _xmlStrAdopt(arena, (char *) val);
+        if (((name != NULL) && (attr->name == NULL)) ||
+                ((val != NULL) && (attr->value == NULL))) return NULL;
     } else {
-        attr->name = _xmlStrDup(name);
-        if (val != NULL) attr->value = _xmlStrDup(val);
+        attr->name = _xmlStrDup(arena, name);
+        if (val != NULL) attr->value = _xmlStrDup(arena, val);
         if ((attr->name == NULL) || ((val != NULL) && (attr->value == NULL))) {
-            if (attr->value != NULL) WXFree(attr->value);
-            if (attr->name != NULL) WXFree(attr->name);
-            WXFree(attr);
+            if (arena == NULL) {
+                if (attr->value != NULL) WXFree(attr->value);
+                if (attr->name != NULL) WXFree(attr->name);
+                WXFree(attr);
+            }
             return NULL;
         }
     }
@@ -183,6 +193,67 @@ WXMLAttribute *WXML_AllocateAttribute(WXMLElement *elmnt, const char *name,
     return attr;
 }
 
+/**
+ * Utility method for allocating XML element instances, for manually creating
+ * a DOM tree.
+ *
+ * @param parent The parent element, NULL for allocating a root element.
+ * @param name The name of the element, may be duplicated based on flag.
+ * @param namespace Reference to the namespace associated to this element, if
+ *                  applicable.  If the origin of the provided namespace is
+ *                  NULL (locally allocated), a namespace is created for this
+ *                  element instead, obeying the duplicate flag.
+ * @param content Optional content for this element, may be duplicated based
+ *                on flag.
+ * @param duplicate If FALSE, *all* provided information is allocated and
+ *                  belongs to the element.  If TRUE, name, content and
+ *                  namespace details are duplicated.
+ * @return The element instance or NULL on memory allocation failure.
+ */
+WXMLElement *WXML_AllocateElement(WXMLElement *parent, const char *name,
+                                  WXMLNamespace *ns, const char *content,
+                                  int duplicate) {
+    return _allocElement(NULL, parent, name, ns, content, duplicate);
+}
+
+/**
+ * Utility method for allocating XML namespace instances, for manually creating
+ * a DOM tree.
+ *
+ * @param origin The element to which this namespace is associated (scope).
+ * @param prefix The prefix identifier for the namespace, may be duplicated.
+ * @param href The URI associated to the namespace, may be duplicated.
+ * @param duplicate If FALSE, *all* provided information is allocated and
+ *                  belongs to the namespace.  If TRUE, prefix and href details
+ *                  are duplicated.
+ * @return The namespace instance or NULL on memory allocation failure.
+ */
+WXMLNamespace *WXML_AllocateNamespace(WXMLElement *origin, const char *prefix,
+                                      const char *href, int duplicate) {
+    return _allocNamespace(NULL, origin, prefix, href, duplicate);
+}
+
+/**
+ * Utility method for allocating XML attribute instances, for manually creating
+ * a DOM tree.
+ *
+ * @param elmnt The element to which this attribute is attached.
+ * @param name The name/identifier of the attribute, may be duplicated
+ * @param namespace Reference to the namespace associated to this attribute, if
+ *                  applicable.  Pay attention to the origin/scoping of the
+ *                  namespace and related elements.
+ * @param value The optional associated attribute value, may be duplicated.
+ * @param duplicate If FALSE, *all* provided information is allocated and
+ *                  belongs to the namespace.  If TRUE, name and value details
+ *                  are duplicated.
+ * @return The attribute instance or NULL on memory allocation failure.
+ */
+WXMLAttribute *WXML_AllocateAttribute(WXMLElement *elmnt, const char *name,
+                                      WXMLNamespace *namespace, const char *val,
+                                      int duplicate) {
+    return _allocAttribute(NULL, elmnt, name, namespace, val, duplicate);
+}
+
 static char *_memFail = "Internal error: memory allocation failure";
 
 /**
@@ -510,20 +581,10 @@ static WXMLNamespace *_assignNS(WXMLElement *elmnt, char *name,
     return dflt;
 }
 
-/**
- * Parse/decode XML text, returning a corresponding document representation.
- *
- * @param content The XML document/content to be parsed.
- * @param retainTextFragments If TRUE (non-zero), text fragments are retained
- *                            (NULL-named children) and consolidated in parent
- *                            element.  If FALSE, only consolidated content is
- *                            captured.
- * @param errorMsg External buffer for returning parsing error details.
- * @param errorMsgLen Length of provided buffer.
- * @return The document root instance, or NULL on parsing or memory failure.
- */
-WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
-                         char *errorMsg, int errorMsgLen) {
+/* Core of the parser, heap or arena-based node allocation per the above */
+static WXMLElement *_decodeDocument(const char *content,
+                                    int retainTextFragments, WXArena *arena,
+                                    char *errorMsg, int errorMsgLen) {
     WXMLElement *retval = NULL, *current = NULL;
     WXMLNamespace *ns, *dfltNs;
     WXMLAttribute *attr = NULL;
@@ -553,7 +614,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                     (void) snprintf(errorMsg, errorMsgLen,
                                     "Syntax error: unterminated processing "
                                     "instruction (line %d)", lineNo);
-                    if (retval != NULL) WXML_Destroy(retval);
+                    if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                     retval = current = NULL;
                     break;
                 }
@@ -574,7 +635,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                 (void) snprintf(errorMsg, errorMsgLen,
                                 "Syntax error: Missing name in opening tag "
                                 "(line %d)", lexer.lineNumber);
-                if (retval != NULL) WXML_Destroy(retval);
+                if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                 retval = current = NULL;
                 break;
             }
@@ -584,14 +645,14 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                  (void) snprintf(errorMsg, errorMsgLen,
                                  "Syntax error: Multiple root elements are "
                                  "defined (line %d)", lexer.lineNumber);
-                 WXML_Destroy(retval);
+                 if (arena == NULL) WXML_Destroy(retval);
                  retval = current = NULL;
                  break;
             }
 
             /* At this point, we can create the element in the stack */
-            current = WXML_AllocateElement(current, lexer.lastToken.val,
-                                           NULL, NULL, FALSE);
+            current = _allocElement(arena, current, lexer.lastToken.val,
+                                    NULL, NULL, FALSE);
             if (current == NULL) goto memfail;
             lexer.lastToken.val = NULL;
             if (retval == NULL) retval = current;
@@ -607,7 +668,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                     (void) snprintf(errorMsg, errorMsgLen,
                                     "Syntax error: unterminated element tag "
                                     "(line %d)", lineNo);
-                    if (retval != NULL) WXML_Destroy(retval);
+                    if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                     retval = current = NULL;
                     break;
                 }
@@ -630,7 +691,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                                                 lexer.lineNumber);
                             }
                             WXFree(nm);
-                            if (retval != NULL) WXML_Destroy(retval);
+                            if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                             retval = current = NULL;
                             type = WXMLTK_ERROR;
                             break;
@@ -640,15 +701,15 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                         offset = (nm[5] == ':') ? 6 : 5;
                         (void) memmove(nm, nm + offset,
                                        strlen(nm + offset) + 1);
-                        ns = WXML_AllocateNamespace(current, nm,
-                                                    lexer.lastToken.val, FALSE);
+                        ns = _allocNamespace(arena, current, nm,
+                                             lexer.lastToken.val, FALSE);
                         if (ns == NULL) goto memfail;
                         lexer.lastToken.val = NULL;
                     } else {
                         /* Create the attribute, empty shell ready for assign */
-                        attr = WXML_AllocateAttribute(current,
-                                                      lexer.lastToken.val,
-                                                      NULL, NULL, FALSE);
+                        attr = _allocAttribute(arena, current,
+                                               lexer.lastToken.val,
+                                               NULL, NULL, FALSE);
                         if (attr == NULL) goto memfail;
                         lexer.lastToken.val = NULL;
                     }
@@ -658,7 +719,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                         (void) snprintf(errorMsg, errorMsgLen,
                                         "Syntax error: missing identifier for "
                                         "attribute (line %d)", lineNo);
-                        if (retval != NULL) WXML_Destroy(retval);
+                        if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                         retval = current = NULL;
                         break;
                     }
@@ -672,12 +733,13 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                                             "ment requires value (line %d)",
                                             lexer.lineNumber);
                         }
-                        if (retval != NULL) WXML_Destroy(retval);
+                        if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                         retval = current = NULL;
                         type = WXMLTK_ERROR;
                         break;
                     }
-                    attr->value = lexer.lastToken.val;
+                    attr->value = _xmlStrAdopt(arena, lexer.lastToken.val);
+                    if (attr->value == NULL) goto memfail;
                     lexer.lastToken.val = NULL;
 
                     /* Reset identifier marker */
@@ -686,7 +748,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                     (void) snprintf(errorMsg, errorMsgLen,
                                     "Syntax error: invalid text in element tag "
                                     "(line %d)", lineNo);
-                    if (retval != NULL) WXML_Destroy(retval);
+                    if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                     retval = current = NULL;
                     break;
                 }
@@ -721,7 +783,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                 (void) snprintf(errorMsg, errorMsgLen,
                                 "Syntax error: Unexpected end tag "
                                 "encountered (line %d)", lexer.lineNumber);
-                if (retval != NULL) WXML_Destroy(retval);
+                if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                 retval = current = NULL;
                 break;
             }
@@ -732,7 +794,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                 (void) snprintf(errorMsg, errorMsgLen,
                                 "Syntax error: Missing name in closing tag "
                                 "(line %d)", lexer.lineNumber);
-                if (retval != NULL) WXML_Destroy(retval);
+                if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                 retval = current = NULL;
                 break;
             }
@@ -745,7 +807,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                                     "Syntax error: Unmatched closing tag, "
                                     "expected </%s> (line %d)", current->name,
                                     lexer.lineNumber);
-                    if (retval != NULL) WXML_Destroy(retval);
+                    if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                     retval = current = NULL;
                     break;
                 }
@@ -759,7 +821,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                                     "expected </%s:%s> (line %d)",
                                     current->namespace->prefix, current->name,
                                     lexer.lineNumber);
-                    if (retval != NULL) WXML_Destroy(retval);
+                    if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                     retval = current = NULL;
                     break;
                 }
@@ -773,7 +835,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                 (void) snprintf(errorMsg, errorMsgLen,
                                 "Syntax error: Missing end of closing "
                                 "tag (line %d)", lexer.lineNumber);
-                if (retval != NULL) WXML_Destroy(retval);
+                if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                 retval = current = NULL;
                 break;
             }
@@ -781,7 +843,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                 (void) snprintf(errorMsg, errorMsgLen,
                                 "Syntax error: Extraneous content in closing "
                                 "tag (line %d)", lexer.lineNumber);
-                if (retval != NULL) WXML_Destroy(retval);
+                if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
                 retval = current = NULL;
                 break;
             }
@@ -795,24 +857,28 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
         } else if ((type == WXMLTK_CONTENT) && (current != NULL)) {
             /* Allocate text fragment child if so requested */
             if (retainTextFragments) {
-                if (WXML_AllocateElement(current, NULL, NULL,
-                                         lexer.lastToken.val, TRUE) == NULL) {
+                if (_allocElement(arena, current, NULL, NULL,
+                                  lexer.lastToken.val, TRUE) == NULL) {
                     goto memfail;
                 }
             }
 
             /* Just append to what's there (or just initialize) */
             if (current->content == NULL) {
-                /* Just steal the allocated value */
-                current->content = lexer.lastToken.val;
+                /* Just steal (or adopt) the allocated value */
+                current->content = _xmlStrAdopt(arena, lexer.lastToken.val);
+                if (current->content == NULL) goto memfail;
                 lexer.lastToken.val = NULL;
             } else {
-                tmp = WXMalloc(strlen(current->content) +
-                                   strlen(lexer.lastToken.val) + 1);
+                tmp = (arena == NULL) ?
+                          WXMalloc(strlen(current->content) +
+                                       strlen(lexer.lastToken.val) + 1) :
+                          WXArena_Alloc(arena, strlen(current->content) +
+                                            strlen(lexer.lastToken.val) + 1);
                 if (tmp == NULL) goto memfail;
                 (void) strcpy(tmp, current->content);
                 (void) strcat(tmp, lexer.lastToken.val);
-                WXFree(current->content);
+                if (arena == NULL) WXFree(current->content);
                 current->content = tmp;
 
                 WXFree(lexer.lastToken.val);
@@ -824,7 +890,7 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
             (void) snprintf(errorMsg, errorMsgLen,
                             "Syntax error: extraneous content encountered "
                             "(line %d)", lexer.lineNumber);
-            if (retval != NULL) WXML_Destroy(retval);
+            if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
             retval = current = NULL;
             break;
         }
@@ -832,13 +898,13 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
 
     /* Clean up/error if parse incomplete, dangling content or nothing */
     if (lexer.lastToken.type != WXMLTK_EOF) {
-        if (retval != NULL) WXML_Destroy(retval);
+        if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
         retval = NULL;
     } else if ((retval != NULL) && (current != NULL)) {
         (void) snprintf(errorMsg, errorMsgLen,
                         "End of document reached, unclosed element '%s'",
                         current->name);
-        WXML_Destroy(retval);
+        if (arena == NULL) WXML_Destroy(retval);
         retval = NULL;
     } else if ((retval == NULL) && (*errorMsg == '\0')) {
         (void) snprintf(errorMsg, errorMsgLen,
@@ -852,10 +918,557 @@ WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
 memfail:
     if (lexer.lastToken.val != NULL) WXFree(lexer.lastToken.val);
     (void) snprintf(errorMsg, errorMsgLen, "%s", _memFail);
-    if (retval != NULL) WXML_Destroy(retval);
+    if ((retval != NULL) && (arena == NULL)) WXML_Destroy(retval);
     return NULL;
 }
 
+
+/**
+ * Parse/decode XML text, returning a corresponding document representation.
+ *
+ * @param content The XML document/content to be parsed.
+ * @param retainTextFragments If TRUE (non-zero), text fragments are retained
+ *                            (NULL-named children) and consolidated in parent
+ *                            element.  If FALSE, only consolidated content is
+ *                            captured.
+ * @param errorMsg External buffer for returning parsing error details.
+ * @param errorMsgLen Length of provided buffer.
+ * @return The document root instance, or NULL on parsing or memory failure.
+ */
+WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
+                         char *errorMsg, int errorMsgLen) {
+    return _decodeDocument(content, retainTextFragments, NULL,
+                           errorMsg, errorMsgLen);
+}
+
+/* Sizing of the underlying arena allocation blocks for document parsing */
+#define WXML_ARENA_BLOCK_SIZE 8192
+
+/**
+ * Identical parsing to the above, except that all nodes and retained text
+ * for the document are allocated from a single growable memory arena owned
+ * by the root element.  The resulting tree is fully usable with the find,
+ * encoding and canonicalization methods, but must not be structurally
+ * modified or spliced into other documents, and WXML_Destroy releases the
+ * entire parse in a single arena teardown instead of a node-by-node free.
+ * Intended for very large read-only documents where the per-node release
+ * cost is prohibitive.
+ *
+ * @param content The XML document/content to be parsed.
+ * @param retainTextFragments If TRUE (non-zero), text fragments are retained
+ *                            (NULL-named children) and consolidated in parent
+ *                            element.  If FALSE, only consolidated content is
+ *                            captured.
+ * @param errorMsg External buffer for returning parsing error details.
+ * @param errorMsgLen Length of provided buffer.
+ * @return The document root instance, or NULL on parsing or memory failure.
+ */
+WXMLElement *WXML_DecodeArena(const char *content, int retainTextFragments,
+                              char *errorMsg, int errorMsgLen) {
+    WXMLElement *retval;
+    WXArena *arena;
+
+    /* Arena header is heap-based, released along with the teardown */
+    arena = (WXArena *) WXMalloc(sizeof(WXArena));
+    if (arena == NULL) {
+        (void) snprintf(errorMsg, errorMsgLen, "%s", _memFail);
+        return NULL;
+    }
+    if (!WXArena_Init(arena, WXML_ARENA_BLOCK_SIZE)) {
+        WXFree(arena);
+        (void) snprintf(errorMsg, errorMsgLen, "%s", _memFail);
+        return NULL;
+    }
+
+    retval = _decodeDocument(content, retainTextFragments, arena,
+                             errorMsg, errorMsgLen);
+    if (retval == NULL) {
+        WXArena_Destroy(arena);
+        WXFree(arena);
+        return NULL;
+    }
+
+    /* Root element carries the arena for the single-release destroy */
+    retval->arena = arena;
+    return retval;
+}
+
+/* Common error exit for the reader, releases any open parsing state */
+static WXMLEventType _readerFail(WXMLReader *reader) {
+    WXMLElement *root = reader->current;
+
+    if (reader->lexer->lastToken.val != NULL) {
+        WXFree(reader->lexer->lastToken.val);
+        reader->lexer->lastToken.val = NULL;
+    }
+    if (root != NULL) {
+        while (root->parent != NULL) root = root->parent;
+        WXML_Destroy(root);
+    }
+    reader->current = NULL;
+    reader->depth = 0;
+    return (reader->lastEvent = WXMLEVT_ERROR);
+}
+
+/**
+ * Initialize a pull-parsing reader instance against the provided document.
+ *
+ * @param reader Reference to the reader instance to be initialized.
+ * @param content The XML document/content to be parsed.
+ * @return TRUE if the reader initialized, FALSE on memory allocation failure.
+ */
+int WXML_ReaderInit(WXMLReader *reader, const char *content) {
+    reader->lexer = (WXMLLexer *) WXMalloc(sizeof(WXMLLexer));
+    if (reader->lexer == NULL) return FALSE;
+    WXMLLexerInit(reader->lexer, content);
+    reader->current = NULL;
+    reader->text = NULL;
+    reader->depth = 0;
+    reader->lastEvent = WXMLEVT_DOC_START;
+    reader->pendingEnd = reader->pendingPop = FALSE;
+    reader->seenRoot = reader->building = reader->retainTextFragments = FALSE;
+    return TRUE;
+}
+
+/**
+ * Obtain the next parsing event from the reader.  For element start events,
+ * the current element exposes the tag name, namespaces and attributes (but
+ * not content or children, unless promoted).  Elements are released as they
+ * close, any retained references are invalid after the subsequent call.
+ *
+ * @param reader The reader instance to pull the next event from.
+ * @param errorMsg External buffer for returning parsing error details.
+ * @param errorMsgLen Length of provided buffer.
+ * @return The parsing event, WXMLEVT_ERROR/WXMLEVT_DOC_END are terminal.
+ */
+WXMLEventType WXML_ReaderNext(WXMLReader *reader, char *errorMsg,
+                              int errorMsgLen) {
+    WXMLLexer *lexer = reader->lexer;
+    WXMLNamespace *ns, *dfltNs;
+    WXMLAttribute *attr = NULL;
+    WXMLElement *elmnt;
+    unsigned int lineNo;
+    WXMLTokenType type;
+    char *nm, *tmp;
+    int offset;
+
+    /* Terminal conditions are sticky, no further parsing occurs */
+    if ((reader->lastEvent == WXMLEVT_ERROR) ||
+            (reader->lastEvent == WXMLEVT_DOC_END)) return reader->lastEvent;
+    *errorMsg = '\0';
+
+    /* Flush the text fragment from a preceding content event */
+    if (reader->text != NULL) {
+        WXFree(reader->text);
+        reader->text = NULL;
+    }
+
+    /* Closed elements are released once the consumer has moved on */
+    if (reader->pendingPop) {
+        reader->pendingPop = FALSE;
+        elmnt = reader->current;
+        reader->current = elmnt->parent;
+        if (reader->current != NULL) {
+            reader->current->children = reader->current->lastChild = NULL;
+        } else {
+            lexer->ignoreWhitespace = TRUE;
+        }
+        elmnt->parent = NULL;
+        WXML_Destroy(elmnt);
+        reader->depth--;
+    }
+
+    /* Empty element tags close without any further lexical content */
+    if (reader->pendingEnd) {
+        reader->pendingEnd = FALSE;
+        if (reader->building) {
+            /* Tree is being retained (promotion), just step up the stack */
+            reader->current = reader->current->parent;
+            reader->depth--;
+            if (reader->current == NULL) lexer->ignoreWhitespace = TRUE;
+        } else {
+            reader->pendingPop = TRUE;
+        }
+        return (reader->lastEvent = WXMLEVT_ELEMENT_END);
+    }
+
+    /* Event loop, consuming non-event lexical items (PI's) along the way */
+    while (TRUE) {
+        type = WXMLLexerNext(lexer, errorMsg, errorMsgLen);
+        if (type == WXMLTK_ERROR) return _readerFail(reader);
+
+        if (type == WXMLTK_EOF) {
+            if (reader->current != NULL) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "End of document reached, unclosed element "
+                                "'%s'", reader->current->name);
+                return _readerFail(reader);
+            }
+            if (!reader->seenRoot) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Empty document, no root element found");
+                return _readerFail(reader);
+            }
+            return (reader->lastEvent = WXMLEVT_DOC_END);
+        }
+
+        if (type == WXMLTK_PI_START) {
+            /* As in the DOM parser, processing instructions are consumed */
+            lineNo = lexer->lineNumber;
+            while (type != WXMLTK_PI_END) {
+                type = WXMLLexerNext(lexer, errorMsg, errorMsgLen);
+                if (type == WXMLTK_ERROR) return _readerFail(reader);
+                if (type == WXMLTK_EOF) {
+                    (void) snprintf(errorMsg, errorMsgLen,
+                                    "Syntax error: unterminated processing "
+                                    "instruction (line %d)", lineNo);
+                    return _readerFail(reader);
+                }
+                if (lexer->lastToken.val != NULL) {
+                    WXFree(lexer->lastToken.val);
+                    lexer->lastToken.val = NULL;
+                }
+            }
+
+            /* Reset the whitespace if we aren't in element context */
+            if (reader->current == NULL) lexer->ignoreWhitespace = TRUE;
+
+        } else if (type == WXMLTK_ELMNT_TAG_START) {
+            /* First it needs a name */
+            type = WXMLLexerNext(lexer, errorMsg, errorMsgLen);
+            if (type == WXMLTK_ERROR) return _readerFail(reader);
+            if (type != WXMLTK_IDENTIFIER) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Syntax error: Missing name in opening tag "
+                                "(line %d)", lexer->lineNumber);
+                return _readerFail(reader);
+            }
+
+            /* There can only be one root */
+            if ((reader->current == NULL) && (reader->seenRoot)) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Syntax error: Multiple root elements are "
+                                "defined (line %d)", lexer->lineNumber);
+                return _readerFail(reader);
+            }
+
+            /* Open the element onto the parsing chain */
+            elmnt = WXML_AllocateElement(reader->current, lexer->lastToken.val,
+                                         NULL, NULL, FALSE);
+            if (elmnt == NULL) goto memfail;
+            lexer->lastToken.val = NULL;
+            reader->current = elmnt;
+            reader->depth++;
+            reader->seenRoot = TRUE;
+
+            /* Process the remaining tag elements (attributes) */
+            lineNo = lexer->lineNumber;
+            while (type != WXMLTK_EOF) {
+                type = WXMLLexerNext(lexer, errorMsg, errorMsgLen);
+                if ((type == WXMLTK_ERROR) ||
+                        (type == WXMLTK_ELMNT_TAG_END) ||
+                        (type == WXMLTK_EMPTY_ELMNT_TAG_END)) break;
+                if (type == WXMLTK_EOF) {
+                    (void) snprintf(errorMsg, errorMsgLen,
+                                    "Syntax error: unterminated element tag "
+                                    "(line %d)", lineNo);
+                    return _readerFail(reader);
+                }
+
+                if (type == WXMLTK_IDENTIFIER) {
+                    /* This can be an attribute or a namespace definition */
+                    attr = NULL;
+                    nm = lexer->lastToken.val;
+                    if ((strncmp(nm, "xmlns", 5) == 0) &&
+                              ((nm[5] == ':') || (nm[5] == '\0'))) {
+                        /* URI must be provided */
+                        if ((WXMLLexerNext(lexer, errorMsg,
+                                           errorMsgLen) != WXMLTK_ATTR_EQ) ||
+                              (WXMLLexerNext(lexer, errorMsg,
+                                           errorMsgLen) != WXMLTK_ATTR_VALUE)) {
+                            if (lexer->lastToken.type != WXMLTK_ERROR) {
+                                (void) snprintf(errorMsg, errorMsgLen,
+                                                "Syntax error: namespaces "
+                                                "require URI value (line %d)",
+                                                lexer->lineNumber);
+                            }
+                            WXFree(nm);
+                            return _readerFail(reader);
+                        }
+
+                        /* Hook it all together, remove identifier marker */
+                        offset = (nm[5] == ':') ? 6 : 5;
+                        (void) memmove(nm, nm + offset,
+                                       strlen(nm + offset) + 1);
+                        ns = WXML_AllocateNamespace(reader->current, nm,
+                                                    lexer->lastToken.val,
+                                                    FALSE);
+                        if (ns == NULL) goto memfail;
+                        lexer->lastToken.val = NULL;
+                    } else {
+                        /* Create the attribute, empty shell ready for assign */
+                        attr = WXML_AllocateAttribute(reader->current,
+                                                      lexer->lastToken.val,
+                                                      NULL, NULL, FALSE);
+                        if (attr == NULL) goto memfail;
+                        lexer->lastToken.val = NULL;
+                    }
+                } else if (type == WXMLTK_ATTR_EQ) {
+                    /* Only assignable from an attribute definition */
+                    if (attr == NULL) {
+                        (void) snprintf(errorMsg, errorMsgLen,
+                                        "Syntax error: missing identifier for "
+                                        "attribute (line %d)", lineNo);
+                        return _readerFail(reader);
+                    }
+
+                    /* Requires associated value, transfer to attribute */
+                    if (WXMLLexerNext(lexer, errorMsg,
+                                      errorMsgLen) != WXMLTK_ATTR_VALUE) {
+                        if (lexer->lastToken.type != WXMLTK_ERROR) {
+                            (void) snprintf(errorMsg, errorMsgLen,
+                                            "Syntax error: attribute assign"
+                                            "ment requires value (line %d)",
+                                            lexer->lineNumber);
+                        }
+                        return _readerFail(reader);
+                    }
+                    attr->value = lexer->lastToken.val;
+                    lexer->lastToken.val = NULL;
+
+                    /* Reset identifier marker */
+                    attr = NULL;
+                } else {
+                    (void) snprintf(errorMsg, errorMsgLen,
+                                    "Syntax error: invalid text in element tag "
+                                    "(line %d)", lineNo);
+                    return _readerFail(reader);
+                }
+            }
+            if (type == WXMLTK_ERROR) return _readerFail(reader);
+
+            /* Element definition is complete, process namespacing */
+            elmnt = reader->current;
+            dfltNs = elmnt->namespaceSet;
+            while (dfltNs != NULL) {
+                if (*(dfltNs->prefix) == '\0') break;
+                dfltNs = dfltNs->next;
+            }
+            elmnt->namespace = _assignNS(elmnt, elmnt->name, dfltNs);
+            attr = elmnt->attributes;
+            while (attr != NULL) {
+                attr->namespace = _assignNS(elmnt, attr->name, NULL);
+                attr = attr->next;
+            }
+
+            /* Empty elements deliver the deferred close on the next event */
+            if (type == WXMLTK_EMPTY_ELMNT_TAG_END) reader->pendingEnd = TRUE;
+
+            return (reader->lastEvent = WXMLEVT_ELEMENT_START);
+
+        } else if (type == WXMLTK_CLOSE_ELMNT_TAG_START) {
+            /* Very linear validation sequence for this element */
+            if (reader->current == NULL) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Syntax error: Unexpected end tag "
+                                "encountered (line %d)", lexer->lineNumber);
+                return _readerFail(reader);
+            }
+
+            type = WXMLLexerNext(lexer, errorMsg, errorMsgLen);
+            if (type == WXMLTK_ERROR) return _readerFail(reader);
+            if (type != WXMLTK_IDENTIFIER) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Syntax error: Missing name in closing tag "
+                                "(line %d)", lexer->lineNumber);
+                return _readerFail(reader);
+            }
+            nm = lexer->lastToken.val;
+            elmnt = reader->current;
+            if ((elmnt->namespace == NULL) ||
+                        (*(elmnt->namespace->prefix) == '\0')) {
+                /* Non or default namespace, just the standard name */
+                if (strcmp(nm, elmnt->name) != 0) {
+                    (void) snprintf(errorMsg, errorMsgLen,
+                                    "Syntax error: Unmatched closing tag, "
+                                    "expected </%s> (line %d)", elmnt->name,
+                                    lexer->lineNumber);
+                    return _readerFail(reader);
+                }
+            } else {
+                offset = strlen(elmnt->namespace->prefix);
+                if ((strncmp(nm, elmnt->namespace->prefix, offset) != 0) ||
+                        (nm[offset] != ':') ||
+                        (strcmp(nm + offset + 1, elmnt->name) != 0)) {
+                    (void) snprintf(errorMsg, errorMsgLen,
+                                    "Syntax error: Unmatched closing tag, "
+                                    "expected </%s:%s> (line %d)",
+                                    elmnt->namespace->prefix, elmnt->name,
+                                    lexer->lineNumber);
+                    return _readerFail(reader);
+                }
+            }
+            WXFree(lexer->lastToken.val);
+            lexer->lastToken.val = NULL;
+
+            type = WXMLLexerNext(lexer, errorMsg, errorMsgLen);
+            if (type == WXMLTK_ERROR) return _readerFail(reader);
+            if (type == WXMLTK_EOF) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Syntax error: Missing end of closing "
+                                "tag (line %d)", lexer->lineNumber);
+                return _readerFail(reader);
+            }
+            if (type != WXMLTK_ELMNT_TAG_END) {
+                (void) snprintf(errorMsg, errorMsgLen,
+                                "Syntax error: Extraneous content in closing "
+                                "tag (line %d)", lexer->lineNumber);
+                return _readerFail(reader);
+            }
+
+            if (reader->building) {
+                /* Tree is being retained (promotion), just step up the stack */
+                reader->current = elmnt->parent;
+                reader->depth--;
+                if (reader->current == NULL) lexer->ignoreWhitespace = TRUE;
+            } else {
+                /* Release is deferred so the consumer can see the closure */
+                reader->pendingPop = TRUE;
+            }
+            return (reader->lastEvent = WXMLEVT_ELEMENT_END);
+
+        } else if ((type == WXMLTK_CONTENT) && (reader->current != NULL)) {
+            if (reader->building) {
+                /* Aggregate into the tree exactly as the DOM parser does */
+                if (reader->retainTextFragments) {
+                    if (WXML_AllocateElement(reader->current, NULL, NULL,
+                                             lexer->lastToken.val,
+                                             TRUE) == NULL) goto memfail;
+                }
+                if (reader->current->content == NULL) {
+                    reader->current->content = lexer->lastToken.val;
+                    lexer->lastToken.val = NULL;
+                } else {
+                    tmp = WXMalloc(strlen(reader->current->content) +
+                                       strlen(lexer->lastToken.val) + 1);
+                    if (tmp == NULL) goto memfail;
+                    (void) strcpy(tmp, reader->current->content);
+                    (void) strcat(tmp, lexer->lastToken.val);
+                    WXFree(reader->current->content);
+                    reader->current->content = tmp;
+
+                    WXFree(lexer->lastToken.val);
+                    lexer->lastToken.val = NULL;
+                }
+            } else {
+                /* Hand the fragment off through the event instead */
+                reader->text = lexer->lastToken.val;
+                lexer->lastToken.val = NULL;
+                return (reader->lastEvent = WXMLEVT_CONTENT);
+            }
+
+        } else {
+            /* AFAIK, the lexer will not generate other cases, so... */
+            (void) snprintf(errorMsg, errorMsgLen,
+                            "Syntax error: extraneous content encountered "
+                            "(line %d)", lexer->lineNumber);
+            return _readerFail(reader);
+        }
+    }
+
+memfail:
+    (void) snprintf(errorMsg, errorMsgLen, "%s", _memFail);
+    return _readerFail(reader);
+}
+
+/**
+ * Promote the current element to a fully materialized subtree, consistent
+ * with the WXML_Decode result for the matching fragment.  Only valid when
+ * the reader is positioned on an element start event, consumes up to and
+ * including the matching closing tag.  The returned subtree belongs to the
+ * caller (release with WXML_Destroy) but namespaces inherited from still
+ * open enclosing elements remain owned by the reader, so the subtree should
+ * be processed before the reader is destroyed.
+ *
+ * @param reader The reader instance positioned on an element start event.
+ * @param retainTextFragments If TRUE (non-zero), text fragments are retained
+ *                            in the subtree as described for WXML_Decode.
+ * @param errorMsg External buffer for returning parsing error details.
+ * @param errorMsgLen Length of provided buffer.
+ * @return The detached element subtree or NULL on parse/memory failure.
+ */
+WXMLElement *WXML_ReaderPromote(WXMLReader *reader, int retainTextFragments,
+                                char *errorMsg, int errorMsgLen) {
+    WXMLElement *subtree = reader->current;
+    int parentDepth;
+
+    /* Promotion is only possible while positioned on an element open */
+    if ((reader->lastEvent != WXMLEVT_ELEMENT_START) || (subtree == NULL)) {
+        (void) snprintf(errorMsg, errorMsgLen,
+                        "Subtree promotion only valid on element open event");
+        return NULL;
+    }
+
+    if (reader->pendingEnd) {
+        /* Empty element, the subtree is already complete */
+        reader->pendingEnd = FALSE;
+        reader->current = subtree->parent;
+        reader->depth--;
+    } else {
+        /* Run the parser in tree-retaining mode until this element closes */
+        reader->building = TRUE;
+        reader->retainTextFragments = retainTextFragments;
+        parentDepth = reader->depth - 1;
+        while (reader->depth != parentDepth) {
+            if (WXML_ReaderNext(reader, errorMsg,
+                                errorMsgLen) == WXMLEVT_ERROR) {
+                reader->building = FALSE;
+                return NULL;
+            }
+        }
+        reader->building = FALSE;
+    }
+
+    /* Detach the completed subtree from the open element chain */
+    if (reader->current != NULL) {
+        reader->current->children = reader->current->lastChild = NULL;
+    } else {
+        reader->lexer->ignoreWhitespace = TRUE;
+    }
+    subtree->parent = NULL;
+    reader->lastEvent = WXMLEVT_ELEMENT_END;
+
+    return subtree;
+}
+
+/**
+ * Release the internal state of the reader, including any still-open
+ * element chain (for abandoned parses).  Does not release the reader itself.
+ *
+ * @param reader The reader instance to be destroyed.
+ */
+void WXML_ReaderDestroy(WXMLReader *reader) {
+    WXMLElement *root = reader->current;
+
+    if (reader->text != NULL) {
+        WXFree(reader->text);
+        reader->text = NULL;
+    }
+    if (root != NULL) {
+        while (root->parent != NULL) root = root->parent;
+        WXML_Destroy(root);
+        reader->current = NULL;
+    }
+    if (reader->lexer != NULL) {
+        if (reader->lexer->lastToken.val != NULL) {
+            WXFree(reader->lexer->lastToken.val);
+        }
+        WXMLLexerDestroy(reader->lexer);
+        WXFree(reader->lexer);
+        reader->lexer = NULL;
+    }
+}
+
 /* Comparator functions for canonical namespace/attribute sorting */
 static int _nsCompar(const void *a, const void *b) {
     WXMLNamespace *org = *((WXMLNamespace **) a);
@@ -1340,6 +1953,14 @@ void WXML_Destroy(WXMLElement *root) {
     WXMLNamespace *ns = root->namespaceSet, *nextNs;
     WXMLAttribute *attr = root->attributes, *nextAttr;
     WXMLElement *child = root->children, *nextChild;
+    WXArena *arena = root->arena;
+
+    /* Arena-backed documents release everything in a single teardown */
+    if (arena != NULL) {
+        WXArena_Destroy(arena);
+        WXFree(arena);
+        return;
+    }
 
     /* Recursively deal with children (do this first due to NS climbing) */
     while (child != NULL) {
@@ -81,6 +81,9 @@ typedef struct WXMLElement {
 
     /* Amalgamation of all content fragments found within the element */
     char *content;
+
+    /* For arena-backed documents (root element only), the owning allocator */
+    WXArena *arena;
 } WXMLElement;
 
 /**
@@ -153,6 +156,126 @@ WXMLAttribute *WXML_AllocateAttribute(WXMLElement *elmnt, const char *name,
 WXMLElement *WXML_Decode(const char *content, int retainTextFragments,
                          char *errorMsg, int errorMsgLen);
 
+/**
+ * Identical parsing to the above, except that all nodes and retained text
+ * for the document are allocated from a single growable memory arena owned
+ * by the root element.  The resulting tree is fully usable with the find,
+ * encoding and canonicalization methods, but must not be structurally
+ * modified or spliced into other documents, and WXML_Destroy releases the
+ * entire parse in a single arena teardown instead of a node-by-node free.
+ * Intended for very large read-only documents where the per-node release
+ * cost is prohibitive.
+ *
+ * @param content The XML document/content to be parsed.
+ * @param retainTextFragments If TRUE (non-zero), text fragments are retained
+ *                            (NULL-named children) and consolidated in parent
+ *                            element.  If FALSE, only consolidated content is
+ *                            captured.
+ * @param errorMsg External buffer for returning parsing error details.
+ * @param errorMsgLen Length of provided buffer.
+ * @return The document root instance, or NULL on parsing or memory failure.
+ */
+WXMLElement *WXML_DecodeArena(const char *content, int retainTextFragments,
+                              char *errorMsg, int errorMsgLen);
+
+/* Event codes returned from the streaming pull parser (reader) */
+typedef enum {
+    /* Parsing error was encountered, details in the provided buffer */
+    WXMLEVT_ERROR = -1,
+
+    /* Initial reader state, never returned from the next-event method */
+    WXMLEVT_DOC_START = 0,
+
+    /* Opening tag completed, current element carries attributes/namespaces */
+    WXMLEVT_ELEMENT_START = 1,
+
+    /* Text/CDATA fragment encountered, value found in the text element */
+    WXMLEVT_CONTENT = 2,
+
+    /* Element has closed, current still references the closing element */
+    WXMLEVT_ELEMENT_END = 3,
+
+    /* End of the document has been (validly) reached */
+    WXMLEVT_DOC_END = 4
+} WXMLEventType;
+
+/**
+ * Streaming pull-parser instance, an alternative to WXML_Decode for
+ * processing large documents with memory bounded by element depth instead
+ * of document size.  Only the chain of currently open elements (with
+ * attribute and namespace details) is materialized, text content is handed
+ * off through events instead of being aggregated into the elements.
+ */
+typedef struct WXMLReader {
+    /* Internal lexing state for the source document (see xmlint.h) */
+    struct WXMLLexer *lexer;
+
+    /* The innermost open element, the subject of start/end events */
+    WXMLElement *current;
+
+    /* Text fragment for content events, valid until the next event */
+    char *text;
+
+    /* Current element nesting depth (number of open elements) */
+    int depth;
+
+    /* Most recent event returned from the reader */
+    WXMLEventType lastEvent;
+
+    /* Internal parsing state details */
+    int pendingEnd, pendingPop, seenRoot, building, retainTextFragments;
+} WXMLReader;
+
+/**
+ * Initialize a pull-parsing reader instance against the provided document.
+ *
+ * @param reader Reference to the reader instance to be initialized.
+ * @param content The XML document/content to be parsed.
+ * @return TRUE if the reader initialized, FALSE on memory allocation failure.
+ */
+int WXML_ReaderInit(WXMLReader *reader, const char *content);
+
+/**
+ * Obtain the next parsing event from the reader.  For element start events,
+ * the current element exposes the tag name, namespaces and attributes (but
+ * not content or children, unless promoted).  Elements are released as they
+ * close, any retained references are invalid after the subsequent call.
+ *
+ * @param reader The reader instance to pull the next event from.
+ * @param errorMsg External buffer for returning parsing error details.
+ * @param errorMsgLen Length of provided buffer.
+ * @return The parsing event, WXMLEVT_ERROR/WXMLEVT_DOC_END are terminal.
+ */
+WXMLEventType WXML_ReaderNext(WXMLReader *reader, char *errorMsg,
+                              int errorMsgLen);
+
+/**
+ * Promote the current element to a fully materialized subtree, consistent
+ * with the WXML_Decode result for the matching fragment.  Only valid when
+ * the reader is positioned on an element start event, consumes up to and
+ * including the matching closing tag.  The returned subtree belongs to the
+ * caller (release with WXML_Destroy) but namespaces inherited from still
+ * open enclosing elements remain owned by the reader, so the subtree should
+ * be processed before the reader is destroyed.
+ *
+ * @param reader The reader instance positioned on an element start event.
+ * @param retainTextFragments If TRUE (non-zero), text fragments are retained
+ *                            in the subtree as described for WXML_Decode.
+ * @param errorMsg External buffer for returning parsing error details.
+ * @param errorMsgLen Length of provided buffer.
+ * @return The detached element subtree or NULL on parse/memory failure.
+ */
+WXMLElement *WXML_ReaderPromote(WXMLReader *reader, int retainTextFragments,
+                                char *errorMsg, int errorMsgLen);
+
+/**
+ * Release the internal state of the reader, including any still-open
+ * element chain (for abandoned parses).  Does not release the reader itself.
+ *
+ * @param reader The reader instance to be destroyed.
+ */
+void WXML_ReaderDestroy(WXMLReader *reader);
+
 /**
  * Converse to the above, translate the XML document to text format.
  *
@@ -209,7 +332,9 @@ void *WXML_Find(WXMLElement *root, const char *path, int descendant);
 /**
  * Destroy/release the contents of the provided node/document (and all nested
  * content).  This method will also free the value itself (consistent with
- * the allocated return from the parse method).
+ * the allocated return from the parse method).  For arena-backed documents
+ * (from WXML_DecodeArena), this is a single release of the entire arena and
+ * is only valid against the root element of the parse.
  *
  * @param root The XML node/tree to be destroyed/freed.
  */
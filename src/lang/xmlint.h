@@ -41,7 +41,7 @@ typedef struct {
 } WXMLToken;
 
 /* And the corresponding lexical tracking object for parsing content */
-typedef struct {
+typedef struct WXMLLexer {
     const char *content;
     unsigned int offset, lineNumber;
     int ignoreWhitespace, inElementTag;
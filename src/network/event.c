@@ -7,16 +7,20 @@
  */
 #include "event.h"
 #include "socket.h"
+#include "hash.h"
 #include "mem.h"
+#include "stats.h"
 #include <errno.h>
 
 /*
  * Decision tree up front, to determine exactly what underlying system will
- * be used to implement the eventing interface.  Currently supports epoll, poll
- * and select (last for Windows).  Someday could include kqueue and Solaris
- * support, although the latter is Oracle now...
+ * be used to implement the eventing interface.  Currently supports io_uring
+ * (build opt-in), epoll, poll and select (last for Windows).  Someday could
+ * include kqueue and Solaris support, although the latter is Oracle now...
  */
-#if defined(HAVE_SYS_EPOLL_H)
+#if defined(WXEVENT_ENABLE_IO_URING) && defined(HAVE_LINUX_IO_URING_H)
+#define WXEVENT_USE_IO_URING
+#elif defined(HAVE_SYS_EPOLL_H)
 #define WXEVENT_USE_EPOLL
 #elif defined(HAVE_POLL_H)
 #define WXEVENT_USE_POLL
@@ -24,6 +28,13 @@
 #define WXEVENT_USE_SELECT
 #endif
 
+#ifdef WXEVENT_USE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
 #ifdef WXEVENT_USE_EPOLL
 #include <sys/epoll.h>
 #endif
@@ -35,6 +46,51 @@
 #define WXEVENT_STRUCT WXEvent
 static size_t evtStructSize = sizeof(WXEVENT_STRUCT);
 
+/* Hashed timer wheel sizing, 16ms ticks over 256 slots (~4s revolution) */
+#define WXEVENT_TIMER_TICK_MS 16
+#define WXEVENT_TIMER_WHEEL_SIZE 256
+
+#ifdef WXEVENT_USE_IO_URING
+/* Fixed submission queue sizing for the ring instance */
+#define WXEVENT_URING_QUEUE_DEPTH 256
+
+/* Deferred kernel submission intent, flushed in one enter call per wait */
+typedef struct WXEventRingOp {
+    uint8_t opcode;
+    uint32_t socketHandle;
+    uint32_t pollMask;
+} WXEventRingOp;
+
+/* Thin syscall wrappers, the raw interface avoids a liburing dependency */
+static int ioUringSetup(unsigned int entries, struct io_uring_params *params) {
+    return (int) syscall(__NR_io_uring_setup, entries, params);
+}
+static int ioUringEnter(int ringFd, unsigned int toSubmit,
+                        unsigned int minComplete, unsigned int flags,
+                        void *arg, size_t argSize) {
+    return (int) syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete,
+                         flags, arg, argSize);
+}
+#endif
+
+/* Tracking record for a registered timer instance */
+typedef struct WXEventTimer {
+    /* Allocated identifier, returned on registration/used for cancel */
+    uint32_t id;
+
+    /* Absolute expiration time (milliseconds) and rearm period (0 for
+     * one-shot instances) */
+    int64_t expiry;
+    uint32_t period;
+
+    /* Associated data object, returned with the expiration event */
+    WXEvent_UserData userData;
+
+    /* Current wheel residence and neighbours, for constant-time removal */
+    size_t slot;
+    struct WXEventTimer *prev, *next;
+} WXEventTimer;
+
 /* Internal definition of the event registry object (system dependent) */
 struct WXEvent_Registry {
     /* Common to all, the dynamic buffer of event registrations */
@@ -42,7 +98,34 @@ struct WXEvent_Registry {
     WXEVENT_STRUCT *entries;
     size_t allocEntryCount, entryCount;
 
+    /* Lazily allocated result array for the registry-sized batch waits */
+    WXEVENT_STRUCT *waitEvents;
+    size_t waitAllocCount;
+
+    /* Hashed timer wheel, with id-based lookup table for cancellation */
+    WXEventTimer *timerWheel[WXEVENT_TIMER_WHEEL_SIZE];
+    WXHashTable timerTable;
+    size_t timerCount;
+    uint32_t nextTimerId;
+    int64_t lastTimerTick;
+
     /* Implementation specific details */
+#ifdef WXEVENT_USE_IO_URING
+    /* Ring descriptor and the mapped submission/completion structures */
+    int ringFd;
+    void *sqRing, *cqRing;
+    size_t sqRingSize, cqRingSize;
+    uint32_t *sqHead, *sqTail, *sqMask, *sqArray;
+    uint32_t *cqHead, *cqTail, *cqMask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    uint32_t sqEntryCount;
+
+    /* Userspace overflow of submission intents awaiting ring space */
+    WXEventRingOp *pendingOps;
+    size_t pendingOpStart, pendingOpCount, allocPendingOpCount;
+#endif
+
 #ifdef WXEVENT_USE_EPOLL
     int epollFd;
 #endif
@@ -83,6 +166,90 @@ int WXEvent_CreateRegistry(size_t size, WXEvent_Registry **registryRef) {
     }
     reg->allocEntryCount = size;
     reg->entryCount = 0;
+    reg->waitEvents = NULL;
+    reg->waitAllocCount = 0;
+
+#ifdef WXEVENT_USE_IO_URING
+    struct io_uring_params params;
+
+    (void) memset(&params, 0, sizeof(params));
+    reg->ringFd = ioUringSetup(WXEVENT_URING_QUEUE_DEPTH, &params);
+    if (reg->ringFd < 0) {
+        WXFree(reg->entries);
+        WXFree(reg);
+        return WXNRC_SYS_ERROR;
+    }
+
+    /* Map the ring structures, modern kernels share a single mapping */
+    reg->sqRingSize = params.sq_off.array +
+                          params.sq_entries * sizeof(uint32_t);
+    reg->cqRingSize = params.cq_off.cqes +
+                          params.cq_entries * sizeof(struct io_uring_cqe);
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+        if (reg->cqRingSize > reg->sqRingSize)
+            reg->sqRingSize = reg->cqRingSize;
+        reg->cqRingSize = reg->sqRingSize;
+    }
+    reg->sqRing = mmap(NULL, reg->sqRingSize, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, reg->ringFd,
+                       IORING_OFF_SQ_RING);
+    if (reg->sqRing == MAP_FAILED) {
+        close(reg->ringFd);
+        WXFree(reg->entries);
+        WXFree(reg);
+        return WXNRC_SYS_ERROR;
+    }
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+        reg->cqRing = reg->sqRing;
+    } else {
+        reg->cqRing = mmap(NULL, reg->cqRingSize, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, reg->ringFd,
+                           IORING_OFF_CQ_RING);
+        if (reg->cqRing == MAP_FAILED) {
+            (void) munmap(reg->sqRing, reg->sqRingSize);
+            close(reg->ringFd);
+            WXFree(reg->entries);
+            WXFree(reg);
+            return WXNRC_SYS_ERROR;
+        }
+    }
+    reg->sqes = (struct io_uring_sqe *)
+            mmap(NULL, params.sq_entries * sizeof(struct io_uring_sqe),
+                 PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                 reg->ringFd, IORING_OFF_SQES);
+    if (reg->sqes == MAP_FAILED) {
+        if (reg->cqRing != reg->sqRing)
+            (void) munmap(reg->cqRing, reg->cqRingSize);
+        (void) munmap(reg->sqRing, reg->sqRingSize);
+        close(reg->ringFd);
+        WXFree(reg->entries);
+        WXFree(reg);
+        return WXNRC_SYS_ERROR;
+    }
+
+    /* Wire up the various ring access points */
+    reg->sqHead = (uint32_t *) (((uint8_t *) reg->sqRing) +
+                                    params.sq_off.head);
+    reg->sqTail = (uint32_t *) (((uint8_t *) reg->sqRing) +
+                                    params.sq_off.tail);
+    reg->sqMask = (uint32_t *) (((uint8_t *) reg->sqRing) +
+                                    params.sq_off.ring_mask);
+    reg->sqArray = (uint32_t *) (((uint8_t *) reg->sqRing) +
+                                     params.sq_off.array);
+    reg->cqHead = (uint32_t *) (((uint8_t *) reg->cqRing) +
+                                    params.cq_off.head);
+    reg->cqTail = (uint32_t *) (((uint8_t *) reg->cqRing) +
+                                    params.cq_off.tail);
+    reg->cqMask = (uint32_t *) (((uint8_t *) reg->cqRing) +
+                                    params.cq_off.ring_mask);
+    reg->cqes = (struct io_uring_cqe *) (((uint8_t *) reg->cqRing) +
+                                             params.cq_off.cqes);
+    reg->sqEntryCount = params.sq_entries;
+
+    reg->pendingOps = NULL;
+    reg->pendingOpStart = reg->pendingOpCount = 0;
+    reg->allocPendingOpCount = 0;
+#endif
 
 #ifdef WXEVENT_USE_EPOLL
     reg->epollFd = epoll_create1(EPOLL_CLOEXEC);
@@ -102,6 +269,23 @@ int WXEvent_CreateRegistry(size_t size, WXEvent_Registry **registryRef) {
     }
 #endif
 
+    /* Timer wheel starts empty, aligned to the current tick */
+    (void) memset(reg->timerWheel, 0, sizeof(reg->timerWheel));
+    if (!WXHash_InitTable(&(reg->timerTable), 64)) {
+#ifdef WXEVENT_USE_EPOLL
+        close(reg->epollFd);
+#endif
+#ifdef WXEVENT_USE_POLL
+        WXFree(reg->fds);
+#endif
+        WXFree(reg->entries);
+        WXFree(reg);
+        return WXNRC_MEM_ERROR;
+    }
+    reg->timerCount = 0;
+    reg->nextTimerId = 0;
+    reg->lastTimerTick = WXSocket_MilliTime() / WXEVENT_TIMER_TICK_MS;
+
     /* Note sure why someone would allocate but not track, but just in case */
     if (registryRef != NULL) *registryRef = reg;
     return WXNRC_OK;
@@ -133,11 +317,93 @@ static WXEVENT_STRUCT *findEventEntry(WXEvent_Registry *registry,
 }
 
 /* Translation routines between the various flagsets */
+#ifdef WXEVENT_USE_IO_URING
+static uint32_t txlateEvents(uint32_t src) {
+    uint32_t retval = 0;
+    if ((src & WXEVENT_IN) != 0) retval |= POLLIN;
+    if ((src & WXEVENT_OUT) != 0) retval |= POLLOUT;
+    return retval;
+}
+
+/* Append a submission intent to the userspace queue, flushed on wait */
+static int queueRingOp(WXEvent_Registry *registry, uint8_t opcode,
+                       uint32_t socketHandle, uint32_t pollMask) {
+    size_t allocCount = registry->allocPendingOpCount;
+    WXEventRingOp *ops;
+
+    /* Compact or expand the queue for room, as appropriate */
+    if (registry->pendingOpStart + registry->pendingOpCount >= allocCount) {
+        if (registry->pendingOpStart != 0) {
+            (void) memmove(registry->pendingOps,
+                           registry->pendingOps + registry->pendingOpStart,
+                           registry->pendingOpCount * sizeof(WXEventRingOp));
+            registry->pendingOpStart = 0;
+        }
+        if (registry->pendingOpCount >= allocCount) {
+            allocCount = (allocCount == 0) ? 64 : (allocCount << 1);
+            ops = (WXEventRingOp *) WXRealloc(registry->pendingOps,
+                                              allocCount *
+                                                  sizeof(WXEventRingOp));
+            if (ops == NULL) return WXNRC_MEM_ERROR;
+            registry->pendingOps = ops;
+            registry->allocPendingOpCount = allocCount;
+        }
+    }
+
+    ops = registry->pendingOps + registry->pendingOpStart +
+                                     registry->pendingOpCount;
+    ops->opcode = opcode;
+    ops->socketHandle = socketHandle;
+    ops->pollMask = pollMask;
+    registry->pendingOpCount++;
+
+    return WXNRC_OK;
+}
+
+/* Fill available submission slots from the pending queue, returns count */
+static unsigned int flushRingOps(WXEvent_Registry *registry) {
+    uint32_t head = __atomic_load_n(registry->sqHead, __ATOMIC_ACQUIRE);
+    uint32_t tail = *(registry->sqTail), mask = *(registry->sqMask);
+    unsigned int submitCount = 0;
+    struct io_uring_sqe *sqe;
+    WXEventRingOp *op;
+
+    while ((registry->pendingOpCount != 0) &&
+               (tail - head < registry->sqEntryCount)) {
+        op = registry->pendingOps + registry->pendingOpStart;
+        sqe = registry->sqes + (tail & mask);
+        (void) memset(sqe, 0, sizeof(struct io_uring_sqe));
+        sqe->opcode = op->opcode;
+        if (op->opcode == IORING_OP_POLL_ADD) {
+            sqe->fd = (int) op->socketHandle;
+            sqe->poll32_events = op->pollMask;
+        } else {
+            /* Removal targets the user_data of the outstanding poll */
+            sqe->fd = -1;
+            sqe->addr = (uint64_t) op->socketHandle;
+        }
+        sqe->user_data = (uint64_t) op->socketHandle;
+        registry->sqArray[tail & mask] = tail & mask;
+        tail++; submitCount++;
+
+        registry->pendingOpStart++;
+        registry->pendingOpCount--;
+    }
+    if (registry->pendingOpCount == 0) registry->pendingOpStart = 0;
+
+    if (submitCount != 0) {
+        __atomic_store_n(registry->sqTail, tail, __ATOMIC_RELEASE);
+    }
+    return submitCount;
+}
+#endif
+
 #ifdef WXEVENT_USE_EPOLL
 static uint32_t txlateEvents(uint32_t src) {
     uint32_t retval = 0;
     if ((src & WXEVENT_IN) != 0) retval |= EPOLLIN;
     if ((src & WXEVENT_OUT) != 0) retval |= EPOLLOUT;
+    if ((src & WXEVENT_EDGE) != 0) retval |= EPOLLET;
     return retval;
 }
 #endif
@@ -219,6 +485,14 @@ int WXEvent_RegisterEvent(WXEvent_Registry *registry, uint32_t socketHandle,
         if (entry->socketHandle > socketHandle) break;
     }
 
+#ifdef WXEVENT_USE_IO_URING
+    /* Queue the poll arm, submitted in bulk on the next wait pass */
+    if (queueRingOp(registry, IORING_OP_POLL_ADD, socketHandle,
+                    txlateEvents(events)) != WXNRC_OK) {
+        return WXNRC_MEM_ERROR;
+    }
+#endif
+
     /* Build the entry, with system elements */
     src.socketHandle = socketHandle;
     src.events = events;
@@ -265,13 +539,30 @@ int WXEvent_UpdateEvent(WXEvent_Registry *registry, uint32_t socketHandle,
     WXEVENT_STRUCT *entry = findEventEntry(registry, socketHandle);
     if (entry == NULL) return WXNRC_DATA_ERROR;
 
+#ifdef WXEVENT_USE_IO_URING
+    /* Only touch the ring when the underlying poll mask actually changes,
+     * cancelling the outstanding arm and queueing its replacement */
+    if (txlateEvents(events) != txlateEvents(entry->events)) {
+        if ((queueRingOp(registry, IORING_OP_POLL_REMOVE, socketHandle,
+                         0) != WXNRC_OK) ||
+                (queueRingOp(registry, IORING_OP_POLL_ADD, socketHandle,
+                             txlateEvents(events)) != WXNRC_OK)) {
+            return WXNRC_MEM_ERROR;
+        }
+    }
+#endif
+
 #ifdef WXEVENT_USE_EPOLL
-    (void) memset(&evt, 0, sizeof(evt));
-    evt.events = txlateEvents(events);
-    evt.data.fd = entry->socketHandle;
-    if (epoll_ctl(registry->epollFd, EPOLL_CTL_MOD, (int) entry->socketHandle,
-                  &evt) < 0) {
-        return WXNRC_SYS_ERROR;
+    /* Only bother the kernel when the underlying interest actually changes,
+     * which for edge-triggered registrations is essentially never */
+    if (txlateEvents(events) != txlateEvents(entry->events)) {
+        (void) memset(&evt, 0, sizeof(evt));
+        evt.events = txlateEvents(events);
+        evt.data.fd = entry->socketHandle;
+        if (epoll_ctl(registry->epollFd, EPOLL_CTL_MOD,
+                      (int) entry->socketHandle, &evt) < 0) {
+            return WXNRC_SYS_ERROR;
+        }
     }
 #endif
 
@@ -302,6 +593,14 @@ int WXEvent_UnregisterEvent(WXEvent_Registry *registry, uint32_t socketHandle) {
     WXEVENT_STRUCT *entry = findEventEntry(registry, socketHandle);
     if (entry == NULL) return WXNRC_DATA_ERROR;
 
+#ifdef WXEVENT_USE_IO_URING
+    /* Cancel the outstanding poll arm (completion quietly discarded) */
+    if (queueRingOp(registry, IORING_OP_POLL_REMOVE, socketHandle,
+                    0) != WXNRC_OK) {
+        return WXNRC_MEM_ERROR;
+    }
+#endif
+
 #ifdef WXEVENT_USE_EPOLL
     /* Note, should be NULL but kernel < 2.6.9 has a bug... */
     (void) memset(&evt, 0, sizeof(evt));
@@ -326,6 +625,171 @@ int WXEvent_UnregisterEvent(WXEvent_Registry *registry, uint32_t socketHandle) {
     return WXNRC_OK;
 }
 
+/* Key management methods for the timer identifier lookup table */
+static unsigned int timerIdHashFn(void *key) {
+    return ((unsigned int) (uintptr_t) key) * 2654435761U;
+}
+static int timerIdEqualsFn(void *keya, void *keyb) {
+    return (keya == keyb);
+}
+
+/* Thread a timer onto the wheel slot matching its expiration tick */
+static void insertTimer(WXEvent_Registry *registry, WXEventTimer *timer) {
+    /* Round the target tick up, so the sweep only reaches the residence
+     * slot once the expiry time has actually passed (a floor here lets the
+     * sweep skip a not-quite-due timer for an entire wheel revolution) */
+    int64_t tick = (timer->expiry + WXEVENT_TIMER_TICK_MS - 1) /
+                                        WXEVENT_TIMER_TICK_MS;
+    size_t slot;
+
+    /* Never behind the sweep position, next pass would be a revolution out */
+    if (tick <= registry->lastTimerTick) tick = registry->lastTimerTick + 1;
+    slot = ((size_t) tick) & (WXEVENT_TIMER_WHEEL_SIZE - 1);
+
+    timer->slot = slot;
+    timer->prev = NULL;
+    timer->next = registry->timerWheel[slot];
+    if (timer->next != NULL) timer->next->prev = timer;
+    registry->timerWheel[slot] = timer;
+}
+
+/* Counterpart removal, constant time through the neighbour links */
+static void unlinkTimer(WXEvent_Registry *registry, WXEventTimer *timer) {
+    if (timer->prev != NULL) timer->prev->next = timer->next;
+    else registry->timerWheel[timer->slot] = timer->next;
+    if (timer->next != NULL) timer->next->prev = timer->prev;
+}
+
+/**
+ * Register a timer against the registry, to be delivered through the wait()
+ * result array alongside the socket events (marked with WXEVENT_TIMER and
+ * carrying the returned identifier in the socketHandle field).  Timers are
+ * tracked in a hashed wheel, so registration, cancellation and per-tick
+ * scheduling are all constant-time regardless of the timer population.
+ * Expirations are quantized to the internal wheel tick (tens of
+ * milliseconds), this is a bulk connection-management facility and not a
+ * high-resolution interval timer.
+ *
+ * @param registry The associated registry for managing events.
+ * @param delayMs Delay until expiration, in milliseconds.
+ * @param periodic If TRUE, the timer automatically rearms with the same
+ *                 delay after each expiration, until cancelled.  If FALSE,
+ *                 the timer is released after a single expiration.
+ * @param userData Associated data element to return with the expiration.
+ * @return The positive timer identifier (for cancellation/correlation) or
+ *         WXNRC_MEM_ERROR on an allocation failure.
+ */
+ssize_t WXEvent_RegisterTimer(WXEvent_Registry *registry, uint32_t delayMs,
+                              int periodic, WXEvent_UserData userData) {
+    WXEventTimer *timer;
+    uint32_t id;
+
+    timer = (WXEventTimer *) WXMalloc(sizeof(WXEventTimer));
+    if (timer == NULL) return WXNRC_MEM_ERROR;
+
+    /* Allocate the next free identifier (wraparound-safe, zero reserved) */
+    do {
+        id = ++(registry->nextTimerId);
+    } while ((id == 0) ||
+                 (WXHash_GetEntry(&(registry->timerTable),
+                                  (void *) (uintptr_t) id, timerIdHashFn,
+                                  timerIdEqualsFn) != NULL));
+
+    timer->id = id;
+    timer->expiry = WXSocket_MilliTime() + delayMs;
+    timer->period = (periodic) ? delayMs : 0;
+    timer->userData = userData;
+    if (!WXHash_InsertEntry(&(registry->timerTable), (void *) (uintptr_t) id,
+                            timer, NULL, NULL, timerIdHashFn,
+                            timerIdEqualsFn)) {
+        WXFree(timer);
+        return WXNRC_MEM_ERROR;
+    }
+    insertTimer(registry, timer);
+    registry->timerCount++;
+
+    return (ssize_t) id;
+}
+
+/**
+ * Cancel a previously registered timer instance.  One-shot timers that have
+ * already expired are released automatically and do not need to be cancelled.
+ *
+ * @param registry The associated registry for managing events.
+ * @param timerId The timer identifier returned from the registration call.
+ * @return WXNRC_OK on success, WXNRC_DATA_ERROR for an unrecognized timer.
+ */
+int WXEvent_CancelTimer(WXEvent_Registry *registry, uint32_t timerId) {
+    WXEventTimer *timer;
+
+    timer = (WXEventTimer *) WXHash_GetEntry(&(registry->timerTable),
+                                             (void *) (uintptr_t) timerId,
+                                             timerIdHashFn, timerIdEqualsFn);
+    if (timer == NULL) return WXNRC_DATA_ERROR;
+
+    (void) WXHash_RemoveEntry(&(registry->timerTable),
+                              (void *) (uintptr_t) timerId, NULL, NULL,
+                              timerIdHashFn, timerIdEqualsFn);
+    unlinkTimer(registry, timer);
+    WXFree(timer);
+    registry->timerCount--;
+
+    return WXNRC_OK;
+}
+
+/* Sweep the wheel up to the current tick, emitting expired timer events */
+static ssize_t processExpiredTimers(WXEvent_Registry *registry,
+                                    WXEvent *events, size_t maxEvents) {
+    int64_t now = WXSocket_MilliTime(), tick = now / WXEVENT_TIMER_TICK_MS;
+    WXEventTimer *timer, *next;
+    ssize_t retCount = 0;
+    int64_t tk, tkLimit;
+
+    if (registry->timerCount == 0) {
+        registry->lastTimerTick = tick;
+        return 0;
+    }
+
+    /* After a long stall, one revolution covers every slot exactly once */
+    tkLimit = registry->lastTimerTick + WXEVENT_TIMER_WHEEL_SIZE;
+    if (tkLimit > tick) tkLimit = tick;
+
+    for (tk = registry->lastTimerTick + 1; tk <= tkLimit; tk++) {
+        timer = registry->timerWheel[((size_t) tk) &
+                                         (WXEVENT_TIMER_WHEEL_SIZE - 1)];
+        while (timer != NULL) {
+            next = timer->next;
+            if (timer->expiry <= now) {
+                /* Out of room, remainder picked up on the next wait pass */
+                if (maxEvents == 0) return retCount;
+
+                unlinkTimer(registry, timer);
+                events->socketHandle = timer->id;
+                events->events = WXEVENT_TIMER;
+                events->userData = timer->userData;
+                events++; maxEvents--; retCount++;
+
+                if (timer->period != 0) {
+                    /* Rearm, skipping any expirations missed in a stall */
+                    while (timer->expiry <= now) timer->expiry += timer->period;
+                    insertTimer(registry, timer);
+                } else {
+                    (void) WXHash_RemoveEntry(&(registry->timerTable),
+                                              (void *) (uintptr_t) timer->id,
+                                              NULL, NULL, timerIdHashFn,
+                                              timerIdEqualsFn);
+                    WXFree(timer);
+                    registry->timerCount--;
+                }
+            }
+            timer = next;
+        }
+        registry->lastTimerTick = tk;
+    }
+
+    return retCount;
+}
+
 /* Need a sorting method for epoll ordering handling below */
 #ifdef WXEVENT_USE_EPOLL
 int qsortEpollEvt(const void *a, const void *b) {
@@ -357,165 +821,295 @@ int qsortEpollEvt(const void *a, const void *b) {
  */
 ssize_t WXEvent_Wait(WXEvent_Registry *registry, WXEvent *events,
                      size_t maxEvents, int32_t *timeoutRef) {
-    ssize_t retCount = 0;
     int64_t startTime = WXSocket_MilliTime();
+    int32_t waitTimeout;
+    ssize_t retCount;
+
+    WXSTATS_INCR(eventWaits);
+
+#ifdef WXEVENT_USE_IO_URING
+    struct io_uring_getevents_arg getArg;
+    struct __kernel_timespec waitTs;
+    struct io_uring_cqe *cqe;
+    WXEVENT_STRUCT *entry;
+    uint32_t cqHead, cqTail, revts, evts;
+    unsigned int submitCount;
+    int rc;
+#endif
 
 #ifdef WXEVENT_USE_EPOLL
     struct epoll_event *epevt;
     WXEvent *pevt, *rpevt, evt;
     uint32_t socketFd, evts, revts;
+#endif
 
-    /* This optimization relies on WXEvent being bigger than epoll_event! */
-    if (timeoutRef == NULL) {
-        retCount = epoll_wait(registry->epollFd, (struct epoll_event *) events,
-                              maxEvents, -1);
-    } else {
+#ifdef WXEVENT_USE_POLL
+    struct pollfd *fds;
+    WXEVENT_STRUCT *entry;
+    uint32_t revents, evt;
+    int32_t rc, idx;
+#endif
+
+#ifdef WXEVENT_USE_SELECT
+    int32_t rc, fd, idx, maxSelectFd;
+    fd_set readSet, writeSet, exceptionSet;
+    WXEVENT_STRUCT *entry;
+    struct timeval tv;
+    uint32_t evt;
+#endif
+
+    while (TRUE) {
+        retCount = 0;
+
+        /* Remaining caller timeout, clamped to the tick while timers pend
+         * (negative indicates a fully synchronous/untimed wait) */
+        waitTimeout = (timeoutRef == NULL) ? -1 :
+                (int32_t) (*timeoutRef - (WXSocket_MilliTime() - startTime));
+        if ((timeoutRef != NULL) && (waitTimeout < 0)) waitTimeout = 0;
+        if ((registry->timerCount != 0) &&
+                ((waitTimeout < 0) || (waitTimeout > WXEVENT_TIMER_TICK_MS))) {
+            waitTimeout = WXEVENT_TIMER_TICK_MS;
+        }
+
+#ifdef WXEVENT_USE_IO_URING
+        /* Push the deferred poll arms/cancels in the same kernel entry as
+         * the completion wait, one syscall per loop pass */
+        submitCount = flushRingOps(registry);
+
+        if (waitTimeout < 0) {
+            rc = ioUringEnter(registry->ringFd, submitCount, 1,
+                              IORING_ENTER_GETEVENTS, NULL, 0);
+        } else {
+            (void) memset(&getArg, 0, sizeof(getArg));
+            waitTs.tv_sec = waitTimeout / 1000;
+            waitTs.tv_nsec = ((long long) (waitTimeout % 1000)) * 1000000L;
+            getArg.ts = (uint64_t) (uintptr_t) &waitTs;
+            rc = ioUringEnter(registry->ringFd, submitCount, 1,
+                              IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                              &getArg, sizeof(getArg));
+        }
+        if ((rc < 0) && (errno != ETIME) && (errno != EINTR)) {
+            return WXNRC_SYS_ERROR;
+        }
+
+        /* Drain the available completions, rearming fired registrations
+         * (single-shot poll) and discarding cancellation records */
+        cqHead = *(registry->cqHead);
+        cqTail = __atomic_load_n(registry->cqTail, __ATOMIC_ACQUIRE);
+        while ((cqHead != cqTail) && (retCount < (ssize_t) maxEvents)) {
+            cqe = registry->cqes + (cqHead & *(registry->cqMask));
+            if (cqe->res > 0) {
+                entry = findEventEntry(registry, (uint32_t) cqe->user_data);
+                if (entry != NULL) {
+                    revts = (uint32_t) cqe->res;
+                    evts = 0;
+                    if ((revts & POLLIN) != 0) evts |= WXEVENT_IN;
+                    if ((revts & POLLOUT) != 0) evts |= WXEVENT_OUT;
+                    if ((revts & (POLLERR | POLLHUP)) != 0) evts |= WXEVENT_ERR;
+                    if (evts != 0) {
+                        events[retCount] = *entry;
+                        events[retCount].events = evts;
+                        retCount++;
+                    }
+
+                    if (queueRingOp(registry, IORING_OP_POLL_ADD,
+                                    entry->socketHandle,
+                                    txlateEvents(entry->events)) != WXNRC_OK) {
+                        return WXNRC_MEM_ERROR;
+                    }
+                }
+            }
+            cqHead++;
+        }
+        __atomic_store_n(registry->cqHead, cqHead, __ATOMIC_RELEASE);
+#endif
+
+#ifdef WXEVENT_USE_EPOLL
+        /* Optimization relies on WXEvent being bigger than epoll_event! */
         retCount = epoll_wait(registry->epollFd, (struct epoll_event *) events,
-                              maxEvents, *timeoutRef);
-    }
-    if (retCount < 0) return WXNRC_SYS_ERROR;
-    if (retCount == 0) return WXNRC_TIMEOUT;
-
-    /* Order the entries by fd and reverse scan to match against src events */
-    qsort(events, retCount, sizeof(struct epoll_event), qsortEpollEvt);
-
-    /* And reverse scan the entries, matching to source */
-    pevt = registry->entries + registry->entryCount - 1;
-    epevt = ((struct epoll_event *) events) + retCount - 1;
-    rpevt = events + retCount - 1;
-    while (((void *) epevt >= (void *) events) && (rpevt >= events)) {
-        socketFd = epevt->data.fd;
-        while (pevt->socketHandle > socketFd) pevt--;
-        if (pevt->socketHandle < socketFd) {
-            /* This should not happen, event for unregistered descriptor */
+                              maxEvents, waitTimeout);
+        if (retCount < 0) return WXNRC_SYS_ERROR;
+
+        if (retCount > 0) {
+            /* Order entries by fd and reverse scan to match src events */
+            qsort(events, retCount, sizeof(struct epoll_event), qsortEpollEvt);
+
+            /* And reverse scan the entries, matching to source */
+            pevt = registry->entries + registry->entryCount - 1;
+            epevt = ((struct epoll_event *) events) + retCount - 1;
+            rpevt = events + retCount - 1;
+            while (((void *) epevt >= (void *) events) && (rpevt >= events)) {
+                socketFd = epevt->data.fd;
+                while (pevt->socketHandle > socketFd) pevt--;
+                if (pevt->socketHandle < socketFd) {
+                    /* Should not happen, event for unregistered descriptor */
 #ifdef _WXWIN_BUILD
-            WSASetLastError(EINVAL);
+                    WSASetLastError(EINVAL);
 #else
-            errno = EINVAL;
+                    errno = EINVAL;
 #endif
-            return WXNRC_SYS_ERROR;
+                    return WXNRC_SYS_ERROR;
+                }
+
+                /* Matched, carefully update record and move on */
+                evt.socketHandle = (uint32_t) socketFd;
+                revts = epevt->events;
+                evts = 0;
+                if ((revts & EPOLLIN) != 0) evts |= WXEVENT_IN;
+                if ((revts & EPOLLOUT) != 0) evts |= WXEVENT_OUT;
+                if ((revts & EPOLLERR) != 0) evts |= WXEVENT_ERR;
+                evt.events = evts;
+                evt.userData = pevt->userData;
+
+                *(rpevt--) = evt;
+                epevt--; pevt--;
+            }
         }
-
-        /* Matched, carefully update record and move on */
-        evt.socketHandle = (uint32_t) socketFd;
-        revts = epevt->events;
-        evts = 0;
-        if ((revts & EPOLLIN) != 0) evts |= WXEVENT_IN;
-        if ((revts & EPOLLOUT) != 0) evts |= WXEVENT_OUT;
-        if ((revts & EPOLLERR) != 0) evts |= WXEVENT_ERR;
-        evt.events = evts;
-        evt.userData = pevt->userData;
-
-        *(rpevt--) = evt;
-        epevt--; pevt--;
-    }
 #endif
 
 #ifdef WXEVENT_USE_POLL
-    struct pollfd *fds = registry->fds;
-	WXEVENT_STRUCT *entry;
-    uint32_t revents, evt;
-    int32_t rc, idx;
-
-    /* Just call the target poll method with the preallocated fds array */
-    if (timeoutRef == NULL) {
-        rc = poll(fds, registry->entryCount, -1);
-    } else {
-        rc = poll(fds, registry->entryCount, *timeoutRef);
-    }
-    if (rc < 0) return WXNRC_SYS_ERROR;
-    if (rc == 0) return WXNRC_TIMEOUT;
-
-    /* Translate responses (TODO - rotating responses for subset?) */
-    for (idx = 0, entry = registry->entries;
+        /* Just call the target poll method with the preallocated fds array */
+        fds = registry->fds;
+        rc = poll(fds, registry->entryCount, waitTimeout);
+        if (rc < 0) return WXNRC_SYS_ERROR;
+
+        /* Translate responses (TODO - rotating responses for subset?) */
+        if (rc > 0) {
+            for (idx = 0, entry = registry->entries;
                           idx < registry->entryCount; idx++, entry++, fds++) {
-        revents = fds->revents;
-        evt = 0;
-        if ((revents & POLLIN) != 0) evt |= WXEVENT_IN;
-        if ((revents & POLLOUT) != 0) evt |= WXEVENT_OUT;
-        if ((revents & POLLERR) != 0) evt |= WXEVENT_ERR;
-
-        /* If we have a poll result, it turns into the event */
-        if (evt != 0) {
-            events[retCount] = *entry;
-            events[retCount].events = evt;
-            if (++retCount == maxEvents) break;
+                revents = fds->revents;
+                evt = 0;
+                if ((revents & POLLIN) != 0) evt |= WXEVENT_IN;
+                if ((revents & POLLOUT) != 0) evt |= WXEVENT_OUT;
+                if ((revents & POLLERR) != 0) evt |= WXEVENT_ERR;
+
+                /* If we have a poll result, it turns into the event */
+                if (evt != 0) {
+                    events[retCount] = *entry;
+                    events[retCount].events = evt;
+                    if (++retCount == maxEvents) break;
+                }
+            }
         }
-    }
 #endif
 
 #ifdef WXEVENT_USE_SELECT
-    /* All of the laziness above costs us now... */
-    int32_t rc, fd, idx, maxSelectFd, timeout;
-    fd_set readSet, writeSet, exceptionSet;
-	WXEVENT_STRUCT *entry;
-    struct timeval tv;
-    uint32_t evt;
+        /* All of the laziness above costs us now... */
 
-    /* Build the select markers, capturing overflow */
-    FD_ZERO(&readSet); FD_ZERO(&writeSet); FD_ZERO(&exceptionSet);
-    maxSelectFd = -1;
-    for (idx = 0, entry = registry->entries;
+        /* Build the select markers, capturing overflow */
+        FD_ZERO(&readSet); FD_ZERO(&writeSet); FD_ZERO(&exceptionSet);
+        maxSelectFd = -1;
+        for (idx = 0, entry = registry->entries;
                           idx < registry->entryCount; idx++, entry++) {
-        fd = (int32_t) entry->socketHandle;
-        if ((fd < 0) || ((fd = (int32_t) entry->socketHandle) >= FD_SETSIZE)) {
+            fd = (int32_t) entry->socketHandle;
+            if ((fd < 0) ||
+                    ((fd = (int32_t) entry->socketHandle) >= FD_SETSIZE)) {
 #ifdef _WXWIN_BUILD
-            WSASetLastError(EINVAL);
+                WSASetLastError(EINVAL);
 #else
-            errno = EINVAL;
+                errno = EINVAL;
 #endif
-            /* TODO - individual kaboom instead of global kaboom? */
-            return WXNRC_SYS_ERROR;
+                /* TODO - individual kaboom instead of global kaboom? */
+                return WXNRC_SYS_ERROR;
+            }
+            if (fd > maxSelectFd) maxSelectFd = fd;
+
+            evt = entry->events;
+            if ((evt & WXEVENT_IN) != 0) {
+                FD_SET(fd, &readSet);
+            }
+            if ((evt & WXEVENT_OUT) != 0){
+                FD_SET(fd, &writeSet);
+            }
+            FD_SET(fd, &exceptionSet);
         }
-        if (fd > maxSelectFd) maxSelectFd = fd;
 
-        evt = entry->events;
-        if ((evt & WXEVENT_IN) != 0) {
-            FD_SET(fd, &readSet);
-        }
-        if ((evt & WXEVENT_OUT) != 0){
-            FD_SET(fd, &writeSet);
+        /* Note: Windows select() will fail with no descriptors, don't! */
+
+        /* Perform the appropriate select */
+        if (waitTimeout < 0) {
+            rc = select(maxSelectFd + 1, &readSet, &writeSet, &exceptionSet,
+                        NULL);
+        } else {
+            tv.tv_sec = waitTimeout / 1000;
+            tv.tv_usec = (waitTimeout % 1000) * 1000;
+            rc = select(maxSelectFd + 1, &readSet, &writeSet, &exceptionSet,
+                        &tv);
         }
-        FD_SET(fd, &exceptionSet);
-    }
+        if (rc < 0) return WXNRC_SYS_ERROR;
 
-    /* Note: a Windows select() will fail with no descriptors, don't do that */
+        /* And translate the result */
+        if (rc > 0) {
+            for (idx = 0, entry = registry->entries;
+                          idx < registry->entryCount; idx++, entry++) {
+                fd = entry->socketHandle;
+                evt = 0;
+                if (FD_ISSET(fd, &readSet)) evt |= WXEVENT_IN;
+                if (FD_ISSET(fd, &writeSet)) evt |= WXEVENT_OUT;
+                if (FD_ISSET(fd, &exceptionSet)) evt |= WXEVENT_ERR;
+
+                /* If we have a select result, it turns into the event */
+                if (evt != 0) {
+                    events[retCount] = *entry;
+                    events[retCount].events = evt;
+                    if (++retCount == maxEvents) break;
+                }
+            }
+        }
+#endif
 
-    /* Perform the appropriate select */
-    if (timeoutRef == NULL) {
-        rc = select(maxSelectFd + 1, &readSet, &writeSet, &exceptionSet, NULL);
-    } else {
-        timeout = *timeoutRef;
-        tv.tv_sec = timeout / 1000;
-        tv.tv_usec = (timeout % 1000) * 1000;
-        rc = select(maxSelectFd + 1, &readSet, &writeSet, &exceptionSet, &tv);
-    }
-    if (rc < 0) return WXNRC_SYS_ERROR;
-    if (rc == 0) return WXNRC_TIMEOUT;
+        /* Fold any expired timers into the result set */
+        retCount += processExpiredTimers(registry, events + retCount,
+                                         maxEvents - retCount);
+        if (retCount != 0) break;
 
-    /* And translate the result */
-    for (idx = 0, entry = registry->entries;
-                          idx < registry->entryCount; idx++, entry++) {
-        fd = entry->socketHandle;
-        evt = 0;
-        if (FD_ISSET(fd, &readSet)) evt |= WXEVENT_IN;
-        if (FD_ISSET(fd, &writeSet)) evt |= WXEVENT_OUT;
-        if (FD_ISSET(fd, &exceptionSet)) evt |= WXEVENT_ERR;
-
-        /* If we have a select result, it turns into the event */
-        if (evt != 0) {
-            events[retCount] = *entry;
-            events[retCount].events = evt;
-            if (++retCount == maxEvents) break;
+        /* Nothing anywhere, timed waits expire, synchronous waits resume */
+        if ((timeoutRef != NULL) &&
+                (*timeoutRef - (WXSocket_MilliTime() - startTime) <= 0)) {
+            return WXNRC_TIMEOUT;
         }
     }
 
-#endif
-
     if (timeoutRef != NULL) *timeoutRef -= WXSocket_MilliTime() - startTime;
+    if (retCount > 0) WXSTATS_ADD(eventsDispatched, retCount);
     return retCount;
 }
 
+/**
+ * Perform a wait operation using an internal event array automatically sized
+ * to the full registry, so a single wait call can deliver every pending
+ * occurrence instead of being capped by a caller-sized buffer.  The returned
+ * array is owned by the registry and is only valid until the next wait or
+ * destroy call against it.
+ *
+ * @param registry The associated registry to await events from.
+ * @param eventsRef Pointer through which the internal array of event
+ *                  occurrences is returned.
+ * @param timeoutRef As for the wait() method, NULL for synchronous wait or
+ *                   a millisecond timeout updated with the time remaining.
+ * @return The number of events that are available or a suitable WXNRC_* error
+ *         code (including WXNRC_TIMEOUT if the wait timeout has expired).
+ */
+ssize_t WXEvent_WaitBatch(WXEvent_Registry *registry, WXEvent **eventsRef,
+                          int32_t *timeoutRef) {
+    WXEVENT_STRUCT *waitEvents;
+    size_t count = registry->entryCount;
+
+    /* Track the registration high-water mark (minimum floor as for create) */
+    if (count < 32) count = 32;
+    if (registry->waitAllocCount < count) {
+        waitEvents = (WXEVENT_STRUCT *) WXRealloc(registry->waitEvents,
+                                                  count * evtStructSize);
+        if (waitEvents == NULL) return WXNRC_MEM_ERROR;
+        registry->waitEvents = waitEvents;
+        registry->waitAllocCount = count;
+    }
+
+    *eventsRef = registry->waitEvents;
+    return WXEvent_Wait(registry, registry->waitEvents,
+                        registry->waitAllocCount, timeoutRef);
+}
+
 /**
  * Destroy the provided registry instance, which releases associated system
  * resources and frees all memory allocated for the registry.
@@ -523,14 +1117,39 @@ ssize_t WXEvent_Wait(WXEvent_Registry *registry, WXEvent *events,
  * @param registry The event registry to be destroyed.
  */
 void WXEvent_DestroyRegistry(WXEvent_Registry *registry) {
+    WXEventTimer *timer, *next;
+    size_t slot;
+
+#ifdef WXEVENT_USE_IO_URING
+    (void) munmap(registry->sqes,
+                  registry->sqEntryCount * sizeof(struct io_uring_sqe));
+    if (registry->cqRing != registry->sqRing)
+        (void) munmap(registry->cqRing, registry->cqRingSize);
+    (void) munmap(registry->sqRing, registry->sqRingSize);
+    close(registry->ringFd);
+    if (registry->pendingOps != NULL) WXFree(registry->pendingOps);
+#endif
+
 #ifdef WXEVENT_USE_EPOLL
     close(registry->epollFd);
 #endif
 
+    /* Flush any outstanding timer instances (records are in the wheel) */
+    for (slot = 0; slot < WXEVENT_TIMER_WHEEL_SIZE; slot++) {
+        timer = registry->timerWheel[slot];
+        while (timer != NULL) {
+            next = timer->next;
+            WXFree(timer);
+            timer = next;
+        }
+    }
+    WXHash_Destroy(&(registry->timerTable));
+
 #ifdef WXEVENT_USE_POLL
     WXFree(registry->fds);
 #endif
 
+    if (registry->waitEvents != NULL) WXFree(registry->waitEvents);
     WXFree(registry->entries);
     WXFree(registry);
 }
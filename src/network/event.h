@@ -33,6 +33,22 @@
 /* Special flag for closure/deletion signalling between handlers */
 #define WXEVENT_CLOSE 0x08
 
+/*
+ * Registration modifier for edge-triggered notification (EPOLLET), where the
+ * underlying implementation supports it (epoll only, the poll/select backends
+ * quietly remain level-triggered).  Edge-registered handlers must drain the
+ * socket to EAGAIN on each wakeup, but interest updates become local record
+ * changes instead of kernel calls - a large win for busy registries.
+ */
+#define WXEVENT_EDGE 0x10
+
+/*
+ * Flag indicating a timer expiration record in a wait() result set.  For
+ * these records the socketHandle field carries the timer identifier (from
+ * registration) instead of a socket descriptor.
+ */
+#define WXEVENT_TIMER 0x20
+
 /**
  * Data union for attaching arbitrary user data to an event, for use in
  * wait notification.  Not entirely compliant with the epoll form, just the
@@ -110,6 +126,38 @@ int WXEvent_UpdateEvent(WXEvent_Registry *registry, uint32_t socketHandle,
  */
 int WXEvent_UnregisterEvent(WXEvent_Registry *registry, uint32_t socketHandle);
 
+/**
+ * Register a timer against the registry, to be delivered through the wait()
+ * result array alongside the socket events (marked with WXEVENT_TIMER and
+ * carrying the returned identifier in the socketHandle field).  Timers are
+ * tracked in a hashed wheel, so registration, cancellation and per-tick
+ * scheduling are all constant-time regardless of the timer population.
+ * Expirations are quantized to the internal wheel tick (tens of
+ * milliseconds), this is a bulk connection-management facility and not a
+ * high-resolution interval timer.
+ *
+ * @param registry The associated registry for managing events.
+ * @param delayMs Delay until expiration, in milliseconds.
+ * @param periodic If TRUE, the timer automatically rearms with the same
+ *                 delay after each expiration, until cancelled.  If FALSE,
+ *                 the timer is released after a single expiration.
+ * @param userData Associated data element to return with the expiration.
+ * @return The positive timer identifier (for cancellation/correlation) or
+ *         WXNRC_MEM_ERROR on an allocation failure.
+ */
+ssize_t WXEvent_RegisterTimer(WXEvent_Registry *registry, uint32_t delayMs,
+                              int periodic, WXEvent_UserData userData);
+
+/**
+ * Cancel a previously registered timer instance.  One-shot timers that have
+ * already expired are released automatically and do not need to be cancelled.
+ *
+ * @param registry The associated registry for managing events.
+ * @param timerId The timer identifier returned from the registration call.
+ * @return WXNRC_OK on success, WXNRC_DATA_ERROR for an unrecognized timer.
+ */
+int WXEvent_CancelTimer(WXEvent_Registry *registry, uint32_t timerId);
+
 /**
  * Perform a wait operation for available events against the provided registry,
  * with or without timeout.
@@ -130,6 +178,24 @@ int WXEvent_UnregisterEvent(WXEvent_Registry *registry, uint32_t socketHandle);
 ssize_t WXEvent_Wait(WXEvent_Registry *registry, WXEvent *events,
                      size_t maxEvents, int32_t *timeoutRef);
 
+/**
+ * Perform a wait operation using an internal event array automatically sized
+ * to the full registry, so a single wait call can deliver every pending
+ * occurrence instead of being capped by a caller-sized buffer.  The returned
+ * array is owned by the registry and is only valid until the next wait or
+ * destroy call against it.
+ *
+ * @param registry The associated registry to await events from.
+ * @param eventsRef Pointer through which the internal array of event
+ *                  occurrences is returned.
+ * @param timeoutRef As for the wait() method, NULL for synchronous wait or
+ *                   a millisecond timeout updated with the time remaining.
+ * @return The number of events that are available or a suitable WXNRC_* error
+ *         code (including WXNRC_TIMEOUT if the wait timeout has expired).
+ */
+ssize_t WXEvent_WaitBatch(WXEvent_Registry *registry, WXEvent **eventsRef,
+                          int32_t *timeoutRef);
+
 /**
  * Destroy the provided registry instance, which releases associated system
  * resources and frees all memory allocated for the registry.
@@ -8,6 +8,7 @@
 #include "socket.h"
 
 #include <errno.h>
+#include <time.h>
 #include <sys/types.h>
 #ifndef WIN32
 #include <sys/socket.h>
@@ -18,8 +19,13 @@
 #include <netdb.h>
 #include <fcntl.h>
 #include <poll.h>
+#include <sys/uio.h>
+#ifdef HAVE_SYS_SENDFILE_H
+#include <sys/sendfile.h>
+#endif
 #else
 #include <mstcpip.h>
+#include <mswsock.h>
 #endif
 
 /* Redirect appropriately for the Windows/Unix based network error handling */
@@ -31,23 +37,27 @@
 
 /**
  * Used in various points in the networking code, globalize it.  Returns
- * a consistent millisecond timing amount (not necessarily epoch time) for
- * handling timeout determination.
+ * a consistent millisecond timing amount (not epoch time) for handling
+ * timeout determination.  Monotonic where the platform supports it, so
+ * timeout intervals are immune to wall-clock adjustments.
  */
 int64_t WXSocket_MilliTime() {
 #ifdef _WXWIN_BUILD
-    FILETIME fTime;
-    ULARGE_INTEGER iTime;
+    /* Rollover-safe (64-bit) millisecond tick, monotonic from boot */
+    return (int64_t) GetTickCount64();
+#else
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
 
-    GetSystemTimeAsFileTime(&fTime);
-    (void) memcpy(&iTime, &fTime, sizeof(iTime));
-    return (int64_t) (iTime.QuadPart / 10000LL);
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (((int64_t) ts.tv_sec) * ((int64_t) 1000)) + ts.tv_nsec / 1000000L;
 #else
     struct timeval tv;
 
     (void) gettimeofday(&tv, NULL);
     return (((int64_t) tv.tv_sec) * ((int64_t) 1000)) + tv.tv_usec / 1000;
 #endif
+#endif
 }
 
 /**
@@ -595,7 +605,7 @@ int WXSocket_OpenUDPClient(const char *hostIpAddr, const char *service,
 
 /* Common method for the binding sequence for the following methods */
 static int WXSocket_BindServer(struct addrinfo *addrInfo, uint32_t *portRef,
-                               WXSocket *socketRef) {
+                               int reusePort, WXSocket *socketRef) {
 #ifdef _WXWIN_BUILD
     SOCKET socketHandle;
     int localAddrLen;
@@ -626,6 +636,27 @@ static int WXSocket_BindServer(struct addrinfo *addrInfo, uint32_t *portRef,
         return WXNRC_SYS_ERROR;
     }
 
+    /* Shared port binding for kernel-balanced listener shards, on request */
+    if (reusePort) {
+#ifdef SO_REUSEPORT
+        optVal = 1;
+        if (setsockopt(socketHandle, SOL_SOCKET, SO_REUSEPORT,
+                       (const char *) &optVal, sizeof(optVal)) < 0) {
+            errnum = sockErrNo;
+            WXSocket_Close((WXSocket) socketHandle);
+            *socketRef = INVALID_SOCKET_FD;
+            _setSockErrNo(errnum);
+            return WXNRC_SYS_ERROR;
+        }
+#else
+        /* No quiet fallback, sharded callers depend on the distribution */
+        WXSocket_Close((WXSocket) socketHandle);
+        *socketRef = INVALID_SOCKET_FD;
+        _setSockErrNo(EINVAL);
+        return WXNRC_SYS_ERROR;
+#endif
+    }
+
     /* Bind to the target instance */
     if (bind(socketHandle, addrInfo->ai_addr, addrInfo->ai_addrlen) < 0) {
         errnum = sockErrNo;
@@ -676,6 +707,27 @@ static int WXSocket_BindServer(struct addrinfo *addrInfo, uint32_t *portRef,
  */
 int WXSocket_OpenTCPServer(const char *hostIpAddr, const char *service,
                            WXSocket *socketRef) {
+    return WXSocket_OpenTCPServerEx(hostIpAddr, service, FALSE, socketRef);
+}
+
+/**
+ * Extended form of the TCP server bind, with support for port-sharded
+ * listeners.  With the reuse option set, several sockets (typically one per
+ * worker thread/process) can bind the same address/port and the kernel
+ * load-balances incoming connections across them, instead of every worker
+ * contending on a single accept queue.
+ *
+ * @param hostIpAddr Hostname or IP address of the target network to bind
+ *                   to.  If NULL, binds to all networks (INADDR_ANY).
+ * @param service Either the service name or the port number to bind to.
+ * @param reusePort If TRUE, mark the socket for shared port binding
+ *                  (SO_REUSEPORT).  Fails on platforms without the option.
+ * @param socketRef Pointer through which the created socket instance is
+ *                  returned (if applicable, depending on error conditions).
+ * @return WXNRC_OK if successful, suitable WXNRC_* error code on failure.
+ */
+int WXSocket_OpenTCPServerEx(const char *hostIpAddr, const char *service,
+                             int reusePort, WXSocket *socketRef) {
     struct addrinfo hints, *addrInfo = NULL;
     WXSocket socketHandle;
     int rc;
@@ -689,7 +741,7 @@ int WXSocket_OpenTCPServer(const char *hostIpAddr, const char *service,
     if (rc != WXNRC_OK) return rc;
 
     /* And open/bind the socket instance */
-    rc = WXSocket_BindServer(addrInfo, NULL, &socketHandle);
+    rc = WXSocket_BindServer(addrInfo, NULL, reusePort, &socketHandle);
     freeaddrinfo(addrInfo);
     if (socketRef != NULL) *socketRef = socketHandle;
     return rc;
@@ -722,7 +774,7 @@ int WXSocket_OpenEphemeralServer(const char *hostIpAddr, uint32_t *portRef,
     if (rc != WXNRC_OK) return rc;
 
     /* And open/bind the socket instance */
-    rc = WXSocket_BindServer(addrInfo, &ephemPort, &socketHandle);
+    rc = WXSocket_BindServer(addrInfo, &ephemPort, FALSE, &socketHandle);
     freeaddrinfo(addrInfo);
     if (portRef != NULL) *portRef = ephemPort;
     if (socketRef != NULL) *socketRef = socketHandle;
@@ -755,7 +807,7 @@ int WXSocket_OpenUDPServer(const char *hostIpAddr, const char *service,
     if (rc != WXNRC_OK) return rc;
 
     /* And open/bind the socket instance */
-    rc = WXSocket_BindServer(addrInfo, NULL, &socketHandle);
+    rc = WXSocket_BindServer(addrInfo, NULL, FALSE, &socketHandle);
     freeaddrinfo(addrInfo);
     if (socketRef != NULL) *socketRef = socketHandle;
     return rc;
@@ -835,6 +887,53 @@ int WXSocket_Accept(WXSocket serverSocket, WXSocket *socketRef,
     return WXNRC_OK;
 }
 
+/**
+ * Burst form of the accept() wrapper, draining the pending connection queue
+ * into an array with a single readiness notification instead of one
+ * wait/accept round trip per connection.  The server socket must be in
+ * non-blocking state (see below), the drain ends when the queue empties or
+ * the array fills.  No origin determination is performed in this mode, use
+ * getpeername() on the returned sockets if required.
+ *
+ * @param serverSocket The bound server socket to accept connections from.
+ * @param sockets Array to store the accepted socket instances into.
+ * @param maxCount Number of entries available in the previous array.
+ * @return The number of connections accepted (zero if the queue is empty)
+ *         or a suitable WXNRC_* error code on failure.  Connections accepted
+ *         before an error are retained in the array and reflected in a
+ *         positive return instead of the error.
+ */
+ssize_t WXSocket_AcceptBurst(WXSocket serverSocket, WXSocket *sockets,
+                             size_t maxCount) {
+#ifdef _WXWIN_BUILD
+    SOCKET socketHandle;
+#else
+    int32_t socketHandle;
+#endif
+    ssize_t retCount = 0;
+    int errnum;
+
+    while ((size_t) retCount < maxCount) {
+        socketHandle = accept(serverSocket, NULL, NULL);
+#ifdef _WXWIN_BUILD
+        if (socketHandle == INVALID_SOCKET) {
+            errnum = sockErrNo;
+            if (errnum == WSAEWOULDBLOCK) break;
+#else
+        if (socketHandle < 0) {
+            errnum = sockErrNo;
+            if ((errnum == EAGAIN) || (errnum == EWOULDBLOCK)) break;
+            if (errnum == EINTR) continue;
+#endif
+            /* Partial bursts trump the error, next call will see it again */
+            return (retCount != 0) ? retCount : WXNRC_SYS_ERROR;
+        }
+        sockets[retCount++] = (WXSocket) socketHandle;
+    }
+
+    return retCount;
+}
+
 /**
  * Method to wait for read/write availability on the given socket handle.
  * Uses select/poll as required, not event dispatching like the server engine.
@@ -1142,6 +1241,124 @@ ssize_t WXSocket_SendTo(WXSocket socketHandle, void *buf, size_t len,
     return (rc >= 0) ? rc : txlateError(errorCode);
 }
 
+/* Bounded stack translation set for the vectored send operation */
+#define WXSOCKET_IOV_MAX 16
+
+/**
+ * Wrapping method for vectored (scatter/gather) writes to a TCP socket
+ * instance (wrapper around writev()/WSASend()).  The full vector set goes to
+ * the operating system in a single call, avoiding both per-segment system
+ * calls and any coalescing copy.  Automatically consumes interrupts (EINTR).
+ *
+ * @param socketHandle The handle of the socket to write to.
+ * @param vectors Array of memory segment descriptors to be written, in order.
+ * @param count Number of entries in the vector array.
+ * @return Total number of bytes written to the socket or one of the WXNRC_
+ *         error codes.  Zero indicates a non-blocking wait condition with no
+ *         bytes written.  Note that a partial write (less than the vector
+ *         total) can occur, the caller must track consumption accordingly.
+ */
+ssize_t WXSocket_SendV(WXSocket socketHandle, WXSocketIOVec *vectors,
+                       size_t count) {
+#ifdef _WXWIN_BUILD
+    WSABUF iov[WXSOCKET_IOV_MAX];
+    DWORD written;
+#else
+    struct iovec iov[WXSOCKET_IOV_MAX];
+#endif
+    int errorCode;
+    ssize_t rc;
+    size_t idx;
+
+    /* Translate to the platform descriptors (overflow goes to next call) */
+    if (count > WXSOCKET_IOV_MAX) count = WXSOCKET_IOV_MAX;
+    for (idx = 0; idx < count; idx++) {
+#ifdef _WXWIN_BUILD
+        iov[idx].buf = (char *) vectors[idx].base;
+        iov[idx].len = (ULONG) vectors[idx].len;
+#else
+        iov[idx].iov_base = vectors[idx].base;
+        iov[idx].iov_len = vectors[idx].len;
+#endif
+    }
+
+    do {
+#ifdef _WXWIN_BUILD
+        rc = WSASend((SOCKET) socketHandle, iov, (DWORD) count, &written,
+                     0, NULL, NULL);
+        if (rc == 0) rc = (ssize_t) written;
+        else rc = -1;
+#else
+        rc = writev((int) socketHandle, iov, (int) count);
+#endif
+        errorCode = sockErrNo;
+    } while ((rc < 0) && (errorCode == EINTR));
+
+    return (rc >= 0) ? rc : txlateError(errorCode);
+}
+
+/* Bounded stack staging block for the copy-based fallback loop below */
+#define WXSOCKET_SENDFILE_BLOCK 8192
+
+/**
+ * Zero-copy transmission of file contents to a TCP socket instance (wrapper
+ * around sendfile()/TransmitFile(), with a bounded read/send staging loop on
+ * platforms providing neither).  The kernel moves the file pages directly to
+ * the socket, avoiding the double copy through userspace that a read-then-send
+ * sequence incurs.  Automatically consumes interrupts (EINTR).
+ *
+ * @param socketHandle The handle of the socket to write to.
+ * @param fd Open (readable) file descriptor to transmit content from.
+ * @param offset Byte offset in the file to transmit from.  The descriptor
+ *               file position is neither used nor updated.
+ * @param len Number of bytes to attempt to transmit from the file.
+ * @return Number of bytes written to the socket or one of the WXNRC_ error
+ *         codes.  Zero indicates a non-blocking wait condition with no bytes
+ *         written (or end-of-file at the offset).  Note that a partial
+ *         transfer can occur, the caller must advance the offset accordingly.
+ */
+ssize_t WXSocket_SendFile(WXSocket socketHandle, int fd, off_t offset,
+                          size_t len) {
+#ifdef _WXWIN_BUILD
+    HANDLE hFile = (HANDLE) _get_osfhandle(fd);
+    OVERLAPPED overlap;
+
+    /* TransmitFile takes the underlying handle and an explicit offset */
+    if (hFile == INVALID_HANDLE_VALUE) return WXNRC_SYS_ERROR;
+    (void) memset(&overlap, 0, sizeof(overlap));
+    overlap.Offset = (DWORD) (((uint64_t) offset) & 0xFFFFFFFFULL);
+    overlap.OffsetHigh = (DWORD) (((uint64_t) offset) >> 32);
+    if (!TransmitFile((SOCKET) socketHandle, hFile, (DWORD) len, 0,
+                      &overlap, NULL, 0)) {
+        return txlateError(sockErrNo);
+    }
+    return (ssize_t) len;
+#elif defined(HAVE_SYS_SENDFILE_H)
+    int errorCode;
+    ssize_t rc;
+
+    do {
+        rc = sendfile((int) socketHandle, fd, &offset, len);
+        errorCode = sockErrNo;
+    } while ((rc < 0) && (errorCode == EINTR));
+
+    return (rc >= 0) ? rc : txlateError(errorCode);
+#else
+    uint8_t block[WXSOCKET_SENDFILE_BLOCK];
+    ssize_t inBytes;
+
+    /* No kernel primitive here, stage a block through userspace instead */
+    if (len > sizeof(block)) len = sizeof(block);
+    do {
+        inBytes = pread(fd, block, len, offset);
+    } while ((inBytes < 0) && (errno == EINTR));
+    if (inBytes < 0) return WXNRC_SYS_ERROR;
+    if (inBytes == 0) return 0;
+
+    return WXSocket_Send(socketHandle, block, (size_t) inBytes, 0);
+#endif
+}
+
 /**
  * General method to close the provided socket instance.
  *
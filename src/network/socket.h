@@ -179,6 +179,25 @@ int WXSocket_OpenUDPClient(const char *hostIpAddr, const char *service,
 int WXSocket_OpenTCPServer(const char *hostIpAddr, const char *service,
                            WXSocket *socketRef);
 
+/**
+ * Extended form of the TCP server bind, with support for port-sharded
+ * listeners.  With the reuse option set, several sockets (typically one per
+ * worker thread/process) can bind the same address/port and the kernel
+ * load-balances incoming connections across them, instead of every worker
+ * contending on a single accept queue.
+ *
+ * @param hostIpAddr Hostname or IP address of the target network to bind
+ *                   to.  If NULL, binds to all networks (INADDR_ANY).
+ * @param service Either the service name or the port number to bind to.
+ * @param reusePort If TRUE, mark the socket for shared port binding
+ *                  (SO_REUSEPORT).  Fails on platforms without the option.
+ * @param socketRef Pointer through which the created socket instance is
+ *                  returned (if applicable, depending on error conditions).
+ * @return WXNRC_OK if successful, suitable WXNRC_* error code on failure.
+ */
+int WXSocket_OpenTCPServerEx(const char *hostIpAddr, const char *service,
+                             int reusePort, WXSocket *socketRef);
+
 /**
  * Allocate and bind an ephemeral (indeterminant port) TCP server socket on
  * the indicated address.
@@ -226,6 +245,25 @@ int WXSocket_OpenUDPServer(const char *hostIpAddr, const char *service,
 int WXSocket_Accept(WXSocket serverSocket, WXSocket *socketRef,
                     char *origin, uint32_t originLen);
 
+/**
+ * Burst form of the accept() wrapper, draining the pending connection queue
+ * into an array with a single readiness notification instead of one
+ * wait/accept round trip per connection.  The server socket must be in
+ * non-blocking state (see below), the drain ends when the queue empties or
+ * the array fills.  No origin determination is performed in this mode, use
+ * getpeername() on the returned sockets if required.
+ *
+ * @param serverSocket The bound server socket to accept connections from.
+ * @param sockets Array to store the accepted socket instances into.
+ * @param maxCount Number of entries available in the previous array.
+ * @return The number of connections accepted (zero if the queue is empty)
+ *         or a suitable WXNRC_* error code on failure.  Connections accepted
+ *         before an error are retained in the array and reflected in a
+ *         positive return instead of the error.
+ */
+ssize_t WXSocket_AcceptBurst(WXSocket serverSocket, WXSocket *sockets,
+                             size_t maxCount);
+
 /**
  * Method to wait for read/write availability on the given socket handle.
  * Uses select/poll as required, not event dispatching like the server engine.
@@ -312,6 +350,55 @@ ssize_t WXSocket_Send(WXSocket socketHandle, const void *buf, size_t len,
 ssize_t WXSocket_SendTo(WXSocket socketHandle, void *buf, size_t len,
                         int flags, void *destAddr, socklen_t addrLen);
 
+/**
+ * Platform-neutral buffer descriptor for the vectored send method below,
+ * translated internally to the appropriate iovec/WSABUF form.
+ */
+typedef struct WXSocketIOVec {
+    /* Reference to the block of memory to be written */
+    void *base;
+
+    /* Number of bytes to write from the referenced block */
+    size_t len;
+} WXSocketIOVec;
+
+/**
+ * Wrapping method for vectored (scatter/gather) writes to a TCP socket
+ * instance (wrapper around writev()/WSASend()).  The full vector set goes to
+ * the operating system in a single call, avoiding both per-segment system
+ * calls and any coalescing copy.  Automatically consumes interrupts (EINTR).
+ *
+ * @param socketHandle The handle of the socket to write to.
+ * @param vectors Array of memory segment descriptors to be written, in order.
+ * @param count Number of entries in the vector array.
+ * @return Total number of bytes written to the socket or one of the WXNRC_
+ *         error codes.  Zero indicates a non-blocking wait condition with no
+ *         bytes written.  Note that a partial write (less than the vector
+ *         total) can occur, the caller must track consumption accordingly.
+ */
+ssize_t WXSocket_SendV(WXSocket socketHandle, WXSocketIOVec *vectors,
+                       size_t count);
+
+/**
+ * Zero-copy transmission of file contents to a TCP socket instance (wrapper
+ * around sendfile()/TransmitFile(), with a bounded read/send staging loop on
+ * platforms providing neither).  The kernel moves the file pages directly to
+ * the socket, avoiding the double copy through userspace that a read-then-send
+ * sequence incurs.  Automatically consumes interrupts (EINTR).
+ *
+ * @param socketHandle The handle of the socket to write to.
+ * @param fd Open (readable) file descriptor to transmit content from.
+ * @param offset Byte offset in the file to transmit from.  The descriptor
+ *               file position is neither used nor updated.
+ * @param len Number of bytes to attempt to transmit from the file.
+ * @return Number of bytes written to the socket or one of the WXNRC_ error
+ *         codes.  Zero indicates a non-blocking wait condition with no bytes
+ *         written (or end-of-file at the offset).  Note that a partial
+ *         transfer can occur, the caller must advance the offset accordingly.
+ */
+ssize_t WXSocket_SendFile(WXSocket socketHandle, int fd, off_t offset,
+                          size_t len);
+
 /**
  * Manage the blocking state of the socket.  Determines whether data access
  * operations (including connect) behave synchronously or asynchronously.
@@ -6,6 +6,7 @@
  * this software.
  */
 #include "stream.h"
+#include "stats.h"
 
 #ifndef _WXWIN_BUILD
 #include <sys/socket.h>
@@ -150,9 +151,12 @@ int WXSockStream_Init(WXSocketStream *strm, WXSocket socketHandle,
 }
 
 /**
- * Read more content into the read buffer, consuming any offset and expanding
- * the buffer according to the desired amount of content (total).  Consumers
- * should manipulate the associated buffer contents directly.
+ * Read more content into the read buffer, expanding the buffer according to
+ * the desired amount of content (total).  Consumers should manipulate the
+ * associated buffer contents directly - the unconsumed window is always
+ * contiguous at buffer + offset, but is only rewound to the buffer origin
+ * when append room actually runs out (use the compaction method below if
+ * zero-based access is explicitly required).
  *
  * @param strm The socket stream to read more content for.
  * @param capacity The desired/target number of bytes to buffer/read from the
@@ -171,22 +175,30 @@ int WXSockStream_Read(WXSocketStream *strm, size_t capacity) {
     ssize_t l;
     int rc;
 
-    /* Like ensure capacity but force consumption and size by total */
-    if (rd->offset != 0) {
-        rd->length -= rd->offset;
-        (void) memmove(rd->buffer, rd->buffer + rd->offset, rd->length);
-        rd->offset = 0;
-    }
-    if ((capacity > rd->allocLength ) || (rd->length >= rd->allocLength)) {
-        /* Note: second condition is to ensure we actually read something */
-        len = (rd->allocLength << 1);
-        if (capacity > len) len = capacity;
-        buffer = (uint8_t *) WXMalloc(len);
-        if (buffer == NULL) return WXSockStream_Response(strm, WXNRC_MEM_ERROR);
-        if (rd->length != 0) (void) memcpy(buffer, rd->buffer, rd->length);
-        WXFree(rd->buffer);
-        rd->buffer = buffer;
-        rd->allocLength = len;
+    /* Fully drained windows rewind for free, without any byte motion */
+    if (rd->offset >= rd->length) rd->offset = rd->length = 0;
+
+    /* Deferred compaction, only slide the window when room runs out (the
+     * former unconditional slide re-copied the whole backlog every refill) */
+    if ((capacity > rd->allocLength - rd->offset) ||
+            (rd->length >= rd->allocLength)) {
+        if (rd->offset != 0) {
+            rd->length -= rd->offset;
+            (void) memmove(rd->buffer, rd->buffer + rd->offset, rd->length);
+            rd->offset = 0;
+        }
+        if ((capacity > rd->allocLength) || (rd->length >= rd->allocLength)) {
+            /* Note: second condition is to ensure we actually read something */
+            len = (rd->allocLength << 1);
+            if (capacity > len) len = capacity;
+            buffer = (uint8_t *) WXMalloc(len);
+            if (buffer == NULL)
+                return WXSockStream_Response(strm, WXNRC_MEM_ERROR);
+            if (rd->length != 0) (void) memcpy(buffer, rd->buffer, rd->length);
+            WXFree(rd->buffer);
+            rd->buffer = buffer;
+            rd->allocLength = len;
+        }
     }
 
     /* Direct appropriately for read handling */
@@ -208,6 +220,26 @@ int WXSockStream_Read(WXSocketStream *strm, size_t capacity) {
     return rc;
 }
 
+/**
+ * Force the unconsumed read window back to the origin of the read buffer,
+ * for (rare) consumers that require zero-based content access.  The read
+ * method above defers this slide until append room runs out, so routine
+ * buffer+offset consumption never pays for the byte motion.
+ *
+ * @param strm The socket stream to compact the read buffer for.
+ */
+void WXSockStream_CompactRead(WXSocketStream *strm) {
+    WXBuffer *rd = &(strm->readBuffer);
+
+    if (rd->offset != 0) {
+        rd->length -= rd->offset;
+        if (rd->length != 0) {
+            (void) memmove(rd->buffer, rd->buffer + rd->offset, rd->length);
+        }
+        rd->offset = 0;
+    }
+}
+
 /**
  * Write more buffered outbound content to the underlying socket, updating the
  * buffer accordingly.  Producers should have already staged content in the
@@ -239,9 +271,11 @@ int WXSockStream_Write(WXSocketStream *strm) {
                 rc = WXNRC_OK;
             } else {
                 /* Still more to go */
+                WXSTATS_INCR(streamShortWrites);
                 rc = WXNRC_WRITE_REQUIRED;
             }
         } else if (l == 0) {
+            WXSTATS_INCR(streamShortWrites);
             rc = WXNRC_WRITE_REQUIRED;
         } else {
             rc = (int) l;
@@ -268,6 +302,7 @@ int WXSockStream_Write(WXSocketStream *strm) {
 int WXSockStream_Flush(WXSocketStream *strm) {
     int rc = WXNRC_WRITE_REQUIRED;
 
+    WXSTATS_INCR(streamFlushes);
     while (rc != WXNRC_OK) {
         /* Even though last return may be read, raw handler keeps track */
         rc = WXSockStream_Write(strm);
@@ -282,6 +317,161 @@ int WXSockStream_Flush(WXSocketStream *strm) {
     return rc;
 }
 
+/**
+ * Sink adapter for streaming encoders (signature-compatible with the
+ * WXJSONEncodeSink definition in the language toolkit), where the user data
+ * reference is the target socket stream.  Appends the content segment to the
+ * stream write buffer and synchronously flushes it, so a large encoded
+ * document transmits incrementally in bounded memory instead of being fully
+ * staged before the first byte is sent.
+ *
+ * @param content Reference to the encoded content segment.
+ * @param length Number of bytes in the encoded content segment.
+ * @param userData The target socket stream (WXSocketStream) instance.
+ * @return Zero on success, suitable (negative) WXNRC_* error code on failure
+ *         (also recorded against the stream).
+ */
+int WXSockStream_SinkWrite(uint8_t *content, size_t length, void *userData) {
+    WXSocketStream *strm = (WXSocketStream *) userData;
+    int rc;
+
+    if (WXBuffer_Append(&(strm->writeBuffer), content, length, TRUE) == NULL) {
+        return WXSockStream_Response(strm, WXNRC_MEM_ERROR);
+    }
+
+    rc = WXSockStream_Flush(strm);
+    return (rc < 0) ? rc : 0;
+}
+
+/* Matches the bounded translation set of the underlying socket method */
+#define WXSOCKSTREAM_IOV_MAX 16
+
+/**
+ * Write a chain of staged buffers (e.g. a record header plus a large payload)
+ * to the underlying socket in a single vectored send, along with any content
+ * pending in the stream write buffer (which goes first).  Each buffer writes
+ * from its current offset, which will be adjusted according to the amount
+ * written.  For streams with a raw writer (e.g. wire encryption), the content
+ * falls back to staging through the stream write buffer.
+ *
+ * @param strm The socket stream to write the buffer chain to.
+ * @param buffers Array of buffer instances to write from, in order.
+ * @param count The number of buffer instances in the array.
+ * @return A suitable WXNRC_* response code based on the outcome of the write
+ *         operation, OK indicating that all pending data was written.  Note
+ *         that WRITE_REQUIRED will be returned for non-blocking sockets with
+ *         residual content in the stream or chain buffers.
+ */
+int WXSockStream_WriteBuffers(WXSocketStream *strm, WXBuffer **buffers,
+                              size_t count) {
+    WXSocketIOVec iov[WXSOCKSTREAM_IOV_MAX];
+    WXBuffer *wr = &(strm->writeBuffer), *buffer;
+    size_t idx, remain, residual;
+    int iovCount;
+    ssize_t l;
+
+    /* Raw encoders require contiguous staging, fall back to a copied write */
+    if (strm->rawWriter != NULL) {
+        for (idx = 0; idx < count; idx++) {
+            buffer = buffers[idx];
+            if (buffer->offset >= buffer->length) continue;
+            if (WXBuffer_Append(wr, buffer->buffer + buffer->offset,
+                                buffer->length - buffer->offset,
+                                TRUE) == NULL) {
+                return WXSockStream_Response(strm, WXNRC_MEM_ERROR);
+            }
+            buffer->offset = buffer->length;
+        }
+        return WXSockStream_Write(strm);
+    }
+
+    /* Assemble the vector set, pending stream content leads */
+    iovCount = 0;
+    residual = 0;
+    if (wr->offset < wr->length) {
+        iov[iovCount].base = wr->buffer + wr->offset;
+        iov[iovCount].len = wr->length - wr->offset;
+        iovCount++;
+    }
+    for (idx = 0; idx < count; idx++) {
+        buffer = buffers[idx];
+        if (buffer->offset >= buffer->length) continue;
+        if (iovCount >= WXSOCKSTREAM_IOV_MAX) {
+            residual += buffer->length - buffer->offset;
+            continue;
+        }
+        iov[iovCount].base = buffer->buffer + buffer->offset;
+        iov[iovCount].len = buffer->length - buffer->offset;
+        iovCount++;
+    }
+    if (iovCount == 0) return WXSockStream_Response(strm, WXNRC_OK);
+
+    l = WXSocket_SendV(strm->socketHandle, iov, iovCount);
+    if (l < 0) return WXSockStream_Response(strm, (int) l);
+    if (l == 0) return WXSockStream_Response(strm, WXNRC_WRITE_REQUIRED);
+
+    /* Distribute the written count, stream buffer first then the chain */
+    if (wr->offset < wr->length) {
+        remain = wr->length - wr->offset;
+        if (remain > (size_t) l) {
+            wr->offset += l;
+            l = 0;
+        } else {
+            wr->length = wr->offset = 0;
+            l -= remain;
+        }
+    }
+    for (idx = 0; idx < count; idx++) {
+        buffer = buffers[idx];
+        if (buffer->offset >= buffer->length) continue;
+        remain = buffer->length - buffer->offset;
+        if (remain > (size_t) l) {
+            buffer->offset += l;
+            l = 0;
+        } else {
+            buffer->offset = buffer->length;
+            l -= remain;
+        }
+        if (l == 0) break;
+    }
+
+    /* Residual in either the stream or the chain requires another write */
+    if (wr->offset < wr->length) residual++;
+    for (idx = 0; idx < count; idx++) {
+        if (buffers[idx]->offset < buffers[idx]->length) residual++;
+    }
+    return WXSockStream_Response(strm, (residual != 0) ? WXNRC_WRITE_REQUIRED :
+                                                         WXNRC_OK);
+}
+
+/**
+ * Synchronously flush a chain of staged buffers (along with any pending
+ * stream write content) to the underlying socket, using vectored writes
+ * where the stream supports it.
+ *
+ * @param strm The socket stream to flush the buffer chain to.
+ * @param buffers Array of buffer instances to write from, in order.
+ * @param count The number of buffer instances in the array.
+ * @return Either WXNRC_OK to indicate that all content has been flushed
+ *         or a suitable WXNRC_* error code for failure.
+ */
+int WXSockStream_FlushBuffers(WXSocketStream *strm, WXBuffer **buffers,
+                              size_t count) {
+    int rc = WXNRC_WRITE_REQUIRED;
+
+    while (rc != WXNRC_OK) {
+        rc = WXSockStream_WriteBuffers(strm, buffers, count);
+        if (rc < 0) return rc;
+
+        if (rc != WXNRC_OK) {
+            rc = WXSocket_Wait(strm->socketHandle, rc, NULL);
+            if (rc < 0) return rc;
+        }
+    }
+
+    return rc;
+}
+
 /**
  * Destroy a socket stream instance.  Releases internal resources of the stream
  * but does not related the instance itself.  Will automatically close the
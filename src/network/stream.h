@@ -100,9 +100,12 @@ int WXSockStream_Init(WXSocketStream *strm, WXSocket socketHandle,
                       int32_t bufferSize);
 
 /**
- * Read more content into the read buffer, consuming any offset and expanding
- * the buffer according to the desired amount of content (total).  Consumers
- * should manipulate the associated buffer contents directly.
+ * Read more content into the read buffer, expanding the buffer according to
+ * the desired amount of content (total).  Consumers should manipulate the
+ * associated buffer contents directly - the unconsumed window is always
+ * contiguous at buffer + offset, but is only rewound to the buffer origin
+ * when append room actually runs out (use the compaction method below if
+ * zero-based access is explicitly required).
  *
  * @param strm The socket stream to read more content for.
  * @param capacity The desired/target number of bytes to buffer/read from the
@@ -116,6 +119,16 @@ int WXSockStream_Init(WXSocketStream *strm, WXSocket socketHandle,
  */
 int WXSockStream_Read(WXSocketStream *strm, size_t capacity);
 
+/**
+ * Force the unconsumed read window back to the origin of the read buffer,
+ * for (rare) consumers that require zero-based content access.  The read
+ * method above defers this slide until append room runs out, so routine
+ * buffer+offset consumption never pays for the byte motion.
+ *
+ * @param strm The socket stream to compact the read buffer for.
+ */
+void WXSockStream_CompactRead(WXSocketStream *strm);
+
 /**
  * Write more buffered outbound content to the underlying socket, updating the
  * buffer accordingly.  Producers should have already staged content in the
@@ -140,6 +153,55 @@ int WXSockStream_Write(WXSocketStream *strm);
  */
 int WXSockStream_Flush(WXSocketStream *strm);
 
+/**
+ * Sink adapter for streaming encoders (signature-compatible with the
+ * WXJSONEncodeSink definition in the language toolkit), where the user data
+ * reference is the target socket stream.  Appends the content segment to the
+ * stream write buffer and synchronously flushes it, so a large encoded
+ * document transmits incrementally in bounded memory instead of being fully
+ * staged before the first byte is sent.
+ *
+ * @param content Reference to the encoded content segment.
+ * @param length Number of bytes in the encoded content segment.
+ * @param userData The target socket stream (WXSocketStream) instance.
+ * @return Zero on success, suitable (negative) WXNRC_* error code on failure
+ *         (also recorded against the stream).
+ */
+int WXSockStream_SinkWrite(uint8_t *content, size_t length, void *userData);
+
+/**
+ * Write a chain of staged buffers (e.g. a record header plus a large payload)
+ * to the underlying socket in a single vectored send, along with any content
+ * pending in the stream write buffer (which goes first).  Each buffer writes
+ * from its current offset, which will be adjusted according to the amount
+ * written.  For streams with a raw writer (e.g. wire encryption), the content
+ * falls back to staging through the stream write buffer.
+ *
+ * @param strm The socket stream to write the buffer chain to.
+ * @param buffers Array of buffer instances to write from, in order.
+ * @param count The number of buffer instances in the array.
+ * @return A suitable WXNRC_* response code based on the outcome of the write
+ *         operation, OK indicating that all pending data was written.  Note
+ *         that WRITE_REQUIRED will be returned for non-blocking sockets with
+ *         residual content in the stream or chain buffers.
+ */
+int WXSockStream_WriteBuffers(WXSocketStream *strm, WXBuffer **buffers,
+                              size_t count);
+
+/**
+ * Synchronously flush a chain of staged buffers (along with any pending
+ * stream write content) to the underlying socket, using vectored writes
+ * where the stream supports it.
+ *
+ * @param strm The socket stream to flush the buffer chain to.
+ * @param buffers Array of buffer instances to write from, in order.
+ * @param count The number of buffer instances in the array.
+ * @return Either WXNRC_OK to indicate that all content has been flushed
+ *         or a suitable WXNRC_* error code for failure.
+ */
+int WXSockStream_FlushBuffers(WXSocketStream *strm, WXBuffer **buffers,
+                              size_t count);
+
 /**
  * Destroy a socket stream instance.  Releases internal resources of the stream
  * but does not related the instance itself.  Will automatically close the
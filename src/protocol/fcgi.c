@@ -11,6 +11,23 @@
 /* Standard debugging pattern */
 #define FCGI_DEBUG 1
 
+/* Bounds for the released connection pool, override at compile as desired */
+#ifndef WXFCGI_POOL_MAX_IDLE
+#define WXFCGI_POOL_MAX_IDLE 16
+#endif
+#ifndef WXFCGI_POOL_BUFFER_LIMIT
+#define WXFCGI_POOL_BUFFER_LIMIT 65536
+#endif
+
+/*
+ * Free-list of released connection instances for reallocation, retaining
+ * their grown output buffers to avoid churn under high accept rates.  Note
+ * that there is no synchronization here, consistent with the single-threaded
+ * event loop processing model of the FCGI methods themselves.
+ */
+static WXFCGI_Connection *connPool = NULL;
+static uint32_t connPoolCount = 0;
+
 /**
  * Allocate an FCGI connection instance for the given connection.
  *
@@ -21,8 +38,17 @@
 WXFCGI_Connection *WXFCGI_Allocate(WXSocket sockConn) {
     WXFCGI_Connection *conn;
 
-    conn = (WXFCGI_Connection *) WXMalloc(sizeof(WXFCGI_Connection));
-    if (conn == NULL) return NULL;
+    /* Recycle a previously released instance where possible */
+    if (connPool != NULL) {
+        conn = connPool;
+        connPool = conn->nextPooled;
+        connPoolCount--;
+    } else {
+        conn = (WXFCGI_Connection *) WXMalloc(sizeof(WXFCGI_Connection));
+        if (conn == NULL) return NULL;
+        conn->outBuffer = NULL;
+        conn->outAllocLen = 0;
+    }
 
     conn->sockConn = sockConn;
     conn->recordLength = 0;
@@ -30,12 +56,18 @@ WXFCGI_Connection *WXFCGI_Allocate(WXSocket sockConn) {
     conn->request.params = NULL;
     conn->request.stdin = NULL;
     conn->request.stdinLen = 0;
+    conn->request.paramData = NULL;
+    conn->request.paramDataLen = 0;
+    conn->rawParams = FALSE;
+    conn->nextPooled = NULL;
 
-    /* Always assume some responses */
-    conn->outBuffer = (uint8_t *) WXMalloc(conn->outAllocLen = 1024);
+    /* Always assume some responses (pooled instances carry theirs along) */
     if (conn->outBuffer == NULL) {
-        WXFree(conn);
-        return NULL;
+        conn->outBuffer = (uint8_t *) WXMalloc(conn->outAllocLen = 1024);
+        if (conn->outBuffer == NULL) {
+            WXFree(conn);
+            return NULL;
+        }
     }
     conn->outLen = 0;
 
@@ -127,12 +159,29 @@ int WXFCGI_Read(WXFCGI_Connection *conn) {
         if (conn->request.stdin != NULL) WXFree(conn->request.stdin);
         conn->request.stdin = NULL;
         conn->request.stdinLen = 0;
+        if (conn->request.paramData != NULL) WXFree(conn->request.paramData);
+        conn->request.paramData = NULL;
+        conn->request.paramDataLen = 0;
     } else if (conn->header.type == WXFCGI_PARAMS) {
         if ((conn->request.phase != WXFCGI_PHASE_BEGIN) &&
                 (conn->request.phase != WXFCGI_PHASE_PARAMS)) {
             return WXNRC_DATA_ERROR;
         }
         if (conn->recordLength == 0) {
+            if (conn->rawParams) {
+                /* Hand the accumulated content over for view-based access */
+                conn->request.paramData = conn->request.stdin;
+                conn->request.paramDataLen = conn->request.stdinLen;
+                conn->request.stdin = NULL;
+                conn->request.stdinLen = 0;
+                conn->request.phase = WXFCGI_PHASE_PARAMS_DONE;
+
+                conn->recordLength = 0;
+                conn->recordOffset = 0;
+                return WXNRC_READ_REQUIRED;
+            }
+
+            /* Otherwise, unwind into allocated name/value pairings */
             ptr = conn->request.stdin;
             len = conn->request.stdinLen;
             while (len > 0) {
@@ -247,6 +296,79 @@ int WXFCGI_Read(WXFCGI_Connection *conn) {
                                        WXNRC_OK_WITH_DATA : WXNRC_READ_REQUIRED;
 }
 
+/**
+ * Iterate the raw parameter content of a completed request (zero-copy mode
+ * only), filling the provided view with length-delimited references into
+ * the retained receive content.  The referenced data is only valid until
+ * the connection is released or begins another request, use
+ * WXFCGI_ParamValueDup for values retained beyond the request handler.
+ *
+ * @param request The completed request containing raw parameter content.
+ * @param offset Iteration cursor, initialize to zero before the first call.
+ * @param view Reference to the view instance to populate.
+ * @return TRUE if a parameter was retrieved, FALSE at end of content.
+ */
+int WXFCGI_NextParam(WXFCGI_Request *request, uint32_t *offset,
+                     WXFCGI_ParamView *view) {
+    int32_t nameLen, valLen, len;
+    uint8_t *ptr;
+
+    if (request->paramData == NULL) return FALSE;
+    ptr = request->paramData + *offset;
+    len = request->paramDataLen - *offset;
+    if (len <= 0) return FALSE;
+
+    /* Same length unwinding as the allocating parser, without the copies */
+    if ((*ptr & 0x80) == 0) {
+        nameLen = *(ptr++);
+        len--;
+    } else {
+        if (len < 4) return FALSE;
+        nameLen = (((int32_t) (*ptr & 0x7F)) << 24) |
+                  (((int32_t) *(ptr + 1)) << 16) |
+                  (((int32_t) *(ptr + 2)) << 8) |
+                  ((int32_t) *(ptr + 3));
+        ptr += 4; len -= 4;
+    }
+    if ((*ptr & 0x80) == 0) {
+        valLen = *(ptr++);
+        len--;
+    } else {
+        if (len < 4) return FALSE;
+        valLen = (((int32_t) (*ptr & 0x7F)) << 24) |
+                 (((int32_t) *(ptr + 1)) << 16) |
+                 (((int32_t) *(ptr + 2)) << 8) |
+                 ((int32_t) *(ptr + 3));
+        ptr += 4; len -= 4;
+    }
+    if ((nameLen + valLen) > len) return FALSE;
+
+    view->name = ptr;
+    view->nameLen = nameLen;
+    view->value = ptr + nameLen;
+    view->valueLen = valLen;
+    *offset = (ptr + nameLen + valLen) - request->paramData;
+    return TRUE;
+}
+
+/**
+ * Explicit copy-out for a parameter value that a handler retains beyond
+ * the lifetime of the underlying receive content.
+ *
+ * @param view The parameter view to copy the value from.
+ * @return A null-terminated allocated copy of the value or NULL on memory
+ *         allocation failure.
+ */
+uint8_t *WXFCGI_ParamValueDup(WXFCGI_ParamView *view) {
+    uint8_t *retval;
+
+    retval = (uint8_t *) WXMalloc(view->valueLen + 1);
+    if (retval == NULL) return NULL;
+    (void) memcpy(retval, view->value, view->valueLen);
+    retval[view->valueLen] = '\0';
+    return retval;
+}
+
 /* Common method to append to the outbound connection buffer */
 static int appendOutput(WXFCGI_Connection *conn, void *data, uint32_t len) {
     uint32_t newLen;
@@ -416,9 +538,46 @@ int WXFCGI_Write(WXFCGI_Connection *conn) {
  * @param conn The conn to be released.
  */
 void WXFCGI_Release(WXFCGI_Connection *conn) {
+    uint8_t *trimBuffer;
+
     if (conn->request.params != NULL) flushNVP(conn->request.params);
     if (conn->request.stdin != NULL) WXFree(conn->request.stdin);
-    if (conn->outBuffer != NULL) WXFree(conn->outBuffer);
+    if (conn->request.paramData != NULL) WXFree(conn->request.paramData);
     WXSocket_Close(conn->sockConn);
+
+    /* Retain for reallocation where capacity permits, trim outsized buffers */
+    if ((connPoolCount < WXFCGI_POOL_MAX_IDLE) && (conn->outBuffer != NULL)) {
+        if (conn->outAllocLen > WXFCGI_POOL_BUFFER_LIMIT) {
+            trimBuffer = (uint8_t *) WXMalloc(1024);
+            if (trimBuffer != NULL) {
+                WXFree(conn->outBuffer);
+                conn->outBuffer = trimBuffer;
+                conn->outAllocLen = 1024;
+            }
+        }
+        conn->nextPooled = connPool;
+        connPool = conn;
+        connPoolCount++;
+        return;
+    }
+
+    if (conn->outBuffer != NULL) WXFree(conn->outBuffer);
     WXFree(conn);
 }
+
+/**
+ * Discard any released connection instances being retained for reallocation.
+ * Intended for process shutdown or memory-sensitive conditions, the pool
+ * will simply refill from subsequent release operations.
+ */
+void WXFCGI_FlushPool(void) {
+    WXFCGI_Connection *conn;
+
+    while (connPool != NULL) {
+        conn = connPool;
+        connPool = conn->nextPooled;
+        if (conn->outBuffer != NULL) WXFree(conn->outBuffer);
+        WXFree(conn);
+    }
+    connPoolCount = 0;
+}
@@ -130,6 +130,14 @@ typedef struct WXFCGI_NameValuePair {
     struct WXFCGI_NameValuePair *next;
 } WXFCGI_NameValuePair;
 
+/* Length-delimited view of a parameter in the raw receive content */
+typedef struct {
+    uint8_t *name;
+    uint32_t nameLen;
+    uint8_t *value;
+    uint32_t valueLen;
+} WXFCGI_ParamView;
+
 /* Not in the spec but track for processing */
 #define WXFCGI_PHASE_BEGIN       1
 #define WXFCGI_PHASE_PARAMS      2
@@ -146,10 +154,14 @@ typedef struct {
     WXFCGI_NameValuePair *params;
     uint8_t *stdin;
     uint32_t stdinLen;
+
+    /* Raw parameter content, only populated in zero-copy (rawParams) mode */
+    uint8_t *paramData;
+    uint32_t paramDataLen;
 } WXFCGI_Request;
 
 /* (Event) container for all FCGI request/response processing */
-typedef struct {
+typedef struct WXFCGI_Connection {
     /* The underlying socket instance */
     WXSocket sockConn;
 
@@ -172,6 +184,16 @@ typedef struct {
     /* Outbound content queueing */
     uint8_t *outBuffer;
     uint32_t outLen, outAllocLen;
+
+    /*
+     * Set non-zero (after allocation) to skip the allocated name-value
+     * parsing of request parameters, leaving the raw content in the request
+     * for view-based access through WXFCGI_NextParam instead.
+     */
+    int rawParams;
+
+    /* Linkage for the internal free-list of released instances */
+    struct WXFCGI_Connection *nextPooled;
 } WXFCGI_Connection;
 
 /**
@@ -192,6 +214,31 @@ WXFCGI_Connection *WXFCGI_Allocate(WXSocket sockConn);
  */
 int WXFCGI_Read(WXFCGI_Connection *conn);
 
+/**
+ * Iterate the raw parameter content of a completed request (zero-copy mode
+ * only), filling the provided view with length-delimited references into
+ * the retained receive content.  The referenced data is only valid until
+ * the connection is released or begins another request, use
+ * WXFCGI_ParamValueDup for values retained beyond the request handler.
+ *
+ * @param request The completed request containing raw parameter content.
+ * @param offset Iteration cursor, initialize to zero before the first call.
+ * @param view Reference to the view instance to populate.
+ * @return TRUE if a parameter was retrieved, FALSE at end of content.
+ */
+int WXFCGI_NextParam(WXFCGI_Request *request, uint32_t *offset,
+                     WXFCGI_ParamView *view);
+
+/**
+ * Explicit copy-out for a parameter value that a handler retains beyond
+ * the lifetime of the underlying receive content.
+ *
+ * @param view The parameter view to copy the value from.
+ * @return A null-terminated allocated copy of the value or NULL on memory
+ *         allocation failure.
+ */
+uint8_t *WXFCGI_ParamValueDup(WXFCGI_ParamView *view);
+
 /**
  * Write a response to a given request instance.  Encodes in the connection
  * outgoing buffer and attempts a write operation.
@@ -236,4 +283,11 @@ int WXFCGI_Write(WXFCGI_Connection *conn);
  */
 void WXFCGI_Release(WXFCGI_Connection *conn);
 
+/**
+ * Discard any released connection instances being retained for reallocation.
+ * Intended for process shutdown or memory-sensitive conditions, the pool
+ * will simply refill from subsequent release operations.
+ */
+void WXFCGI_FlushPool(void);
+
 #endif
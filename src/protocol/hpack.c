@@ -1898,15 +1898,91 @@ static struct wxhttpHuffDecEntry {
 #define WXHUFF_FLAG_EOS 0x02
 #define WXHUFF_FLAG_ERROR 0x04
 
+/*
+ * Flattened byte-indexed form of the above, lazily derived on first decode
+ * so each input byte costs a single table access instead of two nibble
+ * steps.  A full byte can complete at most two symbols (shortest Huffman
+ * code is five bits).
+ */
+static struct wxhttpHuffDecFlatEntry {
+    uint8_t flags, next, symCount;
+    uint8_t symbols[2];
+} (*wxhttpHuffDecFlatTable)[256] = NULL;
+
+/* One-time expansion of the nibble table, NULL on allocation failure */
+static void buildHuffDecFlatTable(void) {
+    uint32_t states = sizeof(wxhttpHuffDecTable) /
+                                      sizeof(wxhttpHuffDecTable[0]);
+    struct wxhttpHuffDecFlatEntry (*table)[256], *fentry;
+    struct wxhttpHuffDecEntry *entry;
+    uint32_t state, ch;
+
+    table = (struct wxhttpHuffDecFlatEntry (*)[256])
+                WXMalloc(states * sizeof(struct wxhttpHuffDecFlatEntry[256]));
+    if (table == NULL) return;
+
+    for (state = 0; state < states; state++) {
+        for (ch = 0; ch < 256; ch++) {
+            fentry = &(table[state][ch]);
+            fentry->symCount = 0;
+
+            /* Combine the two nibble transitions for this byte */
+            entry = &(wxhttpHuffDecTable[state][ch >> 4]);
+            if ((entry->flags & WXHUFF_FLAG_ERROR) == 0) {
+                if (entry->flags & WXHUFF_FLAG_SYMBOL) {
+                    fentry->symbols[fentry->symCount++] = entry->symbol;
+                }
+                entry = &(wxhttpHuffDecTable[entry->next][ch & 0x0f]);
+            }
+            if (entry->flags & WXHUFF_FLAG_ERROR) {
+                fentry->flags = WXHUFF_FLAG_ERROR;
+                fentry->next = 0;
+                fentry->symCount = 0;
+                continue;
+            }
+            if (entry->flags & WXHUFF_FLAG_SYMBOL) {
+                fentry->symbols[fentry->symCount++] = entry->symbol;
+            }
+
+            fentry->flags = entry->flags & WXHUFF_FLAG_EOS;
+            fentry->next = entry->next;
+        }
+    }
+
+    wxhttpHuffDecFlatTable = table;
+}
+
 /**
- * Counterpart to the above.  In this case, dst must have at least twice the 
+ * Counterpart to the above.  In this case, dst must have at least twice the
  * indicated source length allocated. Return is number of decoded characters or
  * a negative WXNRC_* error code on error.
  */
 ssize_t WXHTTP_HDecodeStr(uint8_t *src, size_t len, uint8_t *dst) {
     uint8_t state = 0, ch, *ptr = dst, eos = WXHUFF_FLAG_EOS;
+    struct wxhttpHuffDecFlatEntry *fentry;
     struct wxhttpHuffDecEntry *entry;
 
+    /* Expand the flat table on first use, nibble path covers failure */
+    if (wxhttpHuffDecFlatTable == NULL) buildHuffDecFlatTable();
+
+    if (wxhttpHuffDecFlatTable != NULL) {
+        while (len > 0) {
+            ch = *(src++); len--;
+
+            fentry = &(wxhttpHuffDecFlatTable[state][ch]);
+            if (fentry->flags & WXHUFF_FLAG_ERROR) return WXNRC_DATA_ERROR;
+            if (fentry->symCount != 0) {
+                *(ptr++) = fentry->symbols[0];
+                if (fentry->symCount > 1) *(ptr++) = fentry->symbols[1];
+            }
+            state = fentry->next;
+            eos = fentry->flags;
+        }
+        if (eos == 0) return WXNRC_DATA_ERROR;
+
+        return ptr - dst;
+    }
+
     while (len > 0) {
         /* Grab the appropriate encoding entry according to type */
         ch = *(src++); len--;
@@ -2238,11 +2314,84 @@ void WXHTTP_DestroyHeaderChain(WXHTTPHeader *hdr) {
     }
 }
 
+/*
+ * Hash indexing support for the dynamic header table, giving the encoder
+ * direct name and name/value matching instead of scanning the table.  The
+ * table structure itself is defined externally, so the index block rides
+ * immediately ahead of the entries allocation (which is managed exclusively
+ * within this file).  Sequence numbering recovers the HPACK table position
+ * of an indexed entry in constant time (the oldest entry always carries
+ * headSeq, the numbering of both advances monotonically).
+ */
+struct wxhttpDynHeaderIndex {
+    WXHashTable nameIndex, pairIndex;
+    uint32_t headSeq, nextSeq;
+    int active;
+};
+
+#define WXHTTP_DYN_INDEX(dynTable) \
+    (((struct wxhttpDynHeaderIndex *) ((void *) (dynTable)->entries)) - 1)
+
+/* Key methods for the above, keyed directly on the header instances */
+static unsigned int _dynHdrNameHashFn(void *key) {
+    return ((WXHTTPHeader *) key)->nameHash;
+}
+static int _dynHdrNameEqualsFn(void *keya, void *keyb) {
+    WXHTTPHeader *hdra = (WXHTTPHeader *) keya, *hdrb = (WXHTTPHeader *) keyb;
+
+    return ((hdra->nameHash == hdrb->nameHash) &&
+                (hdra->nameLen == hdrb->nameLen) &&
+                (memcmp(hdra->name, hdrb->name, hdra->nameLen) == 0));
+}
+static unsigned int _dynHdrPairHashFn(void *key) {
+    WXHTTPHeader *hdr = (WXHTTPHeader *) key;
+
+    return hdr->nameHash ^ (hdr->valueHash * 31);
+}
+static int _dynHdrPairEqualsFn(void *keya, void *keyb) {
+    WXHTTPHeader *hdra = (WXHTTPHeader *) keya, *hdrb = (WXHTTPHeader *) keyb;
+
+    return (_dynHdrNameEqualsFn(keya, keyb) &&
+                (hdra->valueHash == hdrb->valueHash) &&
+                (hdra->valueLen == hdrb->valueLen) &&
+                (memcmp(hdra->value, hdrb->value, hdra->valueLen) == 0));
+}
+
+/* Sequences are offset by one when stored (hashtable cannot store NULL) */
+static void _dynIndexEvict(struct wxhttpDynHeaderIndex *index,
+                           WXHTTPHeader *entry) {
+    void *seqObj = (void *) (uintptr_t) (index->headSeq + 1);
+
+    /* Only remove mappings still held by the (oldest) evicted entry, a */
+    /* newer entry with the same key may have displaced its visibility */
+    if (WXHash_GetEntry(&(index->nameIndex), entry, _dynHdrNameHashFn,
+                        _dynHdrNameEqualsFn) == seqObj) {
+        (void) WXHash_RemoveEntry(&(index->nameIndex), entry, NULL, NULL,
+                                  _dynHdrNameHashFn, _dynHdrNameEqualsFn);
+    }
+    if (WXHash_GetEntry(&(index->pairIndex), entry, _dynHdrPairHashFn,
+                        _dynHdrPairEqualsFn) == seqObj) {
+        (void) WXHash_RemoveEntry(&(index->pairIndex), entry, NULL, NULL,
+                                  _dynHdrPairHashFn, _dynHdrPairEqualsFn);
+    }
+    index->headSeq++;
+}
+
+/* On memory pressure, fall back to the (original) scanning behaviour */
+static void _dynIndexDeactivate(struct wxhttpDynHeaderIndex *index) {
+    WXHash_Destroy(&(index->nameIndex));
+    WXHash_Destroy(&(index->pairIndex));
+    index->active = FALSE;
+}
+
 /* Split into a separate method for clarity and dual use */
 static int _pushDynamicHeader(WXHTTPDynamicHeaders *dynTable,
                               WXHTTPHeader *hdr) {
     uint32_t entryLen = hdr->nameLen + hdr->valueLen + 32, allocCount;
-    WXHTTPHeader *entry, **newEntries;
+    struct wxhttpDynHeaderIndex *index =
+        (dynTable->entries == NULL) ? NULL : WXHTTP_DYN_INDEX(dynTable);
+    WXHTTPHeader *entry;
+    void *seqObj;
     int munch = 0;
 
     /* Purge from existing to manage dynamic table cap (oldest are first) */
@@ -2250,6 +2399,7 @@ static int _pushDynamicHeader(WXHTTPDynamicHeaders *dynTable,
                ((dynTable->tableSize + entryLen) > dynTable->maxTableSize)) {
         entry = dynTable->entries[munch];
         dynTable->tableSize -= entry->nameLen + entry->valueLen + 32;
+        if ((index != NULL) && (index->active)) _dynIndexEvict(index, entry);
         WXHTTP_DestroyHeader(entry, TRUE);
         munch++; dynTable->entryCount--;
     }
@@ -2264,17 +2414,30 @@ static int _pushDynamicHeader(WXHTTPDynamicHeaders *dynTable,
     /* Add the newest cache entry, resizing as needed */
     if (dynTable->entryCount >= dynTable->entryAllocCount) {
         if (dynTable->entryAllocCount == 0) {
-            newEntries = (WXHTTPHeader **) WXMalloc(16 * sizeof(void *));
-            if (newEntries == NULL) return WXNRC_MEM_ERROR;
-            dynTable->entries = newEntries;
+            index = (struct wxhttpDynHeaderIndex *)
+                        WXMalloc(sizeof(struct wxhttpDynHeaderIndex) +
+                                     16 * sizeof(void *));
+            if (index == NULL) return WXNRC_MEM_ERROR;
+            index->headSeq = index->nextSeq = 0;
+            if (!WXHash_InitTable(&(index->nameIndex), -1)) {
+                index->active = FALSE;
+            } else if (!WXHash_InitTable(&(index->pairIndex), -1)) {
+                WXHash_Destroy(&(index->nameIndex));
+                index->active = FALSE;
+            } else {
+                index->active = TRUE;
+            }
+            dynTable->entries = (WXHTTPHeader **) (index + 1);
             dynTable->entryAllocCount = 16;
         } else {
             /* TODO - seem to like the doubling algorithm */
             allocCount = dynTable->entryAllocCount << 1;
-            newEntries = (WXHTTPHeader **) WXRealloc(dynTable->entries,
-                                                  allocCount * sizeof(void *));
-            if (newEntries == NULL) return WXNRC_MEM_ERROR;
-            dynTable->entries = newEntries;
+            index = (struct wxhttpDynHeaderIndex *)
+                        WXRealloc(WXHTTP_DYN_INDEX(dynTable),
+                                  sizeof(struct wxhttpDynHeaderIndex) +
+                                      allocCount * sizeof(void *));
+            if (index == NULL) return WXNRC_MEM_ERROR;
+            dynTable->entries = (WXHTTPHeader **) (index + 1);
             dynTable->entryAllocCount = allocCount;
         }
     }
@@ -2282,11 +2445,27 @@ static int _pushDynamicHeader(WXHTTPDynamicHeaders *dynTable,
     if (entry == NULL) return WXNRC_MEM_ERROR;
     dynTable->entries[dynTable->entryCount++] = entry;
     dynTable->tableSize += entryLen;
+
+    /* Record in the lookup indices (replace keeps newest duplicate) */
+    index = WXHTTP_DYN_INDEX(dynTable);
+    if (index->active) {
+        seqObj = (void *) (uintptr_t) (index->nextSeq + 1);
+        index->nextSeq++;
+        if ((!WXHash_PutEntry(&(index->nameIndex), entry, seqObj, NULL, NULL,
+                              _dynHdrNameHashFn, _dynHdrNameEqualsFn)) ||
+                (!WXHash_PutEntry(&(index->pairIndex), entry, seqObj,
+                                  NULL, NULL, _dynHdrPairHashFn,
+                                  _dynHdrPairEqualsFn))) {
+            _dynIndexDeactivate(index);
+        }
+    }
     return WXNRC_OK;
 }
 
 static void _resizeDynamicHeaders(WXHTTPDynamicHeaders *dynTable,
                                   uint32_t newSize) {
+    struct wxhttpDynHeaderIndex *index =
+        (dynTable->entries == NULL) ? NULL : WXHTTP_DYN_INDEX(dynTable);
     WXHTTPHeader *entry;
     int munch = 0;
 
@@ -2294,6 +2473,7 @@ static void _resizeDynamicHeaders(WXHTTPDynamicHeaders *dynTable,
     while (dynTable->tableSize > newSize) {
         entry = dynTable->entries[munch];
         dynTable->tableSize -= entry->nameLen + entry->valueLen + 32;
+        if ((index != NULL) && (index->active)) _dynIndexEvict(index, entry);
         WXHTTP_DestroyHeader(entry, TRUE);
         munch++; dynTable->entryCount--;
     }
@@ -2332,10 +2512,12 @@ size_t _encodeStringLiteral(uint8_t *dst, uint8_t *val, uint32_t len,
 /* Internal method to handle the HPACK header encoding with dynamic table */
 int WXHTTP_HPackHeaders(WXBuffer *buff, WXHTTPHeader *hdrs,
                         WXHTTPDynamicHeaders *dynTable) {
+    struct wxhttpDynHeaderIndex *index;
     int rc, idx, dynIdx, indexable;
     uint8_t prefix, mask, *ptr;
     uint32_t nameIdx, fullIdx;
     WXHTTPHeader *entry;
+    void *seqObj;
     ssize_t len;
 
     /* Stream through the headers */
@@ -2366,27 +2548,54 @@ int WXHTTP_HPackHeaders(WXBuffer *buff, WXHTTPHeader *hdrs,
 
         /* Only process the dynamic table for non-indexed values (per spec) */
         if ((nameIdx == 0) || (indexable && (fullIdx == 0))) {
-            dynIdx = STATIC_HEADER_COUNT;
-            for (idx = dynTable->entryCount - 1; idx >= 0; idx--, dynIdx++) {
-                /* Capture first name match, break on find if not indexable */
-                entry = dynTable->entries[idx];
-                if ((hdrs->nameHash != entry->nameHash) ||
-                        (hdrs->nameLen != entry->nameLen) ||
-                        (memcmp(hdrs->name, entry->name,
-                                hdrs->nameLen) != 0)) continue;
-                if (nameIdx == 0) {
-                     nameIdx = dynIdx;
-                     if (!indexable) break;
+            index = (dynTable->entries == NULL) ? NULL
+                                                : WXHTTP_DYN_INDEX(dynTable);
+            if ((index != NULL) && (index->active)) {
+                /* Direct matching, sequencing recovers the table position */
+                if (indexable && (fullIdx == 0)) {
+                    seqObj = WXHash_GetEntry(&(index->pairIndex), hdrs,
+                                             _dynHdrPairHashFn,
+                                             _dynHdrPairEqualsFn);
+                    if (seqObj != NULL) {
+                        fullIdx = STATIC_HEADER_COUNT + dynTable->entryCount +
+                                      index->headSeq -
+                                      ((uint32_t) (uintptr_t) seqObj);
+                    }
+                }
+                if ((fullIdx == 0) && (nameIdx == 0)) {
+                    seqObj = WXHash_GetEntry(&(index->nameIndex), hdrs,
+                                             _dynHdrNameHashFn,
+                                             _dynHdrNameEqualsFn);
+                    if (seqObj != NULL) {
+                        nameIdx = STATIC_HEADER_COUNT + dynTable->entryCount +
+                                      index->headSeq -
+                                      ((uint32_t) (uintptr_t) seqObj);
+                    }
+                }
+            } else {
+                dynIdx = STATIC_HEADER_COUNT;
+                for (idx = dynTable->entryCount - 1; idx >= 0;
+                                                         idx--, dynIdx++) {
+                    /* Capture first name match, break if not indexable */
+                    entry = dynTable->entries[idx];
+                    if ((hdrs->nameHash != entry->nameHash) ||
+                            (hdrs->nameLen != entry->nameLen) ||
+                            (memcmp(hdrs->name, entry->name,
+                                    hdrs->nameLen) != 0)) continue;
+                    if (nameIdx == 0) {
+                         nameIdx = dynIdx;
+                         if (!indexable) break;
+                    }
+
+                    /* Check for value match if indexable, break on find */
+                    if (!indexable) continue;
+                    if ((hdrs->valueHash != entry->valueHash) ||
+                            (hdrs->valueLen != entry->valueLen) ||
+                            (memcmp(hdrs->value, entry->value,
+                                    hdrs->valueLen) != 0)) continue;
+                    if (fullIdx == 0) fullIdx = dynIdx;
+                    break;
                 }
-
-                /* Check for value match but only if indexable, break on find */
-                if (!indexable) continue;
-                if ((hdrs->valueHash != entry->valueHash) ||
-                        (hdrs->valueLen != entry->valueLen) ||
-                        (memcmp(hdrs->value, entry->value,
-                                hdrs->valueLen) != 0)) continue;
-                if (fullIdx == 0) fullIdx = dynIdx;
-                break;
             }
         }
 
@@ -2593,13 +2802,21 @@ int WXHTTP_HUnpackHeaders(WXBuffer *buff, WXHTTPHeader **hdrRef,
 
 /* Cleanup for the tables */
 void WXHTTP_DestroyDynamicHeaders(WXHTTPDynamicHeaders *dynTable) {
+    struct wxhttpDynHeaderIndex *index;
     uint32_t idx;
 
     /* Just flush the header records */
     for (idx = 0; idx < dynTable->entryCount; idx++) {
         WXHTTP_DestroyHeader(dynTable->entries[idx], TRUE);
     }
-    WXFree(dynTable->entries);
+    if (dynTable->entries != NULL) {
+        index = WXHTTP_DYN_INDEX(dynTable);
+        if (index->active) {
+            WXHash_Destroy(&(index->nameIndex));
+            WXHash_Destroy(&(index->pairIndex));
+        }
+        WXFree(index);
+    }
 
     /* Clean up for testing reuse */
     dynTable->entries = NULL;
@@ -29,6 +29,8 @@ void *_WXArray_Init(WXArray *array, size_t _objSize, size_t size) {
     }
     array->allocLength = (ssize_t) size;
     array->length = 0;
+    array->offset = 0;
+    array->isRing = FALSE;
 
     return array->array;
 }
@@ -51,6 +53,44 @@ void _WXArray_InitLocal(WXArray *array, size_t _objSize, void *data,
     array->allocLength = -((ssize_t) size);
     array->array = data;
     array->length = 0;
+    array->offset = 0;
+    array->isRing = FALSE;
+}
+
+/**
+ * Initialize the provided array instance with ring (circular) indexing, where
+ * shift/unshift operate in O(1) by moving the start slot instead of the
+ * content (deque/work-queue usage).  Content is not guaranteed contiguous,
+ * access it through the modifier and scan methods only.
+ *
+ * @param array The array instance to be initialized.
+ * @param _objSize Size of the object storage (defined by type-based macro).
+ * @param size Number of elements to preallocate in the array.  Note that a
+ *             size of zero is allowed but will not allocate the array.
+ * @return Reference to the internal array if successfully allocated or
+ *         NULL on a memory allocation failure (if size is non-zero).
+ */
+void *_WXArray_InitRing(WXArray *array, size_t _objSize, size_t size) {
+    void *retval = _WXArray_Init(array, _objSize, size);
+    array->isRing = TRUE;
+    return retval;
+}
+
+/**
+ * Combination of the ring and local initializers, a circular array running
+ * against a local (alloca) or static data block until growth forces dynamic
+ * allocation.
+ *
+ * @param array The array instance to be initialized.
+ * @param _objSize Size of the object storage (defined by type-based macro).
+ * @param data Reference to the local memory block to use for initialization.
+ * @param size The total size (in number of objects, not bytes) of the data
+ *             block.
+ */
+void _WXArray_InitRingLocal(WXArray *array, size_t _objSize, void *data,
+                            size_t size) {
+    _WXArray_InitLocal(array, _objSize, data, size);
+    array->isRing = TRUE;
 }
 
 /**
@@ -63,6 +103,7 @@ void _WXArray_InitLocal(WXArray *array, size_t _objSize, void *data,
 void WXArray_Empty(WXArray *array) {
     /* In this case, the function is really just for readability... */
     array->length = 0;
+    array->offset = 0;
 }
 
 /**
@@ -77,14 +118,31 @@ static void *WXArray_EnsureCapacity(WXArray *array, size_t capacity) {
 
     if (reqLength > allocLength) {
         /* TODO - look at the doubling algorithm in array and buffer... */
+        size_t origLength = allocLength, tail;
         allocLength <<= 1;
         if (reqLength > allocLength) allocLength = reqLength + 1;
         newArray = WXMalloc(allocLength * array->objectSize);
         if (newArray == NULL) return NULL;
         if (array->length != 0) {
             if (array->array != NULL) {
-                (void) memcpy(newArray, array->array,
-                              array->length * array->objectSize);
+                if ((array->isRing) &&
+                        (array->offset + array->length > origLength)) {
+                    /* Wrapped ring content, re-linearize in two segments */
+                    tail = origLength - array->offset;
+                    (void) memcpy(newArray,
+                                  ((uint8_t *) array->array) +
+                                          array->offset * array->objectSize,
+                                  tail * array->objectSize);
+                    (void) memcpy(((uint8_t *) newArray) +
+                                          tail * array->objectSize,
+                                  array->array,
+                                  (array->length - tail) * array->objectSize);
+                } else {
+                    (void) memcpy(newArray,
+                                  ((uint8_t *) array->array) +
+                                          array->offset * array->objectSize,
+                                  array->length * array->objectSize);
+                }
             }
         }
         if (array->allocLength >= 0) {
@@ -94,11 +152,25 @@ static void *WXArray_EnsureCapacity(WXArray *array, size_t capacity) {
         }
         array->array = newArray;
         array->allocLength = allocLength;
+        array->offset = 0;
     }
 
     return array->array;
 }
 
+/**
+ * Internal method to resolve the physical record location for a logical
+ * array index (ring instances wrap at the allocation boundary).
+ */
+static uint8_t *WXArray_Slot(WXArray *array, size_t index) {
+    size_t allocLength = (array->allocLength < 0) ? -array->allocLength :
+                                                    array->allocLength;
+    size_t slot = array->offset + index;
+
+    if ((array->isRing) && (slot >= allocLength)) slot -= allocLength;
+    return ((uint8_t *) array->array) + slot * array->objectSize;
+}
+
 /**
  * Push an object onto the end of the array instance, expanding the internal
  * array as needed.
@@ -112,8 +184,7 @@ void *WXArray_Push(WXArray *array, void *object) {
     uint8_t *endPtr;
 
     if (WXArray_EnsureCapacity(array, 1) == NULL) return NULL;
-    endPtr = ((uint8_t *) array->array) +
-                              ((array->length++) * array->objectSize);
+    endPtr = WXArray_Slot(array, array->length++);
     (void) memcpy(endPtr, object, array->objectSize);
     return endPtr;
 }
@@ -129,9 +200,9 @@ void *WXArray_Push(WXArray *array, void *object) {
  */
 void *WXArray_Pop(WXArray *array, void *object) {
     if (array->length == 0) return NULL;
-    (void) memcpy(object, ((uint8_t *) array->array) +
-                                     ((--array->length) * array->objectSize),
+    (void) memcpy(object, WXArray_Slot(array, --array->length),
                   array->objectSize);
+    if (array->length == 0) array->offset = 0;
     return object;
 }
 
@@ -146,7 +217,21 @@ void *WXArray_Pop(WXArray *array, void *object) {
  *         a reference to the pushed object as well.
  */        
 void *WXArray_Unshift(WXArray *array, void *object) {
+    size_t allocLength;
+    uint8_t *slot;
+
     if (WXArray_EnsureCapacity(array, 1) == NULL) return NULL;
+    if (array->isRing) {
+        /* Just back the start slot up (with wrap), no content movement */
+        allocLength = (array->allocLength < 0) ? -array->allocLength :
+                                                 array->allocLength;
+        array->offset = (array->offset == 0) ? allocLength - 1 :
+                                               array->offset - 1;
+        array->length++;
+        slot = WXArray_Slot(array, 0);
+        (void) memcpy(slot, object, array->objectSize);
+        return slot;
+    }
     (void) memmove(((uint8_t *) array->array) + array->objectSize,
                    array->array, (array->length++) * array->objectSize);
     (void) memcpy(array->array, object, array->objectSize);
@@ -163,7 +248,19 @@ void *WXArray_Unshift(WXArray *array, void *object) {
  *         block) or NULL if the array is empty.
  */
 void *WXArray_Shift(WXArray *array, void *object) {
+    size_t allocLength;
+
     if (array->length == 0) return NULL;
+    if (array->isRing) {
+        /* Consume the start slot and advance (with wrap), again no move */
+        (void) memcpy(object, WXArray_Slot(array, 0), array->objectSize);
+        allocLength = (array->allocLength < 0) ? -array->allocLength :
+                                                 array->allocLength;
+        array->offset = (array->offset + 1 >= allocLength) ? 0 :
+                                                             array->offset + 1;
+        if (--array->length == 0) array->offset = 0;
+        return object;
+    }
     (void) memcpy(object, array->array, array->objectSize);
     (void) memmove(array->array, ((uint8_t *) array->array) + array->objectSize,
                    (--array->length) * array->objectSize);
@@ -183,14 +280,12 @@ void *WXArray_Shift(WXArray *array, void *object) {
  *         was interrupted by the callback with the given value.
  */
 int WXArray_Scan(WXArray *array, WXArrayEntryScanCB entryCB, void *userData) {
-    uint8_t *ptr = (uint8_t *) array->array;
     unsigned int idx;
     int rc;
 
     for (idx = 0; idx < array->length; idx++) {
-        rc = (*entryCB)(array, ptr, userData);
+        rc = (*entryCB)(array, WXArray_Slot(array, idx), userData);
         if (rc != 0) return rc;
-        ptr += array->objectSize;
     }
 
     return 0;
@@ -210,4 +305,5 @@ void WXArray_Destroy(WXArray *array) {
     array->array = NULL;
     array->allocLength = 0;
     array->length = 0;
+    array->offset = 0;
 }
@@ -36,6 +36,21 @@ typedef struct WXArray {
      */
     size_t objectSize;
 
+    /**
+     * For ring-indexed instances, the physical slot of the first record
+     * (content wraps at the allocation boundary).  Always zero for standard
+     * (linear) arrays.
+     */
+    size_t offset;
+
+    /**
+     * If TRUE, the array uses ring (circular) indexing so that shift/unshift
+     * operations are O(1) slot arithmetic instead of a content move.  Note
+     * that ring content is *not* guaranteed contiguous, use the modifier and
+     * scan methods instead of direct array access.
+     */
+    int isRing;
+
     /**
      * The actual array content.  Note that this can be a globally allocated
      * memory segment or a stack block, depending on initialization (determined
@@ -75,6 +90,52 @@ void _WXArray_InitLocal(WXArray *array, size_t _objSize, void *data,
 #define WXArray_InitLocal(array, type, data, size) \
                   _WXArray_InitLocal(array, sizeof(type), data, size)
 
+/**
+ * Convenience wrapper on InitLocal for keeping small arrays inline with the
+ * owning structure or stack frame, sizing from the declared block itself
+ * (spills to dynamic allocation only on overflow).
+ *
+ * @param array The array instance to be initialized.
+ * @param type Type of object to be stored in the array, to determine sizing.
+ * @param data The inline/declared array of said type to use for storage.
+ */
+#define WXArray_InitInline(array, type, data) \
+                  _WXArray_InitLocal(array, sizeof(type), data, \
+                                     sizeof(data) / sizeof(type))
+
+/**
+ * Initialize the provided array instance with ring (circular) indexing, where
+ * shift/unshift operate in O(1) by moving the start slot instead of the
+ * content (deque/work-queue usage).  Content is not guaranteed contiguous,
+ * access it through the modifier and scan methods only.
+ *
+ * @param array The array instance to be initialized.
+ * @param type Type of object to be stored in the array, to determine sizing.
+ * @param size Number of elements to preallocate in the array.  Note that a
+ *             size of zero is allowed but will not allocate the array.
+ * @return Reference to the internal array if successfully allocated or
+ *         NULL on a memory allocation failure (if size is non-zero).
+ */
+void *_WXArray_InitRing(WXArray *array, size_t _objSize, size_t size);
+#define WXArray_InitRing(array, type, size) \
+                  _WXArray_InitRing(array, sizeof(type), size)
+
+/**
+ * Combination of the ring and local initializers, a circular array running
+ * against a local (alloca) or static data block until growth forces dynamic
+ * allocation.
+ *
+ * @param array The array instance to be initialized.
+ * @param type Type of object to be stored in the array, to determine sizing.
+ * @param data Reference to the local memory block to use for initialization.
+ * @param size The total size (in number of objects, not bytes) of the data
+ *             block.
+ */
+void _WXArray_InitRingLocal(WXArray *array, size_t _objSize, void *data,
+                            size_t size);
+#define WXArray_InitRingLocal(array, type, data, size) \
+                  _WXArray_InitRingLocal(array, sizeof(type), data, size)
+
 /**
  * Reset/empty the contents of the provided array (convenience function).
  * Resets the length/offset as though it were a newly allocated instance.
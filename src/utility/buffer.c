@@ -10,6 +10,16 @@
 #include <ctype.h>
 #include <errno.h>
 
+/* Memory-mapped file backing support (read fallback on Windows) */
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#else
+#include <io.h>
+#include <fcntl.h>
+#endif
+
 /**
  * Initialize the provided buffer instance to the indicated size (allocated
  * memory).
@@ -29,6 +39,9 @@ uint8_t *WXBuffer_Init(WXBuffer *buffer, size_t size) {
     }
     buffer->length = buffer->offset = 0;
     buffer->allocLength = (ssize_t) size;
+    buffer->arena = NULL;
+    buffer->mapAddr = NULL;
+    buffer->mapLength = 0;
 
     return buffer->buffer;
 }
@@ -47,6 +60,70 @@ void WXBuffer_InitLocal(WXBuffer *buffer, uint8_t *data, size_t size) {
     buffer->buffer = data;
     buffer->length = buffer->offset = 0;
     buffer->allocLength = -((ssize_t) size);
+    buffer->arena = NULL;
+    buffer->mapAddr = NULL;
+    buffer->mapLength = 0;
+}
+
+/**
+ * Initialize the provided buffer instance against an arena allocator.  All
+ * storage (initial and growth) carves from the arena, release of the content
+ * occurs through the reset/destroy of the arena itself - WXBuffer_Destroy()
+ * is a no-op (but safe) for arena-backed buffers.
+ *
+ * @param buffer The buffer instance to be initialized.
+ * @param arena The arena instance to carve buffer storage from.
+ * @param size The number of bytes to be preallocated into the buffer.  Note
+ *             that a size of zero is allowed but will not allocate storage.
+ * @return Reference to the internal buffer if successfully allocated or
+ *         NULL on a memory allocation failure (if size is non-zero).
+ */
+uint8_t *WXBuffer_InitArena(WXBuffer *buffer, WXArena *arena, size_t size) {
+    if (size > 0) {
+        buffer->buffer = (uint8_t *) WXArena_Alloc(arena, size);
+        if (buffer->buffer == NULL) return NULL;
+    } else {
+        buffer->buffer = NULL;
+    }
+    buffer->length = buffer->offset = 0;
+    buffer->allocLength = (ssize_t) size;
+    buffer->arena = arena;
+    buffer->mapAddr = NULL;
+    buffer->mapLength = 0;
+
+    return buffer->buffer;
+}
+
+/**
+ * Initialize the provided buffer instance as a borrowed view onto a sub-range
+ * of another buffer, sharing the underlying storage with no allocation or
+ * copy.  The view follows the local-storage semantics of WXBuffer_InitLocal()
+ * - any modification requiring growth detaches into fresh storage - but note
+ * that in-place content writes are visible through the source buffer.  The
+ * view is only valid while the source storage remains in place, any
+ * resize/destroy of the source invalidates it.
+ *
+ * @param view The buffer instance to initialize as a view (no allocation).
+ * @param src The buffer whose content is to be referenced.
+ * @param offset Offset into the source content for the start of the view,
+ *               clamped to the source length.
+ * @param length Number of bytes of source content to expose in the view,
+ *               clamped to the available content following the offset.
+ */
+void WXBuffer_Slice(WXBuffer *view, WXBuffer *src, size_t offset,
+                    size_t length) {
+    if (offset > src->length) offset = src->length;
+    if (length > src->length - offset) length = src->length - offset;
+
+    view->buffer = src->buffer + offset;
+    view->length = length;
+    view->offset = 0;
+    view->allocLength = -((ssize_t) length);
+    view->arena = src->arena;
+
+    /* The view borrows any mapped storage, ownership stays with the source */
+    view->mapAddr = NULL;
+    view->mapLength = 0;
 }
 
 /**
@@ -92,18 +169,31 @@ uint8_t *WXBuffer_EnsureCapacity(WXBuffer *buffer, size_t capacity,
         if (reqLength > allocLength) {
             allocLength <<= 1;
             if (reqLength > allocLength) allocLength = reqLength + 1;
-            newBuffer = (uint8_t *) WXMalloc(allocLength);
+            if (buffer->arena != NULL) {
+                newBuffer = (uint8_t *) WXArena_Alloc(buffer->arena,
+                                                      allocLength);
+            } else {
+                newBuffer = (uint8_t *) WXMalloc(allocLength);
+            }
             if (newBuffer == NULL) return NULL;
             if (buffer->length != 0) {
                 if (buffer->buffer != NULL) {
                     (void) memcpy(newBuffer, buffer->buffer, buffer->length);
                 }
             }
-            if (buffer->allocLength >= 0) {
+            if ((buffer->allocLength >= 0) && (buffer->arena == NULL)) {
                 if (buffer->buffer != NULL) {
                     WXFree(buffer->buffer);
                 }
             }
+#ifndef WIN32
+            if (buffer->mapAddr != NULL) {
+                /* Content copied out (detached), release the file mapping */
+                (void) munmap(buffer->mapAddr, buffer->mapLength);
+                buffer->mapAddr = NULL;
+                buffer->mapLength = 0;
+            }
+#endif
             buffer->buffer = newBuffer;
             buffer->allocLength = allocLength;
         }
@@ -326,11 +416,420 @@ uint8_t *WXBuffer_Printf(WXBuffer *buffer, const char *format, ...) {
 #define FMT_BIG_ENDIAN 1
 
 #define RPT_VAR_LEN -99999
+#define RPT_ARG_LEN -99998
 
 /* One day this might not be have to be repeated and repeated and repeated */
 static char hexchars[] = { '0', '1', '2', '3', '4', '5', '6', '7',
                            '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
 
+/**
+ * Process a single (endian-translated) pack/unpack token directly against
+ * the buffer.  Split out from the format parser so that precompiled format
+ * programs can share the exact token processing implementation.
+ */
+static uint8_t *_packToken(WXBuffer *buffer, char token, int repeatCount,
+                           va_list *ap, int isPack) {
+    uint8_t *ptr, bval, hval;
+    int slen, blen, idx;
+    uint64_t llval;
+    uint32_t lval;
+    uint16_t sval;
+    char ch, *eptr;
+
+    switch(token) {
+        /* Null padded text to specified length */
+        case 'a':
+        /* Space padded text to specified length */
+        case 'A':
+            if (isPack) {
+                eptr = va_arg(*ap, char *);
+                slen = strlen(eptr);
+                if (repeatCount == RPT_VAR_LEN) repeatCount = slen;
+                if (WXBuffer_EnsureCapacity(buffer, repeatCount,
+                                            TRUE) == NULL) return NULL;
+                if (slen >= repeatCount) {
+                    /* Just truncate */
+                    (void) memcpy(buffer->buffer + buffer->length,
+                                  eptr, repeatCount);
+                } else {
+                    /* Extension required */
+                    (void) memcpy(buffer->buffer + buffer->length,
+                                  eptr, slen);
+                    ptr = buffer->buffer + buffer->length + slen;
+                    while (slen < repeatCount) {
+                        *(ptr++) = (token == 'a') ? '\0' : ' ';
+                        slen++;
+                    }
+                }
+                buffer->length += repeatCount;
+            } else {
+                /* Note: Perl treats a and A unpack identically AFAIK */
+                blen = buffer->length - buffer->offset;
+                if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
+                else if (repeatCount > blen) repeatCount = blen;
+                if ((eptr = WXMalloc(repeatCount + 1)) == NULL) return NULL;
+                (void) memcpy(eptr, buffer->buffer + buffer->offset,
+                              repeatCount);
+                eptr[repeatCount] = '\0';
+                *(va_arg(*ap, char **)) = eptr;
+                buffer->offset += repeatCount;
+            }
+            break;
+
+        /* Bit string, ascending order */
+        case 'b':
+        /* Bit string, descending order */
+        case 'B':
+            if (isPack) {
+                eptr = va_arg(*ap, char *);
+                slen = strlen(eptr);
+                if (repeatCount == RPT_VAR_LEN) repeatCount = slen;
+                else if (slen > repeatCount) slen = repeatCount;
+
+                blen = (repeatCount + 7) / 8;
+                if (WXBuffer_EnsureCapacity(buffer, blen,
+                                            TRUE) == NULL) return NULL;
+                ptr = buffer->buffer + buffer->length;
+                buffer->length += blen;
+                blen *= 8;
+                for (idx = 0, bval = 0; idx < blen; idx++) {
+                    ch = (idx < slen) ? *(eptr++) : '0';
+                    bval = (token == 'b') ? (bval >> 1) : (bval << 1);
+                    if ((ch & 0x01) != 0) {
+                        bval |= (token == 'b') ? 0x80 : 0x01;
+                    }
+                    if ((idx & 0x07) == 0x07) {
+                        *(ptr++) = bval;
+                        bval = 0;
+                    }
+                }
+            } else {
+                blen = (buffer->length - buffer->offset) * 8;
+                if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
+                else if (repeatCount > blen) repeatCount = blen;
+                if ((eptr = WXMalloc(repeatCount + 1)) == NULL) return NULL;
+                bval = *(ptr = buffer->buffer + buffer->offset);
+                *(va_arg(*ap, char **)) = eptr;
+                for (idx = 0; idx < repeatCount; idx++) {
+                    if (token == 'b') {
+                        *(eptr++) = ((bval & 0x01) != 0) ? '1' : '0';
+                        bval = bval >> 1;
+                    } else {
+                        *(eptr++) = ((bval & 0x80) != 0) ? '1' : '0';
+                        bval = bval << 1;
+                    }
+                    if ((idx & 0x07) == 0x07) bval = *(++ptr);
+                }
+                *eptr = '\0';
+                buffer->offset += (repeatCount + 7) / 8;
+            }
+            break;
+
+        /* Hex string, low nybble first */
+        case 'h':
+        /* Hex string, high nybble first */
+        case 'H':
+            if (isPack) {
+                eptr = va_arg(*ap, char *);
+                slen = strlen(eptr);
+                if (repeatCount == RPT_VAR_LEN) repeatCount = slen;
+                else if (slen > repeatCount) slen = repeatCount;
+
+                blen = (repeatCount + 1) / 2;
+                if (WXBuffer_EnsureCapacity(buffer, blen,
+                                            TRUE) == NULL) return NULL;
+                ptr = buffer->buffer + buffer->length;
+                buffer->length += blen;
+                blen *= 2;
+                for (idx = 0, bval = 0; idx < blen; idx++) {
+                    ch = (idx < slen) ? *(eptr++) : '0';
+                    if (isalpha(ch)) hval = (ch + 9) & 0x0F;
+                    else hval = ch & 0x0F;
+                    if ((idx & 0x01) == 0) {
+                        bval |= (token == 'h') ? hval : (hval << 4);
+                    } else {
+                        bval |= (token == 'h') ? (hval << 4) : hval;
+                        *(ptr++) = bval;
+                        bval = 0;
+                    }
+                }
+            } else {
+                blen = (buffer->length - buffer->offset) * 2;
+                if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
+                else if (repeatCount > blen) repeatCount = blen;
+                if ((eptr = WXMalloc(repeatCount + 1)) == NULL) return NULL;
+                bval = *(ptr = buffer->buffer + buffer->offset);
+                *(va_arg(*ap, char **)) = eptr;
+                for (idx = 0; idx < repeatCount; idx++) {
+                    if ((token == 'h') || ((idx & 0x01) != 0)) {
+                        *(eptr++) = hexchars[bval & 0x0F];
+                        bval = bval >> 4;
+                    } else {
+                        *(eptr++) = hexchars[(bval >> 4) & 0x0F];
+                        /* Other half covered by second part of if cond'n */
+                    }
+                    if ((idx & 0x01) != 0) bval = *(++ptr);
+                }
+                *eptr = '\0';
+                buffer->offset += (repeatCount + 1) / 2;
+            }
+            break;
+
+        /* Signed/unsigned 8-bit value */
+        case 'c':
+        case 'C':
+            if (isPack) {
+                if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
+                if (WXBuffer_EnsureCapacity(buffer, repeatCount,
+                                            TRUE) == NULL) return NULL;
+                ptr = buffer->buffer + buffer->length;
+                buffer->length += repeatCount;
+                while (repeatCount > 0) {
+                    /* Note that char enlarges to int */
+                    *(ptr++) = (uint8_t) va_arg(*ap, unsigned int);
+                    repeatCount--;
+                }
+            } else {
+                blen = buffer->length - buffer->offset;
+                if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
+                else if (repeatCount > blen) repeatCount = blen;
+                ptr = buffer->buffer + buffer->offset;
+                buffer->offset += repeatCount;
+                while (repeatCount > 0) {
+                    *(va_arg(*ap, uint8_t *)) = *(ptr++);
+                    repeatCount--;
+                }
+            }
+            break;
+
+        /* Signed/unsigned 16-bit value */
+        case 's':
+        case 'S':
+        /* Network (big-endian) unsigned 16-bit value */
+        case 'n':
+        /* Vax (little-endian) unsigned 16-bit value */
+        case 'v':
+            if (isPack) {
+                if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
+                if (WXBuffer_EnsureCapacity(buffer, repeatCount * 2,
+                                            TRUE) == NULL) return NULL;
+                ptr = buffer->buffer + buffer->length;
+                buffer->length += repeatCount * 2;
+                while (repeatCount > 0) {
+                    /* Note that short enlarges to int */
+                    sval = (uint16_t) va_arg(*ap, unsigned int);
+                    if (token == 'n') sval = htons(sval);
+                    else if (token == 'v') {
+                        sval = htons(sval);
+                        sval = bswap16(sval);
+                    }
+                    *((uint16_t *) ptr) = sval;
+                    ptr += 2;
+                    repeatCount--;
+                }
+            } else {
+                blen = (buffer->length - buffer->offset) / 2;
+                if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
+                else if (repeatCount > blen) repeatCount = blen;
+                ptr = buffer->buffer + buffer->offset;
+                buffer->offset += repeatCount * 2;
+                while (repeatCount > 0) {
+                    sval = *((uint16_t *) ptr);
+                    if (token == 'n') sval = ntohs(sval);
+                    else if (token == 'v') {
+                        sval = ntohs(sval);
+                        sval = bswap16(sval);
+                    }
+                    *(va_arg(*ap, uint16_t *)) = sval;
+                    ptr += 2;
+                    repeatCount--;
+                }
+            }
+            break;
+
+        /* Signed/unsigned 32-bit value */
+        case 'l':
+        case 'L':
+        /* Network (big-endian) unsigned 32-bit value */
+        case 'N':
+        /* Vax (little-endian) unsigned 32-bit value */
+        case 'V':
+            if (isPack) {
+                if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
+                if (WXBuffer_EnsureCapacity(buffer, repeatCount * 4,
+                                            TRUE) == NULL) return NULL;
+                ptr = buffer->buffer + buffer->length;
+                buffer->length += repeatCount * 4;
+                while (repeatCount > 0) {
+                    lval = (uint32_t) va_arg(*ap, uint32_t);
+                    if (token == 'N') lval = htonl(lval);
+                    else if (token == 'V') {
+                        lval = htonl(lval);
+                        lval = bswap32(lval);
+                    }
+                    *((uint32_t *) ptr) = lval;
+                    ptr += 4;
+                    repeatCount--;
+                }
+            } else {
+                blen = (buffer->length - buffer->offset) / 4;
+                if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
+                else if (repeatCount > blen) repeatCount = blen;
+                ptr = buffer->buffer + buffer->offset;
+                buffer->offset += repeatCount * 4;
+                while (repeatCount > 0) {
+                    lval = *((uint32_t *) ptr);
+                    if (token == 'N') lval = ntohl(lval);
+                    else if (token == 'V') {
+                        lval = ntohl(lval);
+                        lval = bswap32(lval);
+                    }
+                    *(va_arg(*ap, uint32_t *)) = lval;
+                    ptr += 4;
+                    repeatCount--;
+                }
+            }
+            break;
+
+        /* Signed/unsigned 64-bit value */
+        case 'q':
+        case 'Q':
+        /* Network (big-endian) unsigned 64-bit value */
+        case 'z':
+        /* Vax (little-endian) unsigned 64-bit value */
+        case 'Z':
+            if (isPack) {
+                if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
+                if (WXBuffer_EnsureCapacity(buffer, repeatCount * 8,
+                                            TRUE) == NULL) return NULL;
+                ptr = buffer->buffer + buffer->length;
+                buffer->length += repeatCount * 8;
+                while (repeatCount > 0) {
+                    llval = (uint64_t) va_arg(*ap, uint64_t);
+                    if (token == 'z') llval = htonll(llval);
+                    else if (token == 'Z') {
+                        llval = htonll(llval);
+                        llval = bswap64(llval);
+                    }
+                    *((uint64_t *) ptr) = llval;
+                    ptr += 4;
+                    repeatCount--;
+                }
+            } else {
+                blen = (buffer->length - buffer->offset) / 8;
+                if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
+                else if (repeatCount > blen) repeatCount = blen;
+                ptr = buffer->buffer + buffer->offset;
+                buffer->offset += repeatCount * 8;
+                while (repeatCount > 0) {
+                    llval = *((uint64_t *) ptr);
+                    if (token == 'z') llval = htonll(llval);
+                    else if (token == 'Z') {
+                        llval = ntohll(llval);
+                        llval = bswap64(llval);
+                    }
+                    *(va_arg(*ap, uint64_t *)) = llval;
+                    ptr += 8;
+                    repeatCount--;
+                }
+            }
+            break;
+
+        /* Null byte (0x0) */
+        case 'x':
+            if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
+            if (isPack) {
+                if (WXBuffer_EnsureCapacity(buffer, repeatCount,
+                                            TRUE) == NULL) return NULL;
+                ptr = buffer->buffer + buffer->length;
+                buffer->length += repeatCount;
+                while (repeatCount > 0) {
+                    *(ptr++) = 0x0;
+                    repeatCount--;
+                }
+            } else {
+                if (buffer->offset + repeatCount > buffer->length) {
+                    /* Out of room */
+                    return NULL;
+                }
+                buffer->offset += repeatCount;
+            }
+            break;
+
+        /* Reverse a byte in the buffer */
+        case 'X':
+            if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
+            /* This is a lot easier.. */
+            if (isPack) {
+                if (repeatCount > (int) buffer->length) {
+                    buffer->length = 0;
+                } else {
+                    buffer->length -= repeatCount;
+                }
+            } else {
+                if (repeatCount > (int) buffer->offset) {
+                    buffer->offset = 0;
+                } else {
+                    buffer->offset -= repeatCount;
+                }
+            }
+            break;
+
+        /* Handle 32-bit and 64-bit varints */
+        case 'y':
+        case 'Y':
+            if (isPack) {
+                if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
+                if (WXBuffer_EnsureCapacity(buffer, repeatCount * 10,
+                                            TRUE) == NULL) return NULL;
+                ptr = buffer->buffer + buffer->length;
+                while (repeatCount > 0) {
+                    if (token == 'y') {
+                        llval = (uint64_t) va_arg(*ap, uint32_t);
+                    } else {
+                        llval = (uint64_t) va_arg(*ap, uint64_t);
+                    }
+                    if (llval == 0) {
+                        *(ptr++) = 0x0;
+                        buffer->length++;
+                    } else {
+                        while (llval != 0) {
+                            bval = (uint8_t) (llval & 0x7F);
+                            llval = llval >> 7;
+                            if (llval != 0) bval |= 0x80;
+                            *(ptr++) = bval;
+                            buffer->length++;
+                        }
+                    }
+                    repeatCount--;
+                }
+            } else {
+                llval = idx = 0;
+                ptr = buffer->buffer + buffer->offset;
+                while (((repeatCount > 0) ||
+                                  (repeatCount == RPT_VAR_LEN)) &&
+                           (buffer->offset < buffer->length)) {
+                    bval = *(ptr++);
+                    buffer->offset++;
+                    llval |= (bval & 0x7F) << idx;
+                    idx += 7;
+                    if ((bval & 0x80) == 0) {
+                        if (token == 'y') {
+                            *(va_arg(*ap, uint32_t *)) = (uint32_t) llval;
+                        } else {
+                            *(va_arg(*ap, uint64_t *)) = llval;
+                        }
+                        llval = idx = 0;
+                        if (repeatCount > 0) repeatCount--;
+                    }
+                }
+            }
+            break;
+    }
+
+    return buffer->buffer;
+}
+
 /**
  * Pack a set of values into the buffer according to the (modified) Perl
  * binary pack format.  The packing mechanism recognizes the fixed patterns
@@ -349,12 +848,8 @@ static char hexchars[] = { '0', '1', '2', '3', '4', '5', '6', '7',
  */
 static uint8_t *_pack(WXBuffer *buffer, const char *format, size_t flen,
                       va_list *ap, int endian, int isPack) {
-    int actvEnd, repeatCount, brCount, grpLen, slen, blen, idx;
-    char ch, token, *grpStart, *eptr;
-    uint8_t *ptr, bval, hval;
-    uint64_t llval;
-    uint32_t lval;
-    uint16_t sval;
+    int actvEnd, repeatCount, brCount, grpLen;
+    char token, *grpStart, *eptr;
 
     /* Churn through the format instance, packing as we go */
     while (flen > 0) {
@@ -488,393 +983,10 @@ static uint8_t *_pack(WXBuffer *buffer, const char *format, size_t flen,
                 }
                 break;
 
-            /* Null padded text to specified length */
-            case 'a':
-            /* Space padded text to specified length */
-            case 'A':
-                if (isPack) {
-                    eptr = va_arg(*ap, char *);
-                    slen = strlen(eptr);
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = slen;
-                    if (WXBuffer_EnsureCapacity(buffer, repeatCount,
-                                                TRUE) == NULL) return NULL;
-                    if (slen >= repeatCount) {
-                        /* Just truncate */
-                        (void) memcpy(buffer->buffer + buffer->length,
-                                      eptr, repeatCount);
-                    } else {
-                        /* Extension required */
-                        (void) memcpy(buffer->buffer + buffer->length,
-                                      eptr, slen);
-                        ptr = buffer->buffer + buffer->length + slen;
-                        while (slen < repeatCount) {
-                            *(ptr++) = (token == 'a') ? '\0' : ' ';
-                            slen++;
-                        }
-                    }
-                    buffer->length += repeatCount;
-                } else {
-                    /* Note: Perl treats a and A unpack identically AFAIK */
-                    blen = buffer->length - buffer->offset;
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
-                    else if (repeatCount > blen) repeatCount = blen;
-                    if ((eptr = WXMalloc(repeatCount + 1)) == NULL) return NULL;
-                    (void) memcpy(eptr, buffer->buffer + buffer->offset,
-                                  repeatCount);
-                    eptr[repeatCount] = '\0';
-                    *(va_arg(*ap, char **)) = eptr;
-                    buffer->offset += repeatCount;
-                }
-                break;
-
-            /* Bit string, ascending order */
-            case 'b':
-            /* Bit string, descending order */
-            case 'B':
-                if (isPack) {
-                    eptr = va_arg(*ap, char *);
-                    slen = strlen(eptr);
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = slen;
-                    else if (slen > repeatCount) slen = repeatCount;
-
-                    blen = (repeatCount + 7) / 8;
-                    if (WXBuffer_EnsureCapacity(buffer, blen,
-                                                TRUE) == NULL) return NULL;
-                    ptr = buffer->buffer + buffer->length;
-                    buffer->length += blen;
-                    blen *= 8;
-                    for (idx = 0, bval = 0; idx < blen; idx++) {
-                        ch = (idx < slen) ? *(eptr++) : '0';
-                        bval = (token == 'b') ? (bval >> 1) : (bval << 1);
-                        if ((ch & 0x01) != 0) {
-                            bval |= (token == 'b') ? 0x80 : 0x01;
-                        }
-                        if ((idx & 0x07) == 0x07) {
-                            *(ptr++) = bval;
-                            bval = 0;
-                        }
-                    }
-                } else {
-                    blen = (buffer->length - buffer->offset) * 8;
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
-                    else if (repeatCount > blen) repeatCount = blen;
-                    if ((eptr = WXMalloc(repeatCount + 1)) == NULL) return NULL;
-                    bval = *(ptr = buffer->buffer + buffer->offset);
-                    *(va_arg(*ap, char **)) = eptr;
-                    for (idx = 0; idx < repeatCount; idx++) {
-                        if (token == 'b') {
-                            *(eptr++) = ((bval & 0x01) != 0) ? '1' : '0';
-                            bval = bval >> 1;
-                        } else {
-                            *(eptr++) = ((bval & 0x80) != 0) ? '1' : '0';
-                            bval = bval << 1;
-                        }
-                        if ((idx & 0x07) == 0x07) bval = *(++ptr);
-                    }
-                    *eptr = '\0';
-                    buffer->offset += (repeatCount + 7) / 8;
-                }
-                break;
-
-            /* Hex string, low nybble first */
-            case 'h':
-            /* Hex string, high nybble first */
-            case 'H':
-                if (isPack) {
-                    eptr = va_arg(*ap, char *);
-                    slen = strlen(eptr);
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = slen;
-                    else if (slen > repeatCount) slen = repeatCount;
-
-                    blen = (repeatCount + 1) / 2;
-                    if (WXBuffer_EnsureCapacity(buffer, blen,
-                                                TRUE) == NULL) return NULL;
-                    ptr = buffer->buffer + buffer->length;
-                    buffer->length += blen;
-                    blen *= 2;
-                    for (idx = 0, bval = 0; idx < blen; idx++) {
-                        ch = (idx < slen) ? *(eptr++) : '0';
-                        if (isalpha(ch)) hval = (ch + 9) & 0x0F;
-                        else hval = ch & 0x0F;
-                        if ((idx & 0x01) == 0) {
-                            bval |= (token == 'h') ? hval : (hval << 4);
-                        } else {
-                            bval |= (token == 'h') ? (hval << 4) : hval;
-                            *(ptr++) = bval;
-                            bval = 0;
-                        }
-                    }
-                } else {
-                    blen = (buffer->length - buffer->offset) * 2;
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
-                    else if (repeatCount > blen) repeatCount = blen;
-                    if ((eptr = WXMalloc(repeatCount + 1)) == NULL) return NULL;
-                    bval = *(ptr = buffer->buffer + buffer->offset);
-                    *(va_arg(*ap, char **)) = eptr;
-                    for (idx = 0; idx < repeatCount; idx++) {
-                        if ((token == 'h') || ((idx & 0x01) != 0)) {
-                            *(eptr++) = hexchars[bval & 0x0F];
-                            bval = bval >> 4;
-                        } else {
-                            *(eptr++) = hexchars[(bval >> 4) & 0x0F];
-                            /* Other half covered by second part of if cond'n */
-                        }
-                        if ((idx & 0x01) != 0) bval = *(++ptr);
-                    }
-                    *eptr = '\0';
-                    buffer->offset += (repeatCount + 1) / 2;
-                }
-                break;
-
-            /* Signed/unsigned 8-bit value */
-            case 'c':
-            case 'C':
-                if (isPack) {
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
-                    if (WXBuffer_EnsureCapacity(buffer, repeatCount,
-                                                TRUE) == NULL) return NULL;
-                    ptr = buffer->buffer + buffer->length;
-                    buffer->length += repeatCount;
-                    while (repeatCount > 0) {
-                        /* Note that char enlarges to int */
-                        *(ptr++) = (uint8_t) va_arg(*ap, unsigned int);
-                        repeatCount--;
-                    }
-                } else {
-                    blen = buffer->length - buffer->offset;
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
-                    else if (repeatCount > blen) repeatCount = blen;
-                    ptr = buffer->buffer + buffer->offset;
-                    buffer->offset += repeatCount;
-                    while (repeatCount > 0) {
-                        *(va_arg(*ap, uint8_t *)) = *(ptr++);
-                        repeatCount--;
-                    }
-                }
-                break;
-
-            /* Signed/unsigned 16-bit value */
-            case 's':
-            case 'S':
-            /* Network (big-endian) unsigned 16-bit value */
-            case 'n':
-            /* Vax (little-endian) unsigned 16-bit value */
-            case 'v':
-                if (isPack) {
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
-                    if (WXBuffer_EnsureCapacity(buffer, repeatCount * 2,
-                                                TRUE) == NULL) return NULL;
-                    ptr = buffer->buffer + buffer->length;
-                    buffer->length += repeatCount * 2;
-                    while (repeatCount > 0) {
-                        /* Note that short enlarges to int */
-                        sval = (uint16_t) va_arg(*ap, unsigned int);
-                        if (token == 'n') sval = htons(sval);
-                        else if (token == 'v') {
-                            sval = htons(sval);
-                            sval = bswap16(sval);
-                        }
-                        *((uint16_t *) ptr) = sval;
-                        ptr += 2;
-                        repeatCount--;
-                    }
-                } else {
-                    blen = (buffer->length - buffer->offset) / 2;
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
-                    else if (repeatCount > blen) repeatCount = blen;
-                    ptr = buffer->buffer + buffer->offset;
-                    buffer->offset += repeatCount * 2;
-                    while (repeatCount > 0) {
-                        sval = *((uint16_t *) ptr);
-                        if (token == 'n') sval = ntohs(sval);
-                        else if (token == 'v') {
-                            sval = ntohs(sval);
-                            sval = bswap16(sval);
-                        }
-                        *(va_arg(*ap, uint16_t *)) = sval;
-                        ptr += 2;
-                        repeatCount--;
-                    }
-                }
-                break;
-
-            /* Signed/unsigned 32-bit value */
-            case 'l':
-            case 'L':
-            /* Network (big-endian) unsigned 32-bit value */
-            case 'N':
-            /* Vax (little-endian) unsigned 32-bit value */
-            case 'V':
-                if (isPack) {
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
-                    if (WXBuffer_EnsureCapacity(buffer, repeatCount * 4,
-                                                TRUE) == NULL) return NULL;
-                    ptr = buffer->buffer + buffer->length;
-                    buffer->length += repeatCount * 4;
-                    while (repeatCount > 0) {
-                        lval = (uint32_t) va_arg(*ap, uint32_t);
-                        if (token == 'N') lval = htonl(lval);
-                        else if (token == 'V') {
-                            lval = htonl(lval);
-                            lval = bswap32(lval);
-                        }
-                        *((uint32_t *) ptr) = lval;
-                        ptr += 4;
-                        repeatCount--;
-                    }
-                } else {
-                    blen = (buffer->length - buffer->offset) / 4;
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
-                    else if (repeatCount > blen) repeatCount = blen;
-                    ptr = buffer->buffer + buffer->offset;
-                    buffer->offset += repeatCount * 4;
-                    while (repeatCount > 0) {
-                        lval = *((uint32_t *) ptr);
-                        if (token == 'N') lval = ntohl(lval);
-                        else if (token == 'V') {
-                            lval = ntohl(lval);
-                            lval = bswap32(lval);
-                        }
-                        *(va_arg(*ap, uint32_t *)) = lval;
-                        ptr += 4;
-                        repeatCount--;
-                    }
-                }
-                break;
-
-            /* Signed/unsigned 64-bit value */
-            case 'q':
-            case 'Q':
-            /* Network (big-endian) unsigned 64-bit value */
-            case 'z':
-            /* Vax (little-endian) unsigned 64-bit value */
-            case 'Z':
-                if (isPack) {
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
-                    if (WXBuffer_EnsureCapacity(buffer, repeatCount * 8,
-                                                TRUE) == NULL) return NULL;
-                    ptr = buffer->buffer + buffer->length;
-                    buffer->length += repeatCount * 8;
-                    while (repeatCount > 0) {
-                        llval = (uint64_t) va_arg(*ap, uint64_t);
-                        if (token == 'z') llval = htonll(llval);
-                        else if (token == 'Z') {
-                            llval = htonll(llval);
-                            llval = bswap64(llval);
-                        }
-                        *((uint64_t *) ptr) = llval;
-                        ptr += 4;
-                        repeatCount--;
-                    }
-                } else {
-                    blen = (buffer->length - buffer->offset) / 8;
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = blen;
-                    else if (repeatCount > blen) repeatCount = blen;
-                    ptr = buffer->buffer + buffer->offset;
-                    buffer->offset += repeatCount * 8;
-                    while (repeatCount > 0) {
-                        llval = *((uint64_t *) ptr);
-                        if (token == 'z') llval = htonll(llval);
-                        else if (token == 'Z') {
-                            llval = ntohll(llval);
-                            llval = bswap64(llval);
-                        }
-                        *(va_arg(*ap, uint64_t *)) = llval;
-                        ptr += 8;
-                        repeatCount--;
-                    }
-                }
-                break;
-
-            /* Null byte (0x0) */
-            case 'x':
-                if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
-                if (isPack) {
-                    if (WXBuffer_EnsureCapacity(buffer, repeatCount,
-                                                TRUE) == NULL) return NULL;
-                    ptr = buffer->buffer + buffer->length;
-                    buffer->length += repeatCount;
-                    while (repeatCount > 0) {
-                        *(ptr++) = 0x0;
-                        repeatCount--;
-                    }
-                } else {
-                    if (buffer->offset + repeatCount > buffer->length) {
-                        /* Out of room */
-                        return NULL;
-                    }
-                    buffer->offset += repeatCount;
-                }
-                break;
-
-            /* Reverse a byte in the buffer */
-            case 'X':
-                if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
-                /* This is a lot easier.. */
-                if (isPack) {
-                    if (repeatCount > (int) buffer->length) {
-                        buffer->length = 0;
-                    } else {
-                        buffer->length -= repeatCount;
-                    }
-                } else {
-                    if (repeatCount > (int) buffer->offset) {
-                        buffer->offset = 0;
-                    } else {
-                        buffer->offset -= repeatCount;
-                    }
-                }
-                break;
-
-            /* Handle 32-bit and 64-bit varints */
-            case 'y':
-            case 'Y':
-                if (isPack) {
-                    if (repeatCount == RPT_VAR_LEN) repeatCount = 1;
-                    if (WXBuffer_EnsureCapacity(buffer, repeatCount * 10,
-                                                TRUE) == NULL) return NULL;
-                    ptr = buffer->buffer + buffer->length;
-                    while (repeatCount > 0) {
-                        if (token == 'y') {
-                            llval = (uint64_t) va_arg(*ap, uint32_t);
-                        } else {
-                            llval = (uint64_t) va_arg(*ap, uint64_t);
-                        }
-                        if (llval == 0) {
-                            *(ptr++) = 0x0;
-                            buffer->length++;
-                        } else {
-                            while (llval != 0) {
-                                bval = (uint8_t) (llval & 0x7F);
-                                llval = llval >> 7;
-                                if (llval != 0) bval |= 0x80;
-                                *(ptr++) = bval;
-                                buffer->length++;
-                            }
-                        }
-                        repeatCount--;
-                    }
-                } else {
-                    llval = idx = 0;
-                    ptr = buffer->buffer + buffer->offset;
-                    while (((repeatCount > 0) ||
-                                      (repeatCount == RPT_VAR_LEN)) &&
-                               (buffer->offset < buffer->length)) {
-                        bval = *(ptr++);
-                        buffer->offset++;
-                        llval |= (bval & 0x7F) << idx;
-                        idx += 7;
-                        if ((bval & 0x80) == 0) {
-                            if (token == 'y') {
-                                *(va_arg(*ap, uint32_t *)) = (uint32_t) llval;
-                            } else {
-                                *(va_arg(*ap, uint64_t *)) = llval;
-                            }
-                            llval = idx = 0;
-                            if (repeatCount > 0) repeatCount--;
-                        }
-                    }
-                }
+            /* Everything else is a simple token, process directly */
+            default:
+                if (_packToken(buffer, token, repeatCount, ap,
+                               isPack) == NULL) return NULL;
                 break;
         }
     }
@@ -952,7 +1064,349 @@ uint8_t *WXBuffer_VUnpack(WXBuffer *buffer, const char *format, va_list ap) {
                  FMT_NATURAL_ENDIAN, FALSE);
 }
 
-/**
+/* Append a single operation to the compiled format program (list) */
+static int _pushPackOp(WXPackFormat *prog, char token, int repeatCount) {
+    WXPackOp *ops;
+
+    ops = (WXPackOp *) WXRealloc(prog->ops,
+                                 (prog->opCount + 1) * sizeof(WXPackOp));
+    if (ops == NULL) return FALSE;
+    ops[prog->opCount].token = token;
+    ops[prog->opCount].repeatCount = repeatCount;
+    prog->ops = ops;
+    prog->opCount++;
+
+    return TRUE;
+}
+
+/* Parse (mirroring _pack exactly) a format into the program, recursively */
+static int _compileFormat(WXPackFormat *prog, const char *format, size_t flen,
+                          int endian) {
+    int actvEnd, repeatCount, brCount, grpLen;
+    char token, *grpStart, *eptr;
+
+    /* Churn through the format instance, compiling as we go */
+    while (flen > 0) {
+        while ((flen > 0) && isspace(*format)) { format++; flen--; }
+        if (flen <= 0) break;
+        token = *(format++); flen--;
+
+        /* Groups are special and can be nested */
+        if (token == '(') {
+            brCount = 1;
+            grpStart = (char *) format;
+            while (flen > 0) {
+                if (*format == '(') brCount++;
+                else if (*format == ')') brCount--;
+                format++; flen--;
+                if (brCount == 0) break;
+            }
+            if (brCount == 0) {
+                grpLen = (format - grpStart) - 1;
+            } else {
+                /* Unterminated group, bail (matching parser behaviour) */
+                break;
+            }
+        }
+
+        /* Parse token modifiers */
+        actvEnd = endian;
+        while (flen > 0) {
+            while ((flen > 0) && isspace(*format)) { format++; flen--; }
+            if (flen <= 0) break;
+            if (*format == '<') {
+                actvEnd = FMT_LITTLE_ENDIAN;
+                format++; flen--;
+            } else if (*format == '>') {
+                actvEnd = FMT_BIG_ENDIAN;
+                format++; flen--;
+            } else if (*format == '!') {
+                /* Just ignore */
+                format++; flen--;
+            } else {
+                /* Out of formatters */
+                break;
+            }
+        }
+
+        /* Token changes based on forced endian-ness */
+        if (actvEnd == FMT_BIG_ENDIAN) {
+            switch (token) {
+                case 's':
+                case 'S':
+                    token = 'n';
+                    break;
+                case 'l':
+                case 'L':
+                    token = 'N';
+                    break;
+                case 'q':
+                case 'Q':
+                    token = 'z';
+                    break;
+            }
+        } else if (actvEnd == FMT_LITTLE_ENDIAN) {
+            switch (token) {
+                case 's':
+                case 'S':
+                    token = 'v';
+                    break;
+                case 'l':
+                case 'L':
+                    token = 'V';
+                    break;
+                case 'q':
+                case 'Q':
+                    token = 'Z';
+                    break;
+            }
+        }
+
+        /* Repeaters... */
+        repeatCount = 1;
+        if (flen > 0) {
+            if (isdigit(*format)) {
+                repeatCount = strtol(format, &eptr, 10);
+                flen -= eptr - format;
+                format = eptr;
+            } else if (*format == '[') {
+                if (strncmp(format, "[%]", 3) == 0) {
+                    repeatCount = RPT_ARG_LEN;
+                    format += 3; flen -= 3;
+                } else if (strncmp(format, "[*]", 3) == 0) {
+                    repeatCount = RPT_VAR_LEN;
+                    format += 3; flen -= 3;
+                } else {
+                    repeatCount = strtol(format + 1, &eptr, 10);
+                    if (*eptr == ']') {
+                        flen -= (eptr - format) + 1;
+                        format = eptr + 1;
+                    } else {
+                        /* Garbage count indicator, bail */
+                        break;
+                    }
+                }
+            } else if (*format == '%') {
+                repeatCount = RPT_ARG_LEN;
+                format++; flen--;
+            } else if (*format == '*') {
+                repeatCount = RPT_VAR_LEN;
+                format++; flen--;
+            }
+        }
+        if ((repeatCount <= 0) && (repeatCount != RPT_VAR_LEN) &&
+                (repeatCount != RPT_ARG_LEN)) continue;
+
+        if (token == '(') {
+            /* Variable group counts cannot be unrolled at compile time */
+            if (repeatCount < 0) return FALSE;
+            while (repeatCount > 0) {
+                if (!_compileFormat(prog, grpStart, grpLen,
+                                    actvEnd)) return FALSE;
+                repeatCount--;
+            }
+        } else if (strchr("aAbBhHcCsSnvlLNVqQzZxXyY", token) != NULL) {
+            if (!_pushPackOp(prog, token, repeatCount)) return FALSE;
+        }
+        /* Unrecognized tokens are silently ignored, as in the parser */
+    }
+
+    return TRUE;
+}
+
+/**
+ * Compile a pack/unpack format specification into a reusable operation
+ * program, eliminating the per-call format parsing overhead for record
+ * layouts that are packed repeatedly.  Supports the full format syntax of
+ * the Pack() method except for groups with variable ('%' or '*') repeat
+ * counts, which cannot be unrolled at compile time.
+ *
+ * @param format The format to be compiled, as defined in the Pack() method.
+ * @return The compiled format program or NULL on a memory allocation
+ *         failure or an uncompilable format specification.
+ */
+WXPackFormat *WXBuffer_CompileFormat(const char *format) {
+    WXPackFormat *prog;
+    WXPackOp *op;
+    size_t idx, opSize, sizeBound = 0;
+
+    if ((prog = (WXPackFormat *) WXCalloc(sizeof(WXPackFormat))) == NULL) {
+        return NULL;
+    }
+    if (!_compileFormat(prog, format, strlen(format), FMT_NATURAL_ENDIAN)) {
+        WXBuffer_DestroyFormat(prog);
+        return NULL;
+    }
+
+    /* Where all counts are fixed, precompute the total packing size so a
+     * single capacity check can front the compiled execution loop */
+    for (idx = 0, op = prog->ops; idx < prog->opCount; idx++, op++) {
+        if (op->repeatCount < 0) {
+            sizeBound = 0;
+            break;
+        }
+        switch (op->token) {
+            case 'a':
+            case 'A':
+            case 'c':
+            case 'C':
+            case 'x':
+                opSize = op->repeatCount;
+                break;
+            case 'b':
+            case 'B':
+                opSize = (op->repeatCount + 7) / 8;
+                break;
+            case 'h':
+            case 'H':
+                opSize = (op->repeatCount + 1) / 2;
+                break;
+            case 's':
+            case 'S':
+            case 'n':
+            case 'v':
+                opSize = op->repeatCount * 2;
+                break;
+            case 'l':
+            case 'L':
+            case 'N':
+            case 'V':
+                opSize = op->repeatCount * 4;
+                break;
+            case 'q':
+            case 'Q':
+            case 'z':
+            case 'Z':
+                opSize = op->repeatCount * 8;
+                break;
+            case 'y':
+            case 'Y':
+                /* Matching the worst-case varint estimate of the packer */
+                opSize = op->repeatCount * 10;
+                break;
+            default:
+                opSize = 0;
+                break;
+        }
+        sizeBound += opSize;
+    }
+    prog->sizeBound = sizeBound;
+
+    return prog;
+}
+
+/**
+ * Release the contents of a compiled format program created by the
+ * CompileFormat() method.
+ *
+ * @param format The compiled format program to be destroyed/freed.
+ */
+void WXBuffer_DestroyFormat(WXPackFormat *format) {
+    if (format->ops != NULL) WXFree(format->ops);
+    WXFree(format);
+}
+
+/* Tight dispatch loop for compiled pack/unpack program execution */
+static uint8_t *_packCompiled(WXBuffer *buffer, WXPackFormat *format,
+                              va_list *ap, int isPack) {
+    WXPackOp *op = format->ops;
+    int repeatCount;
+    size_t idx;
+
+    /* One capacity reservation where the program size is predetermined */
+    if ((isPack) && (format->sizeBound != 0)) {
+        if (WXBuffer_EnsureCapacity(buffer, format->sizeBound,
+                                    TRUE) == NULL) return NULL;
+    }
+
+    for (idx = 0; idx < format->opCount; idx++, op++) {
+        repeatCount = op->repeatCount;
+        if (repeatCount == RPT_ARG_LEN) {
+            repeatCount = va_arg(*ap, int);
+            if (repeatCount <= 0) continue;
+        }
+        if (_packToken(buffer, op->token, repeatCount, ap,
+                       isPack) == NULL) return NULL;
+    }
+
+    return buffer->buffer;
+}
+
+/**
+ * Pack a set of values into the buffer according to a compiled format
+ * program, identical in outcome to the Pack() method for the originating
+ * format string but without the per-call parsing overhead.
+ *
+ * @param buffer The buffer instance to pack into.
+ * @param format The compiled format program, from CompileFormat().
+ * @param ... The argument set for the pack, according to the format.
+ * @return Reference to the internal buffer if successfully (re)allocated or
+ *         NULL on a memory allocation failure.
+ */
+uint8_t *WXBuffer_PackCompiled(WXBuffer *buffer, WXPackFormat *format, ...) {
+    uint8_t *content;
+    va_list ap;
+
+    va_start(ap, format);
+    content = _packCompiled(buffer, format, &ap, TRUE);
+    va_end(ap);
+
+    return content;
+}
+
+/**
+ * Identical to the above, but pack based on an explicit varargs instance.
+ *
+ * @param buffer The buffer instance to pack into.
+ * @param format The compiled format program, from CompileFormat().
+ * @param ap The allocated vararg instance.  Note that the state of this
+ *           is indeterminant after the call.
+ * @return Reference to the internal buffer if successfully (re)allocated or
+ *         NULL on a memory allocation failure.
+ */
+uint8_t *WXBuffer_VPackCompiled(WXBuffer *buffer, WXPackFormat *format,
+                                va_list ap) {
+    return _packCompiled(buffer, format, (void *) &ap, TRUE);
+}
+
+/**
+ * Unpack a set of values from the buffer according to a compiled format
+ * program, identical in outcome to the Unpack() method for the originating
+ * format string but without the per-call parsing overhead.
+ *
+ * @param buffer The buffer instance to unpack from.
+ * @param format The compiled format program, from CompileFormat().
+ * @param ... The argument set for the unpack, according to the format.
+ * @return Reference to the internal buffer if successfully parsed or
+ *         NULL on a memory allocation failure or packing error.
+ */
+uint8_t *WXBuffer_UnpackCompiled(WXBuffer *buffer, WXPackFormat *format, ...) {
+    uint8_t *content;
+    va_list ap;
+
+    va_start(ap, format);
+    content = _packCompiled(buffer, format, &ap, FALSE);
+    va_end(ap);
+
+    return content;
+}
+
+/**
+ * Identical to the above, but unpack based on an explicit varargs instance.
+ *
+ * @param buffer The buffer instance to unpack from.
+ * @param format The compiled format program, from CompileFormat().
+ * @param ap The allocated vararg instance.  Note that the state of this
+ *           is indeterminant after the call.
+ * @return Reference to the internal buffer if successfully parsed or
+ *         NULL on a memory allocation failure or packing error.
+ */
+uint8_t *WXBuffer_VUnpackCompiled(WXBuffer *buffer, WXPackFormat *format,
+                                  va_list ap) {
+    return _packCompiled(buffer, format, (void *) &ap, FALSE);
+}
+
+/**
  * Read the contents of the provided file descriptor into the buffer
  * (appended to the end of the buffer).
  *
@@ -994,6 +1448,74 @@ ssize_t WXBuffer_ReadFile(WXBuffer *buffer, int fd, size_t length) {
     return count;
 }
 
+/**
+ * Initialize the provided buffer directly against the contents of the given
+ * file, using a memory mapping of the file pages instead of a read into
+ * allocated storage (where supported).  The mapping is private/copy-on-write,
+ * so in-place buffer modifications are safe and do not touch the underlying
+ * file.  Any operation that needs to grow the buffer transparently detaches
+ * the content into standard heap storage (releasing the mapping), consistent
+ * with locally allocated buffers.  WXBuffer_Destroy() releases the mapping.
+ *
+ * @param buffer The buffer instance to initialize from the file contents.
+ * @param path The filesystem path of the file to be mapped.
+ * @return Reference to the internal buffer if the mapping (or fallback read)
+ *         was successful, NULL on a file access or mapping error.
+ */
+uint8_t *WXBuffer_MapFile(WXBuffer *buffer, const char *path) {
+#ifdef WIN32
+    /* No mapping model wired in for Windows, fall back to a full read */
+    int fd = _open(path, _O_RDONLY | _O_BINARY);
+
+    if (fd < 0) return NULL;
+    if (WXBuffer_Init(buffer, 1) == NULL) {
+        (void) _close(fd);
+        return NULL;
+    }
+    if (WXBuffer_ReadFile(buffer, fd, 0) < 0) {
+        (void) _close(fd);
+        WXBuffer_Destroy(buffer);
+        return NULL;
+    }
+    (void) _close(fd);
+
+    return buffer->buffer;
+#else
+    struct stat fileInfo;
+    void *addr;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0) return NULL;
+    if (fstat(fd, &fileInfo) < 0) {
+        (void) close(fd);
+        return NULL;
+    }
+
+    /* Zero-length mappings are invalid, just initialize an empty buffer */
+    if (fileInfo.st_size == 0) {
+        (void) close(fd);
+        return WXBuffer_Init(buffer, 1);
+    }
+
+    /* Private mapping shares the page cache, copy-on-write isolates edits */
+    addr = mmap(NULL, (size_t) fileInfo.st_size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE, fd, 0);
+    (void) close(fd);
+    if (addr == MAP_FAILED) return NULL;
+
+    /* Negative allocation marks borrowed storage, growth copies to heap */
+    buffer->buffer = (uint8_t *) addr;
+    buffer->length = (size_t) fileInfo.st_size;
+    buffer->offset = 0;
+    buffer->allocLength = -((ssize_t) fileInfo.st_size);
+    buffer->arena = NULL;
+    buffer->mapAddr = addr;
+    buffer->mapLength = (size_t) fileInfo.st_size;
+
+    return buffer->buffer;
+#endif
+}
+
 /**
  * Write the contents of the buffer to the provided file descriptor, starting
  * from the current buffer offset (which will be adjusted accordingly).
@@ -1028,6 +1550,87 @@ ssize_t WXBuffer_WriteFile(WXBuffer *buffer, int fd) {
     return count;
 }
 
+/* Bounded stack vector set for the chained write operation */
+#ifndef WIN32
+#include <sys/uio.h>
+#define WXBUFFER_IOV_MAX 16
+#endif
+
+/**
+ * Write the contents of a chain of buffers to the provided file descriptor
+ * in a single vectored (writev) operation where supported, avoiding both
+ * per-buffer system calls and any coalescing copy.  Each buffer writes from
+ * its current offset, which will be adjusted according to the amount written.
+ *
+ * @param buffers Array of buffer instances to write from, in order.
+ * @param count The number of buffer instances in the array.
+ * @param fd The file descriptor to write to.
+ * @return The total number of bytes written to the file, -1 on error
+ *         (partial contents may be written).
+ */
+ssize_t WXBuffer_WriteVFile(WXBuffer **buffers, size_t count, int fd) {
+#ifdef WIN32
+    ssize_t len, total = 0;
+    size_t idx;
+
+    /* No vectored write available, chain the singular write method */
+    for (idx = 0; idx < count; idx++) {
+        len = WXBuffer_WriteFile(buffers[idx], fd);
+        if (len < 0) return -1;
+        total += len;
+    }
+
+    return total;
+#else
+    ssize_t len, total = 0;
+    struct iovec iov[WXBUFFER_IOV_MAX];
+    size_t idx, remain;
+    WXBuffer *buffer;
+    int iovCount;
+
+    /* Outer loop handles both vector overflow and partial writes */
+    for (idx = 0; idx < count; ) {
+        /* Assemble the vector set for the pending buffer contents */
+        iovCount = 0;
+        for (remain = idx; remain < count; remain++) {
+            buffer = buffers[remain];
+            if (buffer->offset >= buffer->length) continue;
+            if (iovCount >= WXBUFFER_IOV_MAX) break;
+            iov[iovCount].iov_base = buffer->buffer + buffer->offset;
+            iov[iovCount].iov_len = buffer->length - buffer->offset;
+            iovCount++;
+        }
+        if (iovCount == 0) break;
+
+        /* Attempt/issue the gathered write */
+        len = writev(fd, iov, iovCount);
+        if (len < 0) {
+            if ((errno == EAGAIN) || (errno == EINTR)) continue;
+            return -1;
+        }
+        total += len;
+
+        /* Distribute the written count across the buffer offsets */
+        while ((idx < count) && (len > 0)) {
+            buffer = buffers[idx];
+            remain = buffer->length - buffer->offset;
+            if (remain > (size_t) len) {
+                buffer->offset += len;
+                len = 0;
+            } else {
+                buffer->offset = buffer->length;
+                len -= remain;
+            }
+            if (buffer->offset >= buffer->length) idx++;
+        }
+        while ((idx < count) &&
+                   (buffers[idx]->offset >= buffers[idx]->length)) idx++;
+    }
+
+    return total;
+#endif
+}
+
 /**
  * Destroy (free) the contents of the provided buffer.  This does not free
  * the buffer structure itself, only the allocated content.  For locally
@@ -1036,10 +1639,21 @@ ssize_t WXBuffer_WriteFile(WXBuffer *buffer, int fd) {
  * @param buffer The buffer instance to destroy.
  */
 void WXBuffer_Destroy(WXBuffer *buffer) {
-    if (buffer->allocLength >= 0) {
+#ifndef WIN32
+    if (buffer->mapAddr != NULL) {
+        (void) munmap(buffer->mapAddr, buffer->mapLength);
+        buffer->mapAddr = NULL;
+        buffer->mapLength = 0;
+        buffer->buffer = NULL;
+    }
+#endif
+    if ((buffer->allocLength >= 0) && (buffer->arena == NULL)) {
         WXFree(buffer->buffer);
     }
     buffer->buffer = NULL;
     buffer->allocLength = 0;
     buffer->offset = buffer->length = 0;
+    buffer->arena = NULL;
+    buffer->mapAddr = NULL;
+    buffer->mapLength = 0;
 }
@@ -41,6 +41,23 @@ typedef struct WXBuffer {
      * (determined by the sign of the allocLength value).
      */
     uint8_t *buffer;
+
+    /**
+     * Arena instance backing the buffer storage, where initialized through
+     * the WXBuffer_InitArena() method (NULL for heap/local storage).  Growth
+     * carves from the arena and release occurs through the arena reset, not
+     * through the buffer instance.
+     */
+    WXArena *arena;
+
+    /**
+     * Memory-mapped backing details, where initialized through the
+     * WXBuffer_MapFile() method (NULL for all other storage forms).  The
+     * mapping releases on destroy or when a growth operation detaches the
+     * content into copied heap storage.
+     */
+    void *mapAddr;
+    size_t mapLength;
 } WXBuffer;
 
 /**
@@ -67,6 +84,40 @@ uint8_t *WXBuffer_Init(WXBuffer *buffer, size_t size);
  */
 void WXBuffer_InitLocal(WXBuffer *buffer, uint8_t *data, size_t size);
 
+/**
+ * Initialize the provided buffer instance against an arena allocator.  All
+ * storage (initial and growth) carves from the arena, release of the content
+ * occurs through the reset/destroy of the arena itself - WXBuffer_Destroy()
+ * is a no-op (but safe) for arena-backed buffers.
+ *
+ * @param buffer The buffer instance to be initialized.
+ * @param arena The arena instance to carve buffer storage from.
+ * @param size The number of bytes to be preallocated into the buffer.  Note
+ *             that a size of zero is allowed but will not allocate storage.
+ * @return Reference to the internal buffer if successfully allocated or
+ *         NULL on a memory allocation failure (if size is non-zero).
+ */
+uint8_t *WXBuffer_InitArena(WXBuffer *buffer, WXArena *arena, size_t size);
+
+/**
+ * Initialize the provided buffer instance as a borrowed view onto a sub-range
+ * of another buffer, sharing the underlying storage with no allocation or
+ * copy.  The view follows the local-storage semantics of WXBuffer_InitLocal()
+ * - any modification requiring growth detaches into fresh storage - but note
+ * that in-place content writes are visible through the source buffer.  The
+ * view is only valid while the source storage remains in place, any
+ * resize/destroy of the source invalidates it.
+ *
+ * @param view The buffer instance to initialize as a view (no allocation).
+ * @param src The buffer whose content is to be referenced.
+ * @param offset Offset into the source content for the start of the view,
+ *               clamped to the source length.
+ * @param length Number of bytes of source content to expose in the view,
+ *               clamped to the available content following the offset.
+ */
+void WXBuffer_Slice(WXBuffer *view, WXBuffer *src, size_t offset,
+                    size_t length);
+
 /**
  * Reset/empty the contents of the provided buffer (convenience function).
  * Resets the length/offset as though it were a newly allocated instance.
@@ -222,6 +273,95 @@ uint8_t *WXBuffer_Unpack(WXBuffer *buffer, const char *format, ...);
  */
 uint8_t *WXBuffer_VUnpack(WXBuffer *buffer, const char *format, va_list ap);
 
+/* Single step (token and resolved repeat count) in a compiled format */
+typedef struct WXPackOp {
+    char token;
+    int32_t repeatCount;
+} WXPackOp;
+
+/* Compiled form of a pack/unpack format, from WXBuffer_CompileFormat */
+typedef struct WXPackFormat {
+    /* The linear program of (endian-resolved) pack/unpack operations */
+    WXPackOp *ops;
+    size_t opCount;
+
+    /* Precomputed total packing size, zero where argument-dependent */
+    size_t sizeBound;
+} WXPackFormat;
+
+/**
+ * Compile a pack/unpack format specification into a reusable operation
+ * program, eliminating the per-call format parsing overhead for record
+ * layouts that are packed repeatedly.  Supports the full format syntax of
+ * the Pack() method except for groups with variable ('%' or '*') repeat
+ * counts, which cannot be unrolled at compile time.
+ *
+ * @param format The format to be compiled, as defined in the Pack() method.
+ * @return The compiled format program or NULL on a memory allocation
+ *         failure or an uncompilable format specification.
+ */
+WXPackFormat *WXBuffer_CompileFormat(const char *format);
+
+/**
+ * Release the contents of a compiled format program created by the
+ * CompileFormat() method.
+ *
+ * @param format The compiled format program to be destroyed/freed.
+ */
+void WXBuffer_DestroyFormat(WXPackFormat *format);
+
+/**
+ * Pack a set of values into the buffer according to a compiled format
+ * program, identical in outcome to the Pack() method for the originating
+ * format string but without the per-call parsing overhead.
+ *
+ * @param buffer The buffer instance to pack into.
+ * @param format The compiled format program, from CompileFormat().
+ * @param ... The argument set for the pack, according to the format.
+ * @return Reference to the internal buffer if successfully (re)allocated or
+ *         NULL on a memory allocation failure.
+ */
+uint8_t *WXBuffer_PackCompiled(WXBuffer *buffer, WXPackFormat *format, ...);
+
+/**
+ * Identical to the above, but pack based on an explicit varargs instance.
+ *
+ * @param buffer The buffer instance to pack into.
+ * @param format The compiled format program, from CompileFormat().
+ * @param ap The allocated vararg instance.  Note that the state of this
+ *           is indeterminant after the call.
+ * @return Reference to the internal buffer if successfully (re)allocated or
+ *         NULL on a memory allocation failure.
+ */
+uint8_t *WXBuffer_VPackCompiled(WXBuffer *buffer, WXPackFormat *format,
+                                va_list ap);
+
+/**
+ * Unpack a set of values from the buffer according to a compiled format
+ * program, identical in outcome to the Unpack() method for the originating
+ * format string but without the per-call parsing overhead.
+ *
+ * @param buffer The buffer instance to unpack from.
+ * @param format The compiled format program, from CompileFormat().
+ * @param ... The argument set for the unpack, according to the format.
+ * @return Reference to the internal buffer if successfully parsed or
+ *         NULL on a memory allocation failure or packing error.
+ */
+uint8_t *WXBuffer_UnpackCompiled(WXBuffer *buffer, WXPackFormat *format, ...);
+
+/**
+ * Identical to the above, but unpack based on an explicit varargs instance.
+ *
+ * @param buffer The buffer instance to unpack from.
+ * @param format The compiled format program, from CompileFormat().
+ * @param ap The allocated vararg instance.  Note that the state of this
+ *           is indeterminant after the call.
+ * @return Reference to the internal buffer if successfully parsed or
+ *         NULL on a memory allocation failure or packing error.
+ */
+uint8_t *WXBuffer_VUnpackCompiled(WXBuffer *buffer, WXPackFormat *format,
+                                  va_list ap);
+
 /**
  * Read the contents of the provided file descriptor into the buffer
  * (appended to the end of the buffer).
@@ -235,6 +375,22 @@ uint8_t *WXBuffer_VUnpack(WXBuffer *buffer, const char *format, va_list ap);
  */
 ssize_t WXBuffer_ReadFile(WXBuffer *buffer, int fd, size_t length);
 
+/**
+ * Initialize the provided buffer directly against the contents of the given
+ * file, using a memory mapping of the file pages instead of a read into
+ * allocated storage (where supported).  The mapping is private/copy-on-write,
+ * so in-place buffer modifications are safe and do not touch the underlying
+ * file.  Any operation that needs to grow the buffer transparently detaches
+ * the content into standard heap storage (releasing the mapping), consistent
+ * with locally allocated buffers.  WXBuffer_Destroy() releases the mapping.
+ *
+ * @param buffer The buffer instance to initialize from the file contents.
+ * @param path The filesystem path of the file to be mapped.
+ * @return Reference to the internal buffer if the mapping (or fallback read)
+ *         was successful, NULL on a file access or mapping error.
+ */
+uint8_t *WXBuffer_MapFile(WXBuffer *buffer, const char *path);
+
 /**
  * Write the contents of the buffer to the provided file descriptor, starting
  * from the current buffer offset (which will be adjusted accordingly).
@@ -246,6 +402,20 @@ ssize_t WXBuffer_ReadFile(WXBuffer *buffer, int fd, size_t length);
  */
 ssize_t WXBuffer_WriteFile(WXBuffer *buffer, int fd);
 
+/**
+ * Write the contents of a chain of buffers to the provided file descriptor
+ * in a single vectored (writev) operation where supported, avoiding both
+ * per-buffer system calls and any coalescing copy.  Each buffer writes from
+ * its current offset, which will be adjusted according to the amount written.
+ *
+ * @param buffers Array of buffer instances to write from, in order.
+ * @param count The number of buffer instances in the array.
+ * @param fd The file descriptor to write to.
+ * @return The total number of bytes written to the file, -1 on error
+ *         (partial contents may be written).
+ */
+ssize_t WXBuffer_WriteVFile(WXBuffer **buffers, size_t count, int fd);
+
 /**
  * Destroy (free) the contents of the provided buffer.  This does not free
  * the buffer structure itself, only the allocated content.  For locally
@@ -0,0 +1,183 @@
+/*
+ * Striped (lock-sharded) concurrent wrapper for the generic hashtable.
+ *
+ * Copyright (C) 1999-2024 J.M. Heisz.  All Rights Reserved.
+ * See the LICENSE file accompanying the distribution your rights to use
+ * this software.
+ */
+#ifndef WX_CONCURRENTHASH_H
+#define WX_CONCURRENTHASH_H 1
+
+/* Built on the threading wrappers and the core hashtable engine */
+#include "thread.h"
+#include "hash.h"
+
+/* Number of lock stripes (power of two), each guarding its own table */
+#define WXCHASH_STRIPE_COUNT 16
+
+/**
+ * Structural definition of a concurrent hashtable.  Entries shard across a
+ * fixed set of independently locked WXHashTable stripes (selected from the
+ * key hashcode), so operations against different stripes proceed in
+ * parallel instead of serializing on a single table mutex.  The method
+ * surface mirrors the core hashtable, key management contracts included.
+ */
+typedef struct WXConcurrentHash {
+    /**
+     * The lock stripes, each an independently guarded hashtable segment.
+     */
+    struct {
+        WXThread_Mutex mutex;
+        WXHashTable table;
+    } stripes[WXCHASH_STRIPE_COUNT];
+} WXConcurrentHash;
+
+/**
+ * Initialize a concurrent hash table instance, dividing the requested
+ * allocation across the internal stripes.
+ *
+ * @param table Reference to an existing instance of the concurrent table to
+ *              be initialized (already existing entries will not be cleaned
+ *              up).
+ * @param startSize The total number of hash blocks to initially allocate
+ *                  across the stripe set.  If negative, the system default
+ *                  start size will be selected.
+ * @return TRUE (non-zero) if initialized, FALSE (zero) if a memory or mutex
+ *         initialization error occurred (instance is cleaned up on failure).
+ */
+int WXCHash_InitTable(WXConcurrentHash *table, int startSize);
+
+/**
+ * Store an object into a concurrent hashtable, locking only the stripe the
+ * key shards to.  Semantics otherwise identical to WXHash_PutEntry,
+ * including the return of a replaced key/object pair for caller cleanup.
+ *
+ * @param table The concurrent table to put the key->value pair into.
+ * @param key The key associated with the entry.
+ * @param object The object to store (must be non-NULL, as per the core
+ *               hashtable contract).
+ * @param lastKey If this reference is non-NULL, the previous key is returned
+ *                if the put entry replaces one in the table.
+ * @param lastObject If this reference is non-NULL, the previous object is
+ *                   returned if the put entry replaces one in the table.
+ * @param keyHashFn A function reference used to generate hashcode values
+ *                  from the table keys.
+ * @param keyEqualsFn A function reference used to compare keys in the
+ *                    table entries.
+ * @return TRUE if the insertion was successful, FALSE if a memory allocation
+ *         failure occurred.
+ */
+int WXCHash_PutEntry(WXConcurrentHash *table, void *key, void *object,
+                     void **lastKey, void **lastObject,
+                     WXKeyHashFn keyHashFn, WXKeyEqualsFn keyEqualsFn);
+
+/**
+ * Store an object into a concurrent hashtable unless an entry with an
+ * "equal" key already exists.  Semantics otherwise identical to
+ * WXHash_InsertEntry, against the stripe the key shards to.
+ *
+ * @param table The concurrent table to insert the key->value pair into.
+ * @param key The key associated with the entry.
+ * @param object The object to store (must be non-NULL, as per the core
+ *               hashtable contract).
+ * @param lastKey If this reference is non-NULL, the existing key is returned
+ *                if the insert did not happen (no replace).
+ * @param lastObject If this reference is non-NULL, the existing object is
+ *                   returned if the insert did not happen (no replace).
+ * @param keyHashFn A function reference used to generate hashcode values
+ *                  from the table keys.
+ * @param keyEqualsFn A function reference used to compare keys in the
+ *                    table entries.
+ * @return TRUE if the insertion was successful, FALSE if a memory allocation
+ *         failure occurred or an entry already existed for the given key.
+ */
+int WXCHash_InsertEntry(WXConcurrentHash *table, void *key, void *object,
+                        void **lastKey, void **lastObject,
+                        WXKeyHashFn keyHashFn, WXKeyEqualsFn keyEqualsFn);
+
+/**
+ * Remove an entry from the concurrent hashtable, locking only the stripe
+ * the key shards to.  Semantics otherwise identical to WXHash_RemoveEntry.
+ *
+ * @param table The concurrent table to remove the entry from.
+ * @param key The key of the pair entry to be removed.
+ * @param origKey If this reference is non-NULL and an entry is removed, the
+ *                original key of the removed entry is returned here.
+ * @param origObject If this reference is non-NULL and an entry is removed,
+ *                   the object associated with the removed entry is returned.
+ * @param keyHashFn A function reference used to generate hashcode values
+ *                  from the table keys.
+ * @param keyEqualsFn A function reference used to compare keys in the
+ *                    table entries.
+ * @return TRUE if an entry was found and removed, FALSE if key is not found.
+ */
+int WXCHash_RemoveEntry(WXConcurrentHash *table, void *key,
+                        void **origKey, void **origObject,
+                        WXKeyHashFn keyHashFn, WXKeyEqualsFn keyEqualsFn);
+
+/**
+ * Retrieve an object from the concurrent hashtable according to the
+ * specified key, locking only the stripe the key shards to.
+ *
+ * @param table The concurrent table to retrieve the entry from.
+ * @param key The key of the object to be obtained.
+ * @param keyHashFn A function reference used to generate hashcode values
+ *                  from the table keys.
+ * @param keyEqualsFn A function reference used to compare keys in the
+ *                    table entries.
+ * @return NULL if no object entry has a matching key, otherwise the matching
+ *         object reference.
+ */
+void *WXCHash_GetEntry(WXConcurrentHash *table, void *key,
+                       WXKeyHashFn keyHashFn, WXKeyEqualsFn keyEqualsFn);
+
+/**
+ * Similar to the GetEntry method, but obtains both the object and the key
+ * associated with the table entry.
+ *
+ * @param table The concurrent table to retrieve the entry from.
+ * @param key The key of the object to be obtained.
+ * @param retKey If non-NULL, the entry key is returned through this
+ *               reference if a matching entry was found.
+ * @param retObject If non-NULL, the entry object is returned through this
+ *                  reference if a matching entry was found.
+ * @param keyHashFn A function reference used to generate hashcode values
+ *                  from the table keys.
+ * @param keyEqualsFn A function reference used to compare keys in the
+ *                    table entries.
+ * @return TRUE if an entry was found (and data returned), FALSE if key is
+ *         not found.
+ */
+int WXCHash_GetFullEntry(WXConcurrentHash *table, void *key,
+                         void **retKey, void **retObject,
+                         WXKeyHashFn keyHashFn, WXKeyEqualsFn keyEqualsFn);
+
+/**
+ * Scan through all entries in the concurrent hashtable, calling the
+ * specified callback function for each valid entry.  Each stripe is locked
+ * in turn for the duration of its scan (not the whole table), so the scan
+ * is consistent per-stripe but not across the full entry set.  Note that
+ * the table reference passed to the callback is the internal stripe
+ * hashtable holding the entry.
+ *
+ * @param table The concurrent table containing the entries to be scanned.
+ * @param entryCB A function reference which is called for each valid entry.
+ * @param userData A caller provided data object which is included in the
+ *                 scan callback arguments.
+ * @return Zero if the scan was completed, any other value indicates the scan
+ *         was interrupted by the callback with the given value.
+ */
+int WXCHash_Scan(WXConcurrentHash *table, WXHashEntryScanCB entryCB,
+                 void *userData);
+
+/**
+ * Destroy the internals of the concurrent hashtable instance.  This does not
+ * free the table structure itself, nor the key/object instances stored
+ * within it.  Not safe against concurrent access, external coordination of
+ * the final release is the caller's responsibility.
+ *
+ * @param table The concurrent table instance to destroy.
+ */
+void WXCHash_Destroy(WXConcurrentHash *table);
+
+#endif
@@ -12,8 +12,10 @@
 #include <string.h>
 #include <errno.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <fcntl.h>
 #include "log.h"
+#include "mem.h"
 
 /* Track the process/pid file details for cleanup */
 static const char *pidTrkFileName = NULL;
@@ -134,6 +136,135 @@ void daemonStart(const char *rootDir, const char *appName,
     /* Note: SIGBUS and SIGSEGV could also be handled, but not generic... */
 }
 
+/* Prefork supervision state (parent/supervisor process only) */
+static pid_t *preforkPids = NULL;
+static int preforkWorkerCount = 0;
+static volatile sig_atomic_t preforkShutdown = FALSE;
+
+/* Supervisor signal handler, relay to the pool (HUP is reload, not exit) */
+static void preforkSignalRelay(int sig) {
+    int idx;
+
+    if (sig != SIGHUP) preforkShutdown = TRUE;
+    for (idx = 0; idx < preforkWorkerCount; idx++) {
+        if (preforkPids[idx] > 0) (void) kill(preforkPids[idx], sig);
+    }
+}
+
+/* Fork a single pool worker, resetting inherited signal dispositions */
+static pid_t preforkSpawn(int workerIndex,
+                          int (*workerProc)(int workerIndex, void *arg),
+                          void *arg) {
+    struct sigaction sigAction;
+    pid_t childpid;
+
+    if ((childpid = fork()) != 0) return childpid;
+
+    /* Forwarded signals terminate by default, workerProc may override */
+    sigAction.sa_handler = SIG_DFL;
+    sigemptyset(&(sigAction.sa_mask));
+    sigAction.sa_flags = 0;
+    (void) sigaction(SIGHUP, &sigAction, NULL);
+    (void) sigaction(SIGINT, &sigAction, NULL);
+    (void) sigaction(SIGTERM, &sigAction, NULL);
+
+    exit((*workerProc)(workerIndex, arg));
+}
+
+/**
+ * Fork and supervise a pool of worker processes for multi-core scaling and
+ * crash isolation.  Listening sockets opened before this call (typically
+ * from WXSocket_OpenTCPServer) are inherited across the fork, so every
+ * worker accepts from the shared listener with no descriptor passing.
+ * Intended to follow daemonStart() in the startup sequence - the daemonized
+ * process becomes the supervisor, restarting workers that exit abnormally
+ * and relaying INT/TERM (shutdown) and HUP (reload) to the pool.  Only
+ * returns in the supervisor, after a shutdown signal has been received and
+ * the pool has drained.
+ *
+ * @param workerCount Number of worker processes to maintain.
+ * @param workerProc Main body for each worker, given the worker index and
+ *                   the opaque argument.  The return value becomes the
+ *                   worker process exit code (non-zero exits are restarted).
+ * @param arg Opaque data reference passed to each worker instance.
+ * @return Zero on supervised shutdown, -1 on a startup/memory error.
+ */
+int daemonPrefork(int workerCount,
+                  int (*workerProc)(int workerIndex, void *arg), void *arg) {
+    struct sigaction sigAction;
+    int idx, status;
+    pid_t childpid;
+
+    preforkPids = (pid_t *) WXCalloc(workerCount * sizeof(pid_t));
+    if (preforkPids == NULL) {
+        WXLog_Error("Unable to allocate prefork tracking: %s.",
+                    strerror(errno));
+        return -1;
+    }
+    preforkWorkerCount = workerCount;
+    preforkShutdown = FALSE;
+
+    /* Supervisor owns the relay handling from this point */
+    sigAction.sa_handler = preforkSignalRelay;
+    sigemptyset(&(sigAction.sa_mask));
+    sigAction.sa_flags = 0;
+    if ((sigaction(SIGHUP, &sigAction, NULL) != 0) ||
+            (sigaction(SIGINT, &sigAction, NULL) != 0) ||
+            (sigaction(SIGTERM, &sigAction, NULL) != 0)) {
+        WXLog_Error("Unable to capture relay signals: %s.", strerror(errno));
+    }
+
+    /* Build out the initial pool */
+    for (idx = 0; idx < workerCount; idx++) {
+        preforkPids[idx] = preforkSpawn(idx, workerProc, arg);
+        if (preforkPids[idx] < 0) {
+            WXLog_Error("Unable to fork pool worker: %s.", strerror(errno));
+        }
+    }
+
+    /* Supervise, restarting workers that fall over */
+    while (!preforkShutdown) {
+        childpid = waitpid(-1, &status, 0);
+        if (childpid < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        for (idx = 0; idx < workerCount; idx++) {
+            if (preforkPids[idx] == childpid) break;
+        }
+        if (idx >= workerCount) continue;
+        preforkPids[idx] = 0;
+        if (preforkShutdown) continue;
+
+        if (WIFSIGNALED(status)) {
+            WXLog_Warn("Pool worker %d killed by signal %d, restarting.",
+                       idx, WTERMSIG(status));
+        } else if (WEXITSTATUS(status) != 0) {
+            WXLog_Warn("Pool worker %d exited with status %d, restarting.",
+                       idx, WEXITSTATUS(status));
+        } else {
+            /* Clean exit is intentional, leave the slot vacant */
+            continue;
+        }
+
+        /* Pause briefly so a worker crashing on startup cannot spin-fork */
+        usleep(100000);
+        preforkPids[idx] = preforkSpawn(idx, workerProc, arg);
+        if (preforkPids[idx] < 0) {
+            WXLog_Error("Unable to restart pool worker: %s.", strerror(errno));
+        }
+    }
+
+    /* Shutdown signalled (and relayed), drain the remainder of the pool */
+    while (waitpid(-1, &status, 0) > 0) {}
+
+    WXFree(preforkPids);
+    preforkPids = NULL;
+    preforkWorkerCount = 0;
+
+    return 0;
+}
+
 /**
  * Matching method for daemon termination, unlock and release the pid file.
  */
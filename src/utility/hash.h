@@ -8,6 +8,8 @@
 #ifndef WX_HASHTBL_H
 #define WX_HASHTBL_H 1
 
+#include "mem.h"
+
 /**
  * Structural definition of a generalized hashtable for keyed information
  * storage.  Supports variant forms for generating hash elements.  Underlying
@@ -26,12 +28,44 @@ typedef struct WXHashTable {
      */
     unsigned int tableMask;
 
+    /**
+     * Collision probe sequence selector (one of the WXHASH_PROBE_* values
+     * below), as determined by the initialization method used.
+     */
+    unsigned int probeStyle;
+
     /**
      * Allocated block of hashtable entries.  Note that this hashtable
      * implementation uses a collision alorithm against a single allocation
      * block.  Size of this block is stored in the entryCount.
      */
     struct WXHashEntry *entries;
+
+    /**
+     * Incremental rehash state (see WXHash_SetIncremental).  When non-NULL,
+     * a prior (smaller) entry block is still being drained into the current
+     * entries block, a bounded number of slots per table operation.  The
+     * old mask and drain position track the migration progress.
+     */
+    struct WXHashEntry *oldEntries;
+    unsigned int oldTableMask, migrateIndex;
+
+    /**
+     * Non-zero if table growth uses the incremental (bounded pause) rehash
+     * instead of the default single-shot rebuild.
+     */
+    unsigned int incremental;
+
+    /**
+     * Dense storage mode (see WXHash_SetDense).  When enabled, entries
+     * additionally reside in a contiguous insertion-ordered array so that
+     * scans sweep packed memory instead of walking the sparse slot block.
+     * The count tracks the filled extent of the array (including removal
+     * debris, which compacts on threshold).
+     */
+    struct WXHashEntry *denseEntries;
+    unsigned int denseCount, denseAllocCount, denseDebris;
+    unsigned int dense;
 } WXHashTable;
 
 /**
@@ -97,6 +131,64 @@ typedef int (*WXHashEntryScanCB)(WXHashTable *table, void *key, void *object,
  */
 int WXHash_InitTable(WXHashTable *table, int startSize);
 
+/* Probe sequence selectors for the open-addressed collision resolution */
+/* Scattered double-hash jumps (original X11-derived implementation) */
+#define WXHASH_PROBE_DOUBLE 0
+/* Sequential probing for cache-friendly lookup on dense/hot tables */
+#define WXHASH_PROBE_LINEAR 1
+
+/**
+ * Identical to WXHash_InitTable, except that the table uses linear probing
+ * for collision resolution instead of the default double-hash jump sequence.
+ * Probes then walk adjacent slots, trading slightly longer collision runs
+ * for cache-friendly memory access - typically a measurable lookup win for
+ * large read-heavy tables.  All other hashtable methods apply unchanged.
+ *
+ * @param table Reference to an existing instance of the hashtable to be
+ *              initialized (already existing entries in the table will not
+ *              be cleaned up).
+ * @param startSize The number of hash blocks to initially allocate in the
+ *                  table.  If negative, the system default start size will be
+ *                  selected.
+ * @return TRUE (non-zero) if initialized, FALSE (zero) if memory error occured.
+ */
+int WXHash_InitTableLinear(WXHashTable *table, int startSize);
+
+/**
+ * Enable (or disable) incremental rehashing for table growth.  By default,
+ * hitting the load threshold rebuilds the entire table in one shot, which
+ * for very large tables is a measurable pause in the middle of the put.
+ * With incremental rehash enabled, growth allocates the larger block but
+ * retains the old one, and each subsequent table operation drains a bounded
+ * number of old slots across, keeping insertion cost O(1) amortized with no
+ * pause spikes.  Lookups and removals transparently cover both blocks while
+ * a drain is in progress.
+ *
+ * @param table The hashtable instance to adjust.
+ * @param enable If TRUE, grow incrementally, if FALSE revert to single-shot
+ *               rebuilds (any drain in progress completes immediately).
+ */
+void WXHash_SetIncremental(WXHashTable *table, int enable);
+
+/**
+ * Enable (or disable) dense entry storage for the table.  By default a scan
+ * walks every slot in the (sparse) open-addressed block, which for large
+ * partially occupied tables touches far more cache lines than the content
+ * warrants.  With dense storage enabled, entries additionally live in a
+ * contiguous insertion-ordered array (slots carrying the array indices),
+ * making Scan a linear sweep of packed memory with stable iteration order.
+ * Removals leave debris in the array which compacts automatically on
+ * threshold.  Costs one extra array maintenance write per table mutation.
+ *
+ * @param table The hashtable instance to adjust.
+ * @param enable If TRUE, maintain the dense entry array (indexing existing
+ *               content immediately, in slot order), if FALSE release it
+ *               and revert scans to the slot walk.
+ * @return TRUE if the storage mode was adjusted, FALSE on a memory
+ *         allocation failure (enable only, table is unchanged).
+ */
+int WXHash_SetDense(WXHashTable *table, int enable);
+
 /**
  * Reset/empty the contents of the hashtable.  Resets the internal data as
  * if it were a newly allocated hashtable.
@@ -205,6 +297,25 @@ int WXHash_RemoveEntry(WXHashTable *table, void *key,
 void *WXHash_GetEntry(WXHashTable *table, void *key,
                       WXKeyHashFn keyHashFn, WXKeyEqualsFn keyEqualsFn);
 
+/**
+ * Identical to the entry retrieval above, except that the caller provides
+ * the (pre-computed) hashcode for the key instead of the hashing function.
+ * For repeated lookups against a fixed key set, this avoids re-hashing the
+ * key content on every access.
+ *
+ * @param table The hashtable to retrieve the entry from.
+ * @param key The key of the object to be obtained.
+ * @param hashCode The hashcode of the key, exactly as the corresponding
+ *                 hashing function would generate it.
+ * @param keyEqualsFn A function reference used to compare keys in the
+ *                    hashtable entries.
+ * @return NULL if no object entry has a matching key, otherwise the matching
+ *         object reference.
+ */
+void *WXHash_GetHashedEntry(WXHashTable *table, void *key,
+                            unsigned int hashCode,
+                            WXKeyEqualsFn keyEqualsFn);
+
 /**
  * Similar to the HashGetEntry method, this retrieves entry information
  * for the provided key, but obtains both the object and the key associated
@@ -270,6 +381,30 @@ int WXHash_Scan(WXHashTable *table, WXHashEntryScanCB entryCB, void *userData);
  */
 void WXHash_Destroy(WXHashTable *table);
 
+/**
+ * Obtain the byte size of the entry storage block for the table, for callers
+ * that relocate the storage into externally managed memory (see below).
+ *
+ * @param table The hashtable to size the entry storage for.
+ * @return The byte size of the current entry storage allocation, zero for
+ *         an unallocated (never filled) table.
+ */
+size_t WXHash_EntryStorageSize(WXHashTable *table);
+
+/**
+ * Relocate the entry storage of the table into the provided externally
+ * managed memory block (sized per the above), releasing the original
+ * allocation.  Entry placement is position-based, so the content transfers
+ * verbatim.  Note that the caller assumes responsibility for the storage
+ * lifecycle - the destroy method (or a put that grows the table) would
+ * attempt to free the provided block.  Any incremental rehash drain must
+ * be complete before relocating.
+ *
+ * @param table The hashtable to relocate the entry storage for.
+ * @param storage The externally managed block to transfer the entries into.
+ */
+void WXHash_RelocateEntryStorage(WXHashTable *table, void *storage);
+
 /* * * * * * * * * * * Convenience Hash Methods * * * * * * * * * * */
 
 /**
@@ -309,6 +444,61 @@ unsigned int WXHash_StrCaseHashFn(void *key);
  */
 int WXHash_StrCaseEqualsFn(void *keya, void *keyb);
 
+/* * * * * * * * * * * String Interning Pool * * * * * * * * * * */
+
+/**
+ * Pool of reference-counted shared string instances.  Repeated acquisitions
+ * of an equal string resolve to the same allocation, so heavily duplicated
+ * content (header names, encodings and the like) is stored exactly once.
+ * Like the hashtable it is built on, a pool instance is not internally
+ * thread-safe.
+ */
+typedef struct WXInternPool {
+    /* Canonical string storage, keyed/matched on content */
+    WXHashTable strings;
+} WXInternPool;
+
+/**
+ * Initialize an interning pool instance with the given number of base entries.
+ *
+ * @param pool Reference to an existing instance of the pool to be initialized.
+ * @param startSize The number of string entries to initially allocate in the
+ *                  pool.  If negative, the system default start size will be
+ *                  selected.
+ * @return TRUE (non-zero) if initialized, FALSE (zero) if memory error occured.
+ */
+int WXIntern_Init(WXInternPool *pool, int startSize);
+
+/**
+ * Obtain the shared instance for the given string, allocating it in the pool
+ * on first acquisition and bumping the reference count otherwise.  Each
+ * successful call must be balanced by a WXIntern_Release of the returned
+ * reference.
+ *
+ * @param pool The pool to resolve the string against.
+ * @param str The string to be interned.
+ * @return The canonical shared copy of the string, or NULL on memory failure.
+ */
+const char *WXIntern_Acquire(WXInternPool *pool, const char *str);
+
+/**
+ * Release a previously acquired string reference, freeing the underlying
+ * allocation when the last reference is released.
+ *
+ * @param pool The pool the string was acquired from.
+ * @param str The interned string instance to be released.
+ */
+void WXIntern_Release(WXInternPool *pool, const char *str);
+
+/**
+ * Destroy the internals of the interning pool instance, releasing all string
+ * allocations regardless of outstanding reference counts.  This does not free
+ * the pool structure itself.
+ *
+ * @param pool The pool instance to destroy.
+ */
+void WXIntern_Destroy(WXInternPool *pool);
+
 /* * * * * * * * * * * Standard Dictionary * * * * * * * * * * */
 
 /**
@@ -321,6 +511,9 @@ typedef struct WXDictionary {
 
     /* With just an indicator as to the case-sensitivity of the keys */
     int isCaseSensitive;
+
+    /* If non-NULL, key/value storage shares through this interning pool */
+    WXInternPool *pool;
 } WXDictionary;
 
 /**
@@ -339,6 +532,27 @@ typedef struct WXDictionary {
  */
 int WXDict_Init(WXDictionary *dict, int startSize, int isCaseSensitive);
 
+/**
+ * Initialize a dictionary instance whose key/value storage is shared through
+ * the provided interning pool instead of per-entry duplication.  Repeated
+ * strings across dictionaries on the same pool resolve to single shared
+ * allocations.  The pool must outlive the dictionary.
+ *
+ * @param dict Reference to an existing instance of the dictionary to be
+ *             initialized (already existing entries in the table will not
+ *             be cleaned up).
+ * @param startSize The number of key entries to initially allocate in the
+ *                  dictionary.  If negative, the system default start size
+ *                  will be selected.
+ * @param isCaseSensitive If TRUE, keys will be matched according to case, if
+ *                        FALSE, key matches are case-insensitive (but are *not*
+ *                        lower-cased).
+ * @param pool The interning pool backing the dictionary string content.
+ * @return TRUE (non-zero) if initialized, FALSE (zero) if memory error occured.
+ */
+int WXDict_InitInterned(WXDictionary *dict, int startSize, int isCaseSensitive,
+                        WXInternPool *pool);
+
 /**
  * Reset/empty the contents of the dictionary.  Resets the internal data as
  * if it were a newly allocated dictionary.  All keys and values will be freed.
@@ -31,6 +31,80 @@ static const char *shortLogLevelNames[] = {
 
 static FILE *logFileHandles[5];
 
+/* Pending asynchronous record, fully formatted line and its target */
+typedef struct WXLogRecord {
+    FILE *fp;
+    char *line;
+} WXLogRecord;
+
+/* Asynchronous mode state, a cond-guarded ring drained by the flusher */
+#define WXLOG_DFLT_RING_SIZE 1024
+#define WXLOG_FLUSH_BATCH 32
+static struct {
+    WXLogRecord *ring;
+    size_t ringSize, start, count;
+    WXThread_Mutex mutex;
+    WXThread_Cond dataCond, spaceCond;
+    WXThread flusher;
+    int active, shutdown;
+} asyncLog;
+
+/* Flusher thread, batch records out of the ring and write outside the lock */
+static void *logFlusher(void *arg) {
+    WXLogRecord batch[WXLOG_FLUSH_BATCH];
+    size_t idx, cnt;
+
+    (void) WXThread_MutexLock(&(asyncLog.mutex));
+    while (TRUE) {
+        while ((asyncLog.count == 0) && (!asyncLog.shutdown)) {
+            (void) WXThread_CondWait(&(asyncLog.dataCond), &(asyncLog.mutex));
+        }
+        if ((asyncLog.count == 0) && (asyncLog.shutdown)) break;
+
+        /* Lift a batch out of the ring, then write with the lock released */
+        cnt = (asyncLog.count < WXLOG_FLUSH_BATCH) ? asyncLog.count :
+                                                     WXLOG_FLUSH_BATCH;
+        for (idx = 0; idx < cnt; idx++) {
+            batch[idx] = asyncLog.ring[asyncLog.start];
+            asyncLog.start = (asyncLog.start + 1) % asyncLog.ringSize;
+        }
+        asyncLog.count -= cnt;
+        (void) WXThread_CondBroadcast(&(asyncLog.spaceCond));
+        (void) WXThread_MutexUnlock(&(asyncLog.mutex));
+
+        for (idx = 0; idx < cnt; idx++) {
+            (void) fputs(batch[idx].line, batch[idx].fp);
+            WXFree(batch[idx].line);
+        }
+        for (idx = 0; idx < cnt; idx++) {
+            /* Flush each distinct target once, after the batch content */
+            if ((idx != 0) && (batch[idx].fp == batch[idx - 1].fp)) continue;
+            (void) fflush(batch[idx].fp);
+        }
+
+        (void) WXThread_MutexLock(&(asyncLog.mutex));
+    }
+    (void) WXThread_MutexUnlock(&(asyncLog.mutex));
+
+    return NULL;
+}
+
+/* Enqueue a formatted line for the flusher, blocking if the ring is full */
+static void logAsyncEnqueue(FILE *fp, char *line) {
+    size_t slot;
+
+    (void) WXThread_MutexLock(&(asyncLog.mutex));
+    while (asyncLog.count >= asyncLog.ringSize) {
+        (void) WXThread_CondWait(&(asyncLog.spaceCond), &(asyncLog.mutex));
+    }
+    slot = (asyncLog.start + asyncLog.count) % asyncLog.ringSize;
+    asyncLog.ring[slot].fp = fp;
+    asyncLog.ring[slot].line = line;
+    asyncLog.count++;
+    (void) WXThread_CondSignal(&(asyncLog.dataCond));
+    (void) WXThread_MutexUnlock(&(asyncLog.mutex));
+}
+
 /**
  * Initialize the logging framework for the core application.
  *
@@ -66,7 +140,302 @@ void WXLog_Init(const char *appName, const char *logFileName) {
 }
 
 /**
- * Convenience method to obtain the basename 
+ * Initialize the logging framework in asynchronous mode.  Logging calls
+ * append formatted records to an internal ring and return immediately, a
+ * dedicated flusher thread batches the records to the output targets so
+ * that slow or contended log targets do not stall the logging threads.
+ *
+ * @param appName The short name of the application, for syslog support.
+ * @param logFileName If non-NULL, direct logging to this file, otherwise
+ *                    standard console is used (non-daemon mode).
+ * @param ringSize Number of pending records the ring can hold before
+ *                 logging calls block awaiting the flusher.  If zero, a
+ *                 suitable default is chosen.
+ */
+void WXLog_InitAsync(const char *appName, const char *logFileName,
+                     size_t ringSize) {
+    /* Targets resolve exactly as for synchronous operation */
+    WXLog_Init(appName, logFileName);
+
+    /* Assemble the ring and flusher, any failure stays synchronous */
+    asyncLog.ringSize = (ringSize != 0) ? ringSize : WXLOG_DFLT_RING_SIZE;
+    asyncLog.ring = (WXLogRecord *) WXMalloc(asyncLog.ringSize *
+                                                 sizeof(WXLogRecord));
+    if (asyncLog.ring == NULL) return;
+    asyncLog.start = asyncLog.count = 0;
+    asyncLog.shutdown = FALSE;
+    if ((WXThread_MutexInit(&(asyncLog.mutex), FALSE) != WXTRC_OK) ||
+            (WXThread_CondInit(&(asyncLog.dataCond)) != WXTRC_OK) ||
+            (WXThread_CondInit(&(asyncLog.spaceCond)) != WXTRC_OK) ||
+            (WXThread_Create(&(asyncLog.flusher), logFlusher,
+                             NULL) != WXTRC_OK)) {
+        WXFree(asyncLog.ring);
+        asyncLog.ring = NULL;
+        return;
+    }
+    asyncLog.active = TRUE;
+}
+
+/**
+ * Block until all currently enqueued asynchronous records have been written
+ * by the flusher.  A no-op when not in asynchronous mode.
+ */
+void WXLog_Flush(void) {
+    if (!asyncLog.active) return;
+    (void) WXThread_MutexLock(&(asyncLog.mutex));
+    while (asyncLog.count != 0) {
+        (void) WXThread_CondWait(&(asyncLog.spaceCond), &(asyncLog.mutex));
+    }
+    (void) WXThread_MutexUnlock(&(asyncLog.mutex));
+}
+
+/**
+ * Flush all pending records, stop the asynchronous flusher thread and return
+ * the logging framework to synchronous operation.  A no-op when not in
+ * asynchronous mode.
+ */
+void WXLog_Shutdown(void) {
+    if (!asyncLog.active) return;
+
+    /* Flag termination, the flusher drains the remainder before exiting */
+    (void) WXThread_MutexLock(&(asyncLog.mutex));
+    asyncLog.shutdown = TRUE;
+    (void) WXThread_CondSignal(&(asyncLog.dataCond));
+    (void) WXThread_MutexUnlock(&(asyncLog.mutex));
+    (void) WXThread_Join(asyncLog.flusher, NULL);
+
+    /* Immediately revert to synchronous before releasing the internals */
+    asyncLog.active = FALSE;
+    (void) WXThread_MutexDestroy(&(asyncLog.mutex));
+    (void) WXThread_CondDestroy(&(asyncLog.dataCond));
+    (void) WXThread_CondDestroy(&(asyncLog.spaceCond));
+    WXFree(asyncLog.ring);
+    asyncLog.ring = NULL;
+}
+
+/* Captured binary payloads truncate to this per-record slice */
+#define WXLOG_TRACE_BIN_SLICE 128
+
+/* Captured trace point, raw references and argument words only */
+typedef struct WXLogTraceRecord {
+    const char *fileName;
+    int lineNum;
+    const char *format;
+    WXThread_TimeSpec when;
+    long args[4];
+    uint32_t binLength;
+} WXLogTraceRecord;
+
+/* Per-thread capture ring, chained into a global registry for dumping */
+typedef struct WXLogTraceRing {
+    WXLogTraceRecord *records;
+    uint8_t *binStore;
+    size_t size, nextSlot, count;
+    struct WXLogTraceRing *next;
+} WXLogTraceRing;
+
+/* Registry/capture state, mutex only guards ring bookkeeping and dumps */
+static WXThread_Mutex traceMutex = WXTHREAD_MUTEX_STATIC_INIT;
+static WXThread_OnceCtl traceOnceCtl = WXTHREAD_ONCE_STATIC_INIT;
+static WXThread_TlsKey traceKey;
+static WXLogTraceRing *traceRings = NULL;
+static size_t traceRecordCount = 0;
+
+/* Exiting threads unhook and release their capture ring */
+static void traceRingDestructor(void *arg) {
+    WXLogTraceRing **follow, *ring = (WXLogTraceRing *) arg;
+
+    (void) WXThread_MutexLock(&traceMutex);
+    for (follow = &traceRings; *follow != NULL; follow = &((*follow)->next)) {
+        if (*follow == ring) {
+            *follow = ring->next;
+            break;
+        }
+    }
+    (void) WXThread_MutexUnlock(&traceMutex);
+
+    if (ring->binStore != NULL) WXFree(ring->binStore);
+    WXFree(ring->records);
+    WXFree(ring);
+}
+
+static void traceKeyInit() {
+    (void) WXThread_TlsCreate(&traceKey, traceRingDestructor);
+}
+
+/**
+ * Enable (or resize) the deferred trace capture facility.  Trace-fast
+ * records are captured into compact per-thread rings as the raw format
+ * reference and argument words only - no formatting or I/O occurs on the
+ * recording thread, so trace points can remain enabled in hot paths.
+ * Rendering is deferred to WXLog_TraceDump.
+ *
+ * @param recordCount The number of records each per-thread ring retains
+ *                    (oldest records are overwritten).  Zero disables
+ *                    capture, recording calls become no-ops.
+ */
+void WXLog_EnableTrace(size_t recordCount) {
+    (void) WXThread_Once(&traceOnceCtl, traceKeyInit);
+    traceRecordCount = recordCount;
+}
+
+/**
+ * Record a deferred trace point.  Only the format reference and argument
+ * values are captured, rendering happens at dump time - the format must
+ * therefore only use word-sized conversions (%ld, %lx, %p and the like)
+ * and any string arguments must outlive the dump.  Fixed arity, pad unused
+ * arguments with zero.
+ *
+ * @param format Printf-based formatting for the eventual log message, using
+ *               word-sized conversions only.
+ * @param arg1 First word-sized argument for the format.
+ * @param arg2 Second word-sized argument for the format.
+ * @param arg3 Third word-sized argument for the format.
+ * @param arg4 Fourth word-sized argument for the format.
+ */
+/* First capture on a thread assembles and registers its ring */
+static WXLogTraceRing *traceRingGet() {
+    WXLogTraceRing *ring;
+
+    if ((ring = (WXLogTraceRing *) WXThread_TlsGet(traceKey)) == NULL) {
+        ring = (WXLogTraceRing *) WXMalloc(sizeof(WXLogTraceRing));
+        if (ring == NULL) return NULL;
+        ring->records = (WXLogTraceRecord *)
+                    WXMalloc(traceRecordCount * sizeof(WXLogTraceRecord));
+        if (ring->records == NULL) {
+            WXFree(ring);
+            return NULL;
+        }
+        ring->binStore = NULL;
+        ring->size = traceRecordCount;
+        ring->nextSlot = ring->count = 0;
+        (void) WXThread_TlsSet(traceKey, ring);
+
+        (void) WXThread_MutexLock(&traceMutex);
+        ring->next = traceRings;
+        traceRings = ring;
+        (void) WXThread_MutexUnlock(&traceMutex);
+    }
+
+    return ring;
+}
+
+void _WXLog_TraceFast(const char *fileName, const int lineNum,
+                      const char *format, long arg1, long arg2,
+                      long arg3, long arg4) {
+    WXLogTraceRecord *record;
+    WXLogTraceRing *ring;
+
+    if (traceRecordCount == 0) return;
+    if ((ring = traceRingGet()) == NULL) return;
+
+    /* Raw capture only, rendering cost is deferred to the dump */
+    record = ring->records + ring->nextSlot;
+    record->fileName = fileName;
+    record->lineNum = lineNum;
+    record->format = format;
+    WXThread_GetEpochTime(&(record->when));
+    record->args[0] = arg1; record->args[1] = arg2;
+    record->args[2] = arg3; record->args[3] = arg4;
+    record->binLength = 0;
+    ring->nextSlot = (ring->nextSlot + 1) % ring->size;
+    if (ring->count < ring->size) ring->count++;
+}
+
+/**
+ * Record a deferred binary capture point.  A leading slice of the content
+ * (up to an internal limit) is copied raw into the per-thread ring with no
+ * hex rendering or I/O on the recording thread - formatting happens at dump
+ * time, so wire-level payload sampling can remain enabled in hot paths.
+ *
+ * @param label Fixed description for the captured payload (static string,
+ *              must outlive the dump).
+ * @param content Pointer to the memory content/blob to be captured.
+ * @param offset Zero-offset index of the first byte to capture.
+ * @param length Number of bytes in the content region (captures truncate
+ *               to the internal slice limit, the full length is logged).
+ */
+void _WXLog_TraceBinary(const char *fileName, const int lineNum,
+                        const char *label, uint8_t *content,
+                        uint32_t offset, uint32_t length) {
+    WXLogTraceRecord *record;
+    WXLogTraceRing *ring;
+
+    if (traceRecordCount == 0) return;
+    if ((ring = traceRingGet()) == NULL) return;
+
+    /* Payload slices allocate on the first binary capture for the thread */
+    if (ring->binStore == NULL) {
+        ring->binStore = (uint8_t *)
+                    WXMalloc(ring->size * WXLOG_TRACE_BIN_SLICE);
+        if (ring->binStore == NULL) return;
+    }
+
+    /* Raw copy only, hex rendering cost is deferred to the dump */
+    record = ring->records + ring->nextSlot;
+    record->fileName = fileName;
+    record->lineNum = lineNum;
+    record->format = label;
+    WXThread_GetEpochTime(&(record->when));
+    record->args[0] = (long) length;
+    record->args[1] = record->args[2] = record->args[3] = 0;
+    record->binLength = (length < WXLOG_TRACE_BIN_SLICE) ?
+                                       length : WXLOG_TRACE_BIN_SLICE;
+    (void) memcpy(ring->binStore + ring->nextSlot * WXLOG_TRACE_BIN_SLICE,
+                  content + offset, record->binLength);
+    ring->nextSlot = (ring->nextSlot + 1) % ring->size;
+    if (ring->count < ring->size) ring->count++;
+}
+
+/**
+ * Render all captured trace records (all threads, oldest first per thread)
+ * through the standard logging output at the indicated level, emptying the
+ * rings.  This is the expensive half of the deferred pairing, intended for
+ * fault handling or periodic offline-style collection.
+ *
+ * @param level The enumerated level to log the rendered records at.
+ */
+void WXLog_TraceDump(WXLogLevel level) {
+    WXLogTraceRecord *record;
+    char message[MESSAGE_SIZE];
+    WXLogTraceRing *ring;
+    size_t idx, slot;
+
+    (void) WXThread_MutexLock(&traceMutex);
+    for (ring = traceRings; ring != NULL; ring = ring->next) {
+        slot = (ring->nextSlot + ring->size - ring->count) % ring->size;
+        for (idx = 0; idx < ring->count; idx++) {
+            record = ring->records + slot;
+            if (record->binLength != 0) {
+                /* Binary capture, label line then the rendered hex dump */
+                _WXLog_Print(record->fileName, record->lineNum, level,
+                             "[trace %ld.%06ld] %s (%ld bytes, %u captured)",
+                             (long) record->when.tv_sec,
+                             (long) (record->when.tv_nsec / 1000L),
+                             record->format, record->args[0],
+                             record->binLength);
+                _WXLog_Binary(record->fileName, record->lineNum, level,
+                              ring->binStore + slot * WXLOG_TRACE_BIN_SLICE,
+                              0, record->binLength);
+                slot = (slot + 1) % ring->size;
+                continue;
+            }
+            (void) snprintf(message, sizeof(message), record->format,
+                            record->args[0], record->args[1],
+                            record->args[2], record->args[3]);
+            _WXLog_Print(record->fileName, record->lineNum, level,
+                         "[trace %ld.%06ld] %s",
+                         (long) record->when.tv_sec,
+                         (long) (record->when.tv_nsec / 1000L), message);
+            slot = (slot + 1) % ring->size;
+        }
+        ring->nextSlot = ring->count = 0;
+    }
+    (void) WXThread_MutexUnlock(&traceMutex);
+}
+
+/**
+ * Convenience method to obtain the basename
  * Unfortunately, GCC's __FILE__ macro includes full path information and there
  * is no other macro for the basename.
  */
@@ -132,7 +501,7 @@ void WXLog_GetFormattedTimestamp(char *timestamp) {
  */
 void _WXLog_VPrint(const char *fileName, const int lineNum, WXLogLevel level,
                    const char *format, va_list src) {
-    char *msgPtr, message[MESSAGE_SIZE], timestamp[128];
+    char *msgPtr, *line, message[MESSAGE_SIZE], timestamp[128];
     size_t allocLen = 0;
     FILE *logFp;
     va_list ap;
@@ -173,6 +542,27 @@ void _WXLog_VPrint(const char *fileName, const int lineNum, WXLogLevel level,
         }
     }
 
+    /* In asynchronous mode, hand the assembled line to the flusher */
+    if (asyncLog.active) {
+        line = (char *) WXMalloc(strlen(timestamp) + strlen(fileName) +
+                                     strlen(msgPtr) + 32);
+        if (line != NULL) {
+            if (lineNum >= 0) {
+                (void) sprintf(line, "%s %c [%s:%d] %s\n",
+                               timestamp, *(shortLogLevelNames[level]),
+                               logFileBaseName(fileName), lineNum, msgPtr);
+            } else {
+                (void) sprintf(line, "%s %c [%s] %s\n",
+                               timestamp, *(shortLogLevelNames[level]),
+                               fileName, msgPtr);
+            }
+            logAsyncEnqueue(logFp, line);
+            if (msgPtr != message) WXFree(msgPtr);
+            return;
+        }
+        /* Record allocation failure falls through to synchronous output */
+    }
+
     /* Out it goes! */
     if (lineNum >= 0) {
         (void) fprintf(logFp, "%s %c [%s:%d] %s\n",
@@ -228,8 +618,10 @@ void WXLog_Logger(WXLogLevel level, const char *context,
  */
 void _WXLog_Binary(const char *fileName, const int lineNum, WXLogLevel level,
                    uint8_t *content, uint32_t offset, uint32_t length) {
-    char charBuffer[20], hexStr[4], *message, *str;
-    int len, column = 0, hexVal;
+    static const char hexDigits[] = "0123456789abcdef";
+    uint32_t lineLen, idx;
+    char *message, *str;
+    uint8_t byte;
 
     /* Assemble the binary dump */
     message = (char *) WXMalloc(50 + 71 * (length / 16 + 1));
@@ -242,49 +634,31 @@ void _WXLog_Binary(const char *fileName, const int lineNum, WXLogLevel level,
     sprintf(message, "Binary content: %d bytes", length);
     str = message + strlen(message);
 
-    memset(charBuffer, 0, sizeof(charBuffer));
-    for (content = content + offset; length > 0; length--, content++) {
-        /* If this is the start of a new 16-byte set */
-        if (column == 0) {
+    /* Table-driven rendering, whole lines at a time (no format calls) */
+    for (content += offset; length > 0;
+                            length -= lineLen, content += lineLen) {
+        lineLen = (length < 16) ? length : 16;
+        (void) memcpy(str, "\n    ", 5);
+        str += 5;
+
+        /* Hex columns, space-filled to full width on the final line */
+        for (idx = 0; idx < lineLen; idx++) {
+            byte = content[idx];
+            *(str++) = hexDigits[byte >> 4];
+            *(str++) = hexDigits[byte & 0x0F];
             *(str++) = ' ';
-            len = strlen(charBuffer);
-            (void) memcpy(str, charBuffer, len);
-            str += len;
-            (void) strcpy(str, "\n    ");
-            str += 5;
         }
-
-        /* Dump the current byte */
-        hexVal = ((int) *content) & 0xFF;
-        (void) sprintf(hexStr, "%02x ", hexVal);
-        len = strlen(hexStr);
-        (void) memcpy(str, hexStr, len);
-        str += len;
-
-        if ((hexVal > 31) && (hexVal < 128)) {
-            charBuffer[column] = (char) hexVal;
-        } else {
-            charBuffer[column] = '.';
+        for (; idx < 16; idx++) {
+            *(str++) = ' '; *(str++) = ' '; *(str++) = ' ';
         }
+        *(str++) = ' ';
 
-        /* Check if this is the end of the 16-bytes set */
-        if (column < 15) {
-            column++;
-        } else {
-            column = 0;
+        /* Matching printable character display */
+        for (idx = 0; idx < lineLen; idx++) {
+            byte = content[idx];
+            *(str++) = ((byte > 31) && (byte < 128)) ? (char) byte : '.';
         }
     }
-
-    /* Assemble the last line - buffer as needed */
-    if (column == 0) column = 16;
-    charBuffer[column] = '\0';
-    while (column++ < 16) {
-        *(str++) = ' '; *(str++) = ' '; *(str++) = ' ';
-    }
-    *(str++) = ' ';
-    len = strlen(charBuffer);
-    (void) memcpy(str, charBuffer, len);
-    str += len;
     *str = '\0';
 
     _WXLog_Print(fileName, lineNum, level, "%s", message);
@@ -25,6 +25,35 @@ typedef enum {
  */
 void WXLog_Init(const char *appName, const char *logFileName);
 
+/**
+ * Initialize the logging framework in asynchronous mode.  Logging calls
+ * append formatted records to an internal ring and return immediately, a
+ * dedicated flusher thread batches the records to the output targets so
+ * that slow or contended log targets do not stall the logging threads.
+ *
+ * @param appName The short name of the application, for syslog support.
+ * @param logFileName If non-NULL, direct logging to this file, otherwise
+ *                    standard console is used (non-daemon mode).
+ * @param ringSize Number of pending records the ring can hold before
+ *                 logging calls block awaiting the flusher.  If zero, a
+ *                 suitable default is chosen.
+ */
+void WXLog_InitAsync(const char *appName, const char *logFileName,
+                     size_t ringSize);
+
+/**
+ * Block until all currently enqueued asynchronous records have been written
+ * by the flusher.  A no-op when not in asynchronous mode.
+ */
+void WXLog_Flush(void);
+
+/**
+ * Flush all pending records, stop the asynchronous flusher thread and return
+ * the logging framework to synchronous operation.  A no-op when not in
+ * asynchronous mode.
+ */
+void WXLog_Shutdown(void);
+
 /**
  * Logging utility method to get a consistent timestamp for applications
  * using this logging framework.
@@ -66,6 +95,72 @@ void _WXLog_Print(const char *fileName, const int lineNum, WXLogLevel level,
 #define WXLog_Trace(...) \
         _WXLog_Print(__FILE__, __LINE__, WXLOG_TRACE, ## __VA_ARGS__)
 
+/**
+ * Enable (or resize) the deferred trace capture facility.  Trace-fast
+ * records are captured into compact per-thread rings as the raw format
+ * reference and argument words only - no formatting or I/O occurs on the
+ * recording thread, so trace points can remain enabled in hot paths.
+ * Rendering is deferred to WXLog_TraceDump.
+ *
+ * @param recordCount The number of records each per-thread ring retains
+ *                    (oldest records are overwritten).  Zero disables
+ *                    capture, recording calls become no-ops.
+ */
+void WXLog_EnableTrace(size_t recordCount);
+
+/**
+ * Record a deferred trace point.  Only the format reference and argument
+ * values are captured, rendering happens at dump time - the format must
+ * therefore only use word-sized conversions (%ld, %lx, %p and the like)
+ * and any string arguments must outlive the dump.  Fixed arity, pad unused
+ * arguments with zero.
+ *
+ * @param format Printf-based formatting for the eventual log message, using
+ *               word-sized conversions only.
+ * @param arg1 First word-sized argument for the format.
+ * @param arg2 Second word-sized argument for the format.
+ * @param arg3 Third word-sized argument for the format.
+ * @param arg4 Fourth word-sized argument for the format.
+ */
+void _WXLog_TraceFast(const char *fileName, const int lineNum,
+                      const char *format, long arg1, long arg2,
+                      long arg3, long arg4);
+
+#define WXLog_TraceFast(format, arg1, arg2, arg3, arg4) \
+        _WXLog_TraceFast(__FILE__, __LINE__, format, (long) (arg1), \
+                         (long) (arg2), (long) (arg3), (long) (arg4))
+
+/**
+ * Record a deferred binary capture point.  A leading slice of the content
+ * (up to an internal limit) is copied raw into the per-thread ring with no
+ * hex rendering or I/O on the recording thread - formatting happens at dump
+ * time, so wire-level payload sampling can remain enabled in hot paths.
+ *
+ * @param label Fixed description for the captured payload (static string,
+ *              must outlive the dump).
+ * @param content Pointer to the memory content/blob to be captured.
+ * @param offset Zero-offset index of the first byte to capture.
+ * @param length Number of bytes in the content region (captures truncate
+ *               to the internal slice limit, the full length is logged).
+ */
+void _WXLog_TraceBinary(const char *fileName, const int lineNum,
+                        const char *label, uint8_t *content,
+                        uint32_t offset, uint32_t length);
+
+#define WXLog_TraceBinary(label, content, offset, length) \
+        _WXLog_TraceBinary(__FILE__, __LINE__, label, content, \
+                           offset, length)
+
+/**
+ * Render all captured trace records (all threads, oldest first per thread)
+ * through the standard logging output at the indicated level, emptying the
+ * rings.  This is the expensive half of the deferred pairing, intended for
+ * fault handling or periodic offline-style collection.
+ *
+ * @param level The enumerated level to log the rendered records at.
+ */
+void WXLog_TraceDump(WXLogLevel level);
+
 /**
  * Convenience/utility method to log a blob of binary data, in useful/formatted
  * form.
@@ -55,3 +55,230 @@ void *_WXRealloc(void *original, size_t size, int line, char *file) {
 void _WXFree(void *original, int line, char *file) {
     free(original);
 }
+
+/* Leading structure for the chained arena blocks, content carves after */
+typedef struct WXArenaBlock {
+    struct WXArenaBlock *next;
+} WXArenaBlock;
+
+/* All arena carvings align to this boundary (good enough for doubles) */
+#define WXARENA_ALIGN 8
+#define WXArenaRound(sz) (((sz) + (WXARENA_ALIGN - 1)) & ~(WXARENA_ALIGN - 1))
+
+/**
+ * Initialize an arena allocator instance, including the initial underlying
+ * allocation block (which is retained across resets of the arena).
+ *
+ * @param arena The arena instance to be initialized.
+ * @param blockSize The standard size of the underlying allocation blocks,
+ *                  which should be comfortably larger than the typical
+ *                  allocations being made against the arena.
+ * @return TRUE if the arena (initial block) was allocated, FALSE on a
+ *         memory allocation failure.
+ */
+int WXArena_Init(WXArena *arena, size_t blockSize) {
+    WXArenaBlock *block;
+
+    blockSize = WXArenaRound(blockSize);
+    block = (WXArenaBlock *) WXMalloc(sizeof(WXArenaBlock) + blockSize);
+    if (block == NULL) return FALSE;
+    block->next = NULL;
+
+    arena->blockSize = blockSize;
+    arena->blocks = block;
+    arena->avail = ((uint8_t *) block) + sizeof(WXArenaBlock);
+    arena->remain = blockSize;
+
+    return TRUE;
+}
+
+/**
+ * Allocate a segment of memory from the arena.  There is no corresponding
+ * free method, the memory is released en masse by the reset/destroy of the
+ * arena itself.
+ *
+ * @param arena The arena instance to allocate from.
+ * @param size The number of bytes to be allocated.
+ * @return Reference to the allocated block of memory or NULL if an
+ *         underlying heap allocation fails.
+ */
+void *WXArena_Alloc(WXArena *arena, size_t size) {
+    WXArenaBlock *block, *curr;
+    uint8_t *ptr;
+
+    size = WXArenaRound(size);
+    if (size <= arena->remain) {
+        /* Straight carve from the current block */
+        ptr = arena->avail;
+        arena->avail += size;
+        arena->remain -= size;
+        return ptr;
+    }
+
+    if (size > arena->blockSize) {
+        /* Oversized, dedicated block without disturbing the current carve */
+        block = (WXArenaBlock *) WXMalloc(sizeof(WXArenaBlock) + size);
+        if (block == NULL) return NULL;
+        curr = (WXArenaBlock *) arena->blocks;
+        block->next = curr->next;
+        curr->next = block;
+        return ((uint8_t *) block) + sizeof(WXArenaBlock);
+    }
+
+    /* Otherwise, chain a fresh standard block and carve from it */
+    block = (WXArenaBlock *) WXMalloc(sizeof(WXArenaBlock) + arena->blockSize);
+    if (block == NULL) return NULL;
+    block->next = (WXArenaBlock *) arena->blocks;
+    arena->blocks = block;
+    ptr = ((uint8_t *) block) + sizeof(WXArenaBlock);
+    arena->avail = ptr + size;
+    arena->remain = arena->blockSize - size;
+    return ptr;
+}
+
+/**
+ * Release all allocations made against the arena in a single operation.
+ * The initial underlying block is retained for reuse, any overflow blocks
+ * are returned to the heap.
+ *
+ * @param arena The arena instance to be reset.
+ */
+void WXArena_Reset(WXArena *arena) {
+    WXArenaBlock *next, *block = (WXArenaBlock *) arena->blocks;
+
+    /* Initial block is the chain tail, release everything in front of it */
+    while (block->next != NULL) {
+        next = block->next;
+        WXFree(block);
+        block = next;
+    }
+
+    arena->blocks = block;
+    arena->avail = ((uint8_t *) block) + sizeof(WXArenaBlock);
+    arena->remain = arena->blockSize;
+}
+
+/**
+ * Destroy the arena instance, releasing all underlying allocation blocks.
+ * This does not free the arena structure itself, which may be reinitialized.
+ *
+ * @param arena The arena instance to destroy.
+ */
+void WXArena_Destroy(WXArena *arena) {
+    WXArenaBlock *next, *block = (WXArenaBlock *) arena->blocks;
+
+    while (block != NULL) {
+        next = block->next;
+        WXFree(block);
+        block = next;
+    }
+    arena->blocks = NULL;
+    arena->avail = NULL;
+    arena->remain = arena->blockSize = 0;
+}
+
+/* Leading structure for the chained pool slabs, slots carve after */
+typedef struct WXMemPoolSlab {
+    struct WXMemPoolSlab *next;
+} WXMemPoolSlab;
+
+/* Free slots chain through their own (released) storage */
+typedef struct WXMemPoolSlot {
+    struct WXMemPoolSlot *next;
+} WXMemPoolSlot;
+
+/* Default number of slots per slab when the caller has no opinion */
+#define WXMEMPOOL_DFLT_SLAB_COUNT 64
+
+/**
+ * Initialize a fixed-size object pool instance.  No slabs are allocated
+ * until the first allocation request.
+ *
+ * @param pool The pool instance to be initialized.
+ * @param objSize The (fixed) byte size of the objects to be allocated.
+ * @param slabCount The number of objects to carve from each underlying slab
+ *                  allocation.  If zero, a suitable default is chosen.
+ */
+void WXMemPool_Init(WXMemPool *pool, size_t objSize, size_t slabCount) {
+    /* Slot must align and be able to carry the free list linkage */
+    objSize = WXArenaRound(objSize);
+    if (objSize < sizeof(WXMemPoolSlot)) objSize = sizeof(WXMemPoolSlot);
+
+    pool->objSize = objSize;
+    pool->slabCount = (slabCount != 0) ? slabCount : WXMEMPOOL_DFLT_SLAB_COUNT;
+    pool->slabs = NULL;
+    pool->freeList = NULL;
+}
+
+/**
+ * Allocate an object instance from the pool, either recycled from a prior
+ * release or carved from a (possibly new) underlying slab.
+ *
+ * @param pool The pool instance to allocate from.
+ * @return Reference to the allocated object or NULL if a slab allocation
+ *         failed.
+ */
+void *WXMemPool_Alloc(WXMemPool *pool) {
+    WXMemPoolSlot *slot, *last;
+    WXMemPoolSlab *slab;
+    uint8_t *ptr;
+    size_t idx;
+
+    /* Fast path, recycle from the free list */
+    if ((slot = (WXMemPoolSlot *) pool->freeList) != NULL) {
+        pool->freeList = slot->next;
+        return slot;
+    }
+
+    /* Otherwise carve a fresh slab, threading the remainder onto the list */
+    slab = (WXMemPoolSlab *) WXMalloc(sizeof(WXMemPoolSlab) +
+                                          pool->slabCount * pool->objSize);
+    if (slab == NULL) return NULL;
+    slab->next = (WXMemPoolSlab *) pool->slabs;
+    pool->slabs = slab;
+
+    ptr = ((uint8_t *) slab) + sizeof(WXMemPoolSlab);
+    last = NULL;
+    for (idx = 1; idx < pool->slabCount; idx++) {
+        slot = (WXMemPoolSlot *) (ptr + idx * pool->objSize);
+        slot->next = last;
+        last = slot;
+    }
+    pool->freeList = last;
+
+    return ptr;
+}
+
+/**
+ * Release an object instance back to the pool for recycling.  The underlying
+ * slab memory is only returned to the heap by the destroy of the pool.
+ *
+ * @param pool The pool instance the object was allocated from.
+ * @param obj The object instance to be released.
+ */
+void WXMemPool_Release(WXMemPool *pool, void *obj) {
+    WXMemPoolSlot *slot = (WXMemPoolSlot *) obj;
+
+    slot->next = (WXMemPoolSlot *) pool->freeList;
+    pool->freeList = slot;
+}
+
+/**
+ * Destroy the pool instance, releasing all underlying slab allocations
+ * (outstanding object references are invalidated).  This does not free the
+ * pool structure itself, which may be reinitialized.
+ *
+ * @param pool The pool instance to destroy.
+ */
+void WXMemPool_Destroy(WXMemPool *pool) {
+    WXMemPoolSlab *next, *slab = (WXMemPoolSlab *) pool->slabs;
+
+    while (slab != NULL) {
+        next = slab->next;
+        WXFree(slab);
+        slab = next;
+    }
+    pool->slabs = NULL;
+    pool->freeList = NULL;
+    pool->objSize = pool->slabCount = 0;
+}
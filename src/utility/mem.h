@@ -56,4 +56,151 @@ void *_WXRealloc(void *original, size_t size, int line, char *file);
 #define WXFree(original) _WXFree(original, __LINE__, __FILE__)
 void _WXFree(void *original, int line, char *file);
 
+/**
+ * Structural definition of an arena (region) allocator.  Allocations carve
+ * sequentially from larger underlying blocks, there is no per-allocation
+ * release - the entire allocation set is discarded with a single reset of
+ * the arena instance.  Intended for clusters of short-lived allocations
+ * (e.g. the buffers of a single request/response cycle) where the churn of
+ * individual heap allocation is measurable overhead.
+ */
+typedef struct WXArena {
+    /**
+     * The standard size of the underlying allocation blocks, as provided
+     * to the initialization method.  Oversized allocations are given
+     * dedicated blocks without disturbing the current carving block.
+     */
+    size_t blockSize;
+
+    /**
+     * Opaque reference to the chain of underlying allocated blocks,
+     * newest first.  The original (initialization) block is the tail of
+     * this chain and is retained across arena resets.
+     */
+    void *blocks;
+
+    /**
+     * Carving reference for the next allocation in the current block.
+     */
+    uint8_t *avail;
+
+    /**
+     * Number of bytes remaining in the current carving block.
+     */
+    size_t remain;
+} WXArena;
+
+/**
+ * Initialize an arena allocator instance, including the initial underlying
+ * allocation block (which is retained across resets of the arena).
+ *
+ * @param arena The arena instance to be initialized.
+ * @param blockSize The standard size of the underlying allocation blocks,
+ *                  which should be comfortably larger than the typical
+ *                  allocations being made against the arena.
+ * @return TRUE if the arena (initial block) was allocated, FALSE on a
+ *         memory allocation failure.
+ */
+int WXArena_Init(WXArena *arena, size_t blockSize);
+
+/**
+ * Allocate a segment of memory from the arena.  There is no corresponding
+ * free method, the memory is released en masse by the reset/destroy of the
+ * arena itself.
+ *
+ * @param arena The arena instance to allocate from.
+ * @param size The number of bytes to be allocated.
+ * @return Reference to the allocated block of memory or NULL if an
+ *         underlying heap allocation fails.
+ */
+void *WXArena_Alloc(WXArena *arena, size_t size);
+
+/**
+ * Release all allocations made against the arena in a single operation.
+ * The initial underlying block is retained for reuse, any overflow blocks
+ * are returned to the heap.
+ *
+ * @param arena The arena instance to be reset.
+ */
+void WXArena_Reset(WXArena *arena);
+
+/**
+ * Destroy the arena instance, releasing all underlying allocation blocks.
+ * This does not free the arena structure itself, which may be reinitialized.
+ *
+ * @param arena The arena instance to destroy.
+ */
+void WXArena_Destroy(WXArena *arena);
+
+/**
+ * Structural definition of a fixed-size object (slab) allocator.  Objects of
+ * a single size are carved from larger slab allocations and recycled through
+ * an internal free list, avoiding per-object heap metadata and churn for
+ * high-volume identically-sized structures.  Like the other allocators in
+ * this module, an instance is not internally thread-safe - callers sharing
+ * a pool across threads must provide their own synchronization (typically
+ * the lock already guarding the owning structure).
+ */
+typedef struct WXMemPool {
+    /**
+     * The size of each object slot, rounded up from the initialization
+     * object size for alignment and free-list linkage.
+     */
+    size_t objSize;
+
+    /**
+     * The number of object slots carved from each underlying slab.
+     */
+    size_t slabCount;
+
+    /**
+     * Opaque reference to the chain of underlying slab allocations.
+     */
+    void *slabs;
+
+    /**
+     * Chain of released/unused object slots available for allocation.
+     */
+    void *freeList;
+} WXMemPool;
+
+/**
+ * Initialize a fixed-size object pool instance.  No slabs are allocated
+ * until the first allocation request.
+ *
+ * @param pool The pool instance to be initialized.
+ * @param objSize The (fixed) byte size of the objects to be allocated.
+ * @param slabCount The number of objects to carve from each underlying slab
+ *                  allocation.  If zero, a suitable default is chosen.
+ */
+void WXMemPool_Init(WXMemPool *pool, size_t objSize, size_t slabCount);
+
+/**
+ * Allocate an object instance from the pool, either recycled from a prior
+ * release or carved from a (possibly new) underlying slab.
+ *
+ * @param pool The pool instance to allocate from.
+ * @return Reference to the allocated object or NULL if a slab allocation
+ *         failed.
+ */
+void *WXMemPool_Alloc(WXMemPool *pool);
+
+/**
+ * Release an object instance back to the pool for recycling.  The underlying
+ * slab memory is only returned to the heap by the destroy of the pool.
+ *
+ * @param pool The pool instance the object was allocated from.
+ * @param obj The object instance to be released.
+ */
+void WXMemPool_Release(WXMemPool *pool, void *obj);
+
+/**
+ * Destroy the pool instance, releasing all underlying slab allocations
+ * (outstanding object references are invalidated).  This does not free the
+ * pool structure itself, which may be reinitialized.
+ *
+ * @param pool The pool instance to destroy.
+ */
+void WXMemPool_Destroy(WXMemPool *pool);
+
 #endif
@@ -0,0 +1,32 @@
+/*
+ * Always-on runtime statistics counters for the toolkit subsystems.
+ *
+ * Copyright (C) 2026 J.M. Heisz.  All Rights Reserved.
+ * See the LICENSE file accompanying the distribution your rights to use
+ * this software.
+ */
+#include "stats.h"
+#include <string.h>
+
+/* The one and only global counter block (zeroed at load) */
+WXStats _wxStats;
+
+/**
+ * Capture a point-in-time copy of the global counter block, suitable for
+ * rate computation by differencing against a previous snapshot.
+ *
+ * @param snapshot Reference to the statistics block to copy into.
+ */
+void WXStats_Snapshot(WXStats *snapshot) {
+    /* Aligned 64-bit reads are atomic on supported platforms and the */
+    /* counters are monotonic, so a straight copy is a coherent sample */
+    (void) memcpy(snapshot, &_wxStats, sizeof(WXStats));
+}
+
+/**
+ * Reset all of the global counters to zero.  Intended for test/benchmark
+ * isolation, production monitors should difference snapshots instead.
+ */
+void WXStats_Reset(void) {
+    (void) memset(&_wxStats, 0, sizeof(WXStats));
+}
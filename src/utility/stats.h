@@ -0,0 +1,61 @@
+/*
+ * Always-on runtime statistics counters for the toolkit subsystems.
+ *
+ * Copyright (C) 2026 J.M. Heisz.  All Rights Reserved.
+ * See the LICENSE file accompanying the distribution your rights to use
+ * this software.
+ */
+#ifndef WX_STATS_H
+#define WX_STATS_H 1
+
+/* Grab the standard definitions */
+#include "stdconfig.h"
+
+/*
+ * Aggregated process-wide counter block.  All counters are monotonic and
+ * updated with relaxed atomic increments from the instrumented hot paths,
+ * so point-in-time rates/levels are derived by differencing snapshots
+ * (for example, current threadpool queue depth is enqueues less
+ * completions).
+ */
+typedef struct {
+    /* Hashtable activity (across all table instances) */
+    uint64_t hashPuts, hashGets, hashProbeSteps, hashResizes;
+
+    /* Threadpool work distribution */
+    uint64_t poolEnqueues, poolCompletions, poolWorkersStarted;
+
+    /* Event registry processing */
+    uint64_t eventWaits, eventsDispatched;
+
+    /* Socket stream buffering */
+    uint64_t streamFlushes, streamShortWrites;
+
+    /* Database connection pooling */
+    uint64_t dbConnObtains, dbConnCreates, dbConnPings, dbConnEvictions;
+} WXStats;
+
+/* The global counter block, access through the macros/methods below */
+extern WXStats _wxStats;
+
+/* Relaxed atomic increment/accumulate for the instrumentation points */
+#define WXSTATS_INCR(fld) \
+    ((void) __sync_fetch_and_add(&(_wxStats.fld), 1))
+#define WXSTATS_ADD(fld, amt) \
+    ((void) __sync_fetch_and_add(&(_wxStats.fld), (uint64_t) (amt)))
+
+/**
+ * Capture a point-in-time copy of the global counter block, suitable for
+ * rate computation by differencing against a previous snapshot.
+ *
+ * @param snapshot Reference to the statistics block to copy into.
+ */
+void WXStats_Snapshot(WXStats *snapshot);
+
+/**
+ * Reset all of the global counters to zero.  Intended for test/benchmark
+ * isolation, production monitors should difference snapshots instead.
+ */
+void WXStats_Reset(void);
+
+#endif
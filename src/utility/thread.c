@@ -130,6 +130,65 @@ void WXThread_USleep(uint64_t us) {
 #endif
 }
 
+
+/**
+ * Utility method to obtain a high-resolution monotonic timestamp, for
+ * measuring elapsed intervals.  Unlike the epoch time, this value has no
+ * relation to wall-clock time (arbitrary origin) and never steps backwards
+ * due to clock adjustment.  On most platforms this is a very cheap call
+ * (vDSO or equivalent, no system call transition).
+ *
+ * @return The monotonic timestamp, in nanoseconds from an arbitrary origin.
+ */
+uint64_t WXThread_MonotonicTime() {
+#ifndef _WXWIN_BUILD
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec) * 1000000000ULL + (uint64_t) ts.tv_nsec;
+#else
+    struct timeval tv;
+
+    /* Last resort, wall-clock derived (subject to stepping) */
+    (void) gettimeofday(&tv, NULL);
+    return ((uint64_t) tv.tv_sec) * 1000000000ULL +
+                                       ((uint64_t) tv.tv_usec) * 1000ULL;
+#endif
+#else
+    LARGE_INTEGER freq, count;
+
+    (void) QueryPerformanceFrequency(&freq);
+    (void) QueryPerformanceCounter(&count);
+
+    /* Split the conversion to avoid overflowing the intermediate product */
+    return ((uint64_t) (count.QuadPart / freq.QuadPart)) * 1000000000ULL +
+           (((uint64_t) (count.QuadPart % freq.QuadPart)) * 1000000000ULL) /
+                                                  (uint64_t) freq.QuadPart;
+#endif
+}
+
+/**
+ * Start (or restart) the provided stopwatch instance, marking the monotonic
+ * origin for subsequent elapsed interval measurement.
+ *
+ * @param watch Reference to the stopwatch instance to be started.
+ */
+void WXThread_StopWatchStart(WXThread_StopWatch *watch) {
+    watch->_markTime = WXThread_MonotonicTime();
+}
+
+/**
+ * Obtain the interval elapsed since the stopwatch was started.  Does not
+ * reset the stopwatch, repeated calls measure from the same origin.
+ *
+ * @param watch Reference to the stopwatch instance to be measured.
+ * @return The elapsed interval, in nanoseconds.
+ */
+uint64_t WXThread_StopWatchElapsed(WXThread_StopWatch *watch) {
+    return WXThread_MonotonicTime() - watch->_markTime;
+}
+
 #ifdef _WXWIN_BUILD
 /* Common method to release all resources associated to a thread */
 static void threadCleanup(WXThread thr) {
@@ -414,6 +473,49 @@ int WXThread_MutexInit(WXThread_Mutex *mutex, int isRecursive) {
 #endif
 }
 
+/**
+ * Initialize an adaptive (spin-then-park) mutex instance.  For very short
+ * critical sections, contending threads busy-wait briefly before parking in
+ * the kernel, avoiding the sleep/wake round trip when the holder is about to
+ * release.  Where the underlying platform has no adaptive support this
+ * behaves identically to a 'normal' (non-recursive) mutex, so it is always
+ * safe to use.  Destroy/lock/unlock through the standard mutex methods.
+ *
+ * @param mutex Reference to the mutex instance to be initialized.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_MutexInitAdaptive(WXThread_Mutex *mutex) {
+#ifndef _WXWIN_BUILD
+#ifdef PTHREAD_MUTEX_ADAPTIVE_NP
+    pthread_mutexattr_t attr;
+    int rc;
+
+    rc = pthread_mutexattr_init(&attr);
+    if (rc != 0) return mapThreadErrorCode(rc);
+    if (pthread_mutexattr_settype(&attr,
+            PTHREAD_MUTEX_ADAPTIVE_NP) != 0) return WXTRC_SYS_ERROR;
+    rc = pthread_mutex_init(mutex, &attr);
+    (void) pthread_mutexattr_destroy(&attr);
+    return mapThreadErrorCode(rc);
+#else
+    /* No adaptive support on this platform, plain mutex it is */
+    return WXThread_MutexInit(mutex, FALSE);
+#endif
+#else
+    WXThread_Mutex mtx =
+          (WXThread_Mutex) WXMalloc(sizeof(struct WXThread_Mutex));
+    if (mtx == NULL) return mapThreadErrorCode(errno = ENOMEM);
+
+    mtx->_owner = (WXThread) NULL;
+    mtx->_recurse = -999;
+    /* Critical sections take the spin count directly (value per MSDN) */
+    (void) InitializeCriticalSectionAndSpinCount(&(mtx->_cs), 4000);
+    *mutex = mtx;
+
+    return WXTRC_OK;
+#endif
+}
+
 
 /**
  * Counterpart to the init function, release the resources associated to the
@@ -569,6 +671,135 @@ int WXThread_MutexUnlock(WXThread_Mutex *mutex) {
 #endif
 }
 
+/**
+ * Initialize a reader/writer lock instance, presuming it had not been
+ * initialized statically.  Read-mostly structures can take the shared lock
+ * in multiple threads at once, serializing only against exclusive writers.
+ * Note that these locks are not recursive and a thread may hold the lock in
+ * only one mode at a time.
+ *
+ * @param lock Reference to the reader/writer lock instance to be initialized.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockInit(WXThread_RwLock *lock) {
+#ifndef _WXWIN_BUILD
+    return mapThreadErrorCode(pthread_rwlock_init(lock, NULL));
+#else
+    InitializeSRWLock(&(lock->_lock));
+    lock->_owner = (WXThread) NULL;
+    return WXTRC_OK;
+#endif
+}
+
+/**
+ * Counterpart to the init function, release the resources associated to the
+ * provided reader/writer lock instance.  Note that this does *not* release
+ * the underlying lock structure instance.
+ *
+ * @param lock Reference to the reader/writer lock instance to be released.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockDestroy(WXThread_RwLock *lock) {
+#ifndef _WXWIN_BUILD
+    return mapThreadErrorCode(pthread_rwlock_destroy(lock));
+#else
+    /* No corresponding destructor for slim reader/writer locks */
+    return WXTRC_OK;
+#endif
+}
+
+/**
+ * Take the provided lock in shared (read) mode, blocking while a writer
+ * holds or is draining readers for exclusive access (per platform policy).
+ *
+ * @param lock Reference to the reader/writer lock instance to be read-locked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockReadLock(WXThread_RwLock *lock) {
+#ifndef _WXWIN_BUILD
+    return mapThreadErrorCode(pthread_rwlock_rdlock(lock));
+#else
+    AcquireSRWLockShared(&(lock->_lock));
+    return WXTRC_OK;
+#endif
+}
+
+/**
+ * Attempt to take the provided lock in shared (read) mode.  Acts similar to
+ * the ReadLock() method, except if exclusive access is held (or pending) the
+ * method returns immediately with WXTRC_BUSY.
+ *
+ * @param lock Reference to the reader/writer lock instance to be read-locked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockTryReadLock(WXThread_RwLock *lock) {
+#ifndef _WXWIN_BUILD
+    return mapThreadErrorCode(pthread_rwlock_tryrdlock(lock));
+#else
+    return (TryAcquireSRWLockShared(&(lock->_lock)) != 0) ? WXTRC_OK :
+                                                            WXTRC_BUSY;
+#endif
+}
+
+/**
+ * Take the provided lock in exclusive (write) mode, blocking until all
+ * shared and exclusive holders have released.
+ *
+ * @param lock Reference to the reader/writer lock instance to be write-locked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockWriteLock(WXThread_RwLock *lock) {
+#ifndef _WXWIN_BUILD
+    return mapThreadErrorCode(pthread_rwlock_wrlock(lock));
+#else
+    if (threadInstanceKey == 0) threadsInit();
+    AcquireSRWLockExclusive(&(lock->_lock));
+    lock->_owner = WXThread_Self();
+    return WXTRC_OK;
+#endif
+}
+
+/**
+ * Attempt to take the provided lock in exclusive (write) mode.  Acts similar
+ * to the WriteLock() method, except if the lock is held in either mode the
+ * method returns immediately with WXTRC_BUSY.
+ *
+ * @param lock Reference to the reader/writer lock instance to be write-locked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockTryWriteLock(WXThread_RwLock *lock) {
+#ifndef _WXWIN_BUILD
+    return mapThreadErrorCode(pthread_rwlock_trywrlock(lock));
+#else
+    if (threadInstanceKey == 0) threadsInit();
+    if (TryAcquireSRWLockExclusive(&(lock->_lock)) == 0) return WXTRC_BUSY;
+    lock->_owner = WXThread_Self();
+    return WXTRC_OK;
+#endif
+}
+
+/**
+ * Release the provided lock from whichever mode the calling thread holds
+ * it in (shared or exclusive).
+ *
+ * @param lock Reference to the reader/writer lock instance to be unlocked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockUnlock(WXThread_RwLock *lock) {
+#ifndef _WXWIN_BUILD
+    return mapThreadErrorCode(pthread_rwlock_unlock(lock));
+#else
+    /* The slim locks split release by mode, use the owner to differentiate */
+    if (lock->_owner == WXThread_Self()) {
+        lock->_owner = (WXThread) NULL;
+        ReleaseSRWLockExclusive(&(lock->_lock));
+    } else {
+        ReleaseSRWLockShared(&(lock->_lock));
+    }
+    return WXTRC_OK;
+#endif
+}
+
 /**
  * Initialize a condition variable, presuming it has not been initialized
  * statically.  Note that all condition variables are process private.
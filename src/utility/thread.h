@@ -44,6 +44,9 @@ typedef pthread_mutex_t WXThread_Mutex;
 typedef pthread_cond_t WXThread_Cond;
 #define WXTHREAD_COND_STATIC_INIT PTHREAD_COND_INITIALIZER
 
+typedef pthread_rwlock_t WXThread_RwLock;
+#define WXTHREAD_RWLOCK_STATIC_INIT PTHREAD_RWLOCK_INITIALIZER
+
 typedef pthread_key_t WXThread_TlsKey;
 
 #else
@@ -98,6 +101,14 @@ typedef struct WXThread_Mutex {
 typedef CONDITION_VARIABLE WXThread_Cond;
 #define WXTHREAD_COND_STATIC_INIT CONDITION_VARIABLE_INIT
 
+/* Slim reader/writer locks arrive in Vista, wrapped to track write owner */
+typedef struct WXThread_RwLock {
+    SRWLOCK _lock;
+    WXThread _owner;
+} WXThread_RwLock;
+
+#define WXTHREAD_RWLOCK_STATIC_INIT { SRWLOCK_INIT, NULL }
+
 typedef struct WXThread_TlsKey {
     DWORD _key;
     void (*_destrFn)(void *);
@@ -125,6 +136,39 @@ void WXThread_GetEpochTime(WXThread_TimeSpec *tmspec);
  */
 void WXThread_USleep(uint64_t us);
 
+/**
+ * Utility method to obtain a high-resolution monotonic timestamp, for
+ * measuring elapsed intervals.  Unlike the epoch time, this value has no
+ * relation to wall-clock time (arbitrary origin) and never steps backwards
+ * due to clock adjustment.  On most platforms this is a very cheap call
+ * (vDSO or equivalent, no system call transition).
+ *
+ * @return The monotonic timestamp, in nanoseconds from an arbitrary origin.
+ */
+uint64_t WXThread_MonotonicTime();
+
+/* Lightweight interval stopwatch, driven from the monotonic clock */
+typedef struct WXThread_StopWatch {
+    uint64_t _markTime;
+} WXThread_StopWatch;
+
+/**
+ * Start (or restart) the provided stopwatch instance, marking the monotonic
+ * origin for subsequent elapsed interval measurement.
+ *
+ * @param watch Reference to the stopwatch instance to be started.
+ */
+void WXThread_StopWatchStart(WXThread_StopWatch *watch);
+
+/**
+ * Obtain the interval elapsed since the stopwatch was started.  Does not
+ * reset the stopwatch, repeated calls measure from the same origin.
+ *
+ * @param watch Reference to the stopwatch instance to be measured.
+ * @return The elapsed interval, in nanoseconds.
+ */
+uint64_t WXThread_StopWatchElapsed(WXThread_StopWatch *watch);
+
 /**
  * Create/allocate a thread data instance and start an associated system
  * thread of execution.
@@ -203,6 +247,19 @@ int WXThread_Once(WXThread_OnceCtl *onceCtl, void (*init)(void));
  */
 int WXThread_MutexInit(WXThread_Mutex *mutex, int isRecursive);
 
+/**
+ * Initialize an adaptive (spin-then-park) mutex instance.  For very short
+ * critical sections, contending threads busy-wait briefly before parking in
+ * the kernel, avoiding the sleep/wake round trip when the holder is about to
+ * release.  Where the underlying platform has no adaptive support this
+ * behaves identically to a 'normal' (non-recursive) mutex, so it is always
+ * safe to use.  Destroy/lock/unlock through the standard mutex methods.
+ *
+ * @param mutex Reference to the mutex instance to be initialized.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_MutexInitAdaptive(WXThread_Mutex *mutex);
+
 /**
  * Counterpart to the init function, release the resources associated to the
  * provided mutex instance.  Note that this does *not* release the underlying
@@ -243,6 +300,75 @@ int WXThread_MutexTryLock(WXThread_Mutex *mutex);
  */
 int WXThread_MutexUnlock(WXThread_Mutex *mutex);
 
+/**
+ * Initialize a reader/writer lock instance, presuming it had not been
+ * initialized statically.  Read-mostly structures can take the shared lock
+ * in multiple threads at once, serializing only against exclusive writers.
+ * Note that these locks are not recursive and a thread may hold the lock in
+ * only one mode at a time.
+ *
+ * @param lock Reference to the reader/writer lock instance to be initialized.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockInit(WXThread_RwLock *lock);
+
+/**
+ * Counterpart to the init function, release the resources associated to the
+ * provided reader/writer lock instance.  Note that this does *not* release
+ * the underlying lock structure instance.
+ *
+ * @param lock Reference to the reader/writer lock instance to be released.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockDestroy(WXThread_RwLock *lock);
+
+/**
+ * Take the provided lock in shared (read) mode, blocking while a writer
+ * holds or is draining readers for exclusive access (per platform policy).
+ *
+ * @param lock Reference to the reader/writer lock instance to be read-locked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockReadLock(WXThread_RwLock *lock);
+
+/**
+ * Attempt to take the provided lock in shared (read) mode.  Acts similar to
+ * the ReadLock() method, except if exclusive access is held (or pending) the
+ * method returns immediately with WXTRC_BUSY.
+ *
+ * @param lock Reference to the reader/writer lock instance to be read-locked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockTryReadLock(WXThread_RwLock *lock);
+
+/**
+ * Take the provided lock in exclusive (write) mode, blocking until all
+ * shared and exclusive holders have released.
+ *
+ * @param lock Reference to the reader/writer lock instance to be write-locked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockWriteLock(WXThread_RwLock *lock);
+
+/**
+ * Attempt to take the provided lock in exclusive (write) mode.  Acts similar
+ * to the WriteLock() method, except if the lock is held in either mode the
+ * method returns immediately with WXTRC_BUSY.
+ *
+ * @param lock Reference to the reader/writer lock instance to be write-locked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockTryWriteLock(WXThread_RwLock *lock);
+
+/**
+ * Release the provided lock from whichever mode the calling thread holds
+ * it in (shared or exclusive).
+ *
+ * @param lock Reference to the reader/writer lock instance to be unlocked.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThread_RwLockUnlock(WXThread_RwLock *lock);
+
 /**
  * Initialize a condition variable, presuming it has not been initialized
  * statically.  Note that all condition variables are process private.
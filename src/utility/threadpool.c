@@ -14,6 +14,7 @@
  */
 #include "threadpool.h"
 #include "mem.h"
+#include "stats.h"
 
 /* Need this definitions now */
 struct WXThreadPoolQueueItem {
@@ -24,67 +25,143 @@ struct WXThreadPoolQueueItem {
     /* Tracking count for waiters on outcome */
     int hasWaiters;
 
-    /* For slicing efficiency, list points in both directions */
+    /* For slicing efficiency, tracking list points in both directions */
     WXThreadPoolQueueItem *prev, *next;
+
+    /* Forward chain for the per-worker pending queues */
+    WXThreadPoolQueueItem *pendingNext;
+};
+
+/* Per-worker dispatch slot, each with an independently guarded queue so
+ * that the pop/steal hot path never touches the pool-wide mutex */
+struct WXThreadPoolWorker {
+    /* Owning pool (worker thread startup argument is the slot) */
+    WXThreadPool *pool;
+
+    /* The associated worker thread, when the slot is active */
+    WXThread thrd;
+
+    /* Guards the pending queue and flags for this slot only */
+    WXThread_Mutex mutex;
+    WXThread_Cond cond;
+
+    /* Local chains of pending work for this worker, by priority lane */
+    WXThreadPoolQueueItem *priorityHead, *priorityTail;
+    WXThreadPoolQueueItem *pendingHead, *pendingTail;
+
+    /* Slot has a running worker thread/is awaiting local work */
+    int active, idle;
 };
 
-/* Special elements for pool termination */
-static void *termFn(void *arg) { abort(); }
-static WXThreadPoolQueueItem terminator = { termFn, NULL };
+/* Pull the next pending item from the worker's own queues, NULL if empty */
+static WXThreadPoolQueueItem *popLocalItem(WXThreadPoolWorker *slot) {
+    WXThreadPoolQueueItem *item;
+
+    (void) WXThread_MutexLock(&(slot->mutex));
+    if ((item = slot->priorityHead) != NULL) {
+        slot->priorityHead = item->pendingNext;
+        if (slot->priorityHead == NULL) slot->priorityTail = NULL;
+    } else if ((item = slot->pendingHead) != NULL) {
+        slot->pendingHead = item->pendingNext;
+        if (slot->pendingHead == NULL) slot->pendingTail = NULL;
+    }
+    (void) WXThread_MutexUnlock(&(slot->mutex));
+
+    return item;
+}
+
+/* Local queue ran dry, sweep the other workers for pending work to steal */
+static WXThreadPoolQueueItem *stealItem(WXThreadPool *pool,
+                                        WXThreadPoolWorker *slot) {
+    WXThreadPoolQueueItem *item;
+    WXThreadPoolWorker *victim;
+    size_t idx;
+
+    for (idx = 0; idx < pool->workerSlots; idx++) {
+        victim = pool->workers + idx;
+        if (victim == slot) continue;
 
-/* Primary thread method for a running worker */
+        /* Unguarded screening read, only lock plausible victims */
+        if ((victim->priorityHead == NULL) &&
+                (victim->pendingHead == NULL)) continue;
+        if ((item = popLocalItem(victim)) != NULL) return item;
+    }
+
+    return NULL;
+}
+
+/* Primary thread method for a running worker, argument is the slot */
 static void *worker(void *arg) {
-    WXThreadPool *pool = (WXThreadPool *) arg;
+    WXThreadPoolWorker *slot = (WXThreadPoolWorker *) arg;
+    WXThreadPool *pool = slot->pool;
     WXThreadPoolQueueItem *item;
     WXThread_TimeSpec ts;
     int running = TRUE;
 
-    /* Pay close attention to use of locks in loop, held on boundaries... */
-    (void) WXThread_MutexLock(&(pool->mutex));
-
-    /* Work forever until something signals otherwise */
     while (running) {
-        /* Wait/idle until there is work in the queue */
+        /* Local work first, then try to steal from the other workers */
+        if ((item = popLocalItem(slot)) == NULL) {
+            item = stealItem(pool, slot);
+        }
+
+        if (item != NULL) {
+            /* Execute outside of any lock boundaries */
+            (void) (item->execFn)(item->arg);
+            WXSTATS_INCR(poolCompletions);
+
+            /* Slice from the tracking list and signal appropriately */
+            (void) WXThread_MutexLock(&(pool->mutex));
+            if (pool->queue == item) pool->queue = item->next;
+            if (pool->lastQueue == item) pool->lastQueue = item->prev;
+            if (item->next != NULL) item->next->prev = item->prev;
+            if (item->prev != NULL) item->prev->next = item->next;
+            if (item->hasWaiters) WXThread_CondBroadcast(&(pool->waitCond));
+            WXMemPool_Release(&(pool->itemPool), item);
+            (void) WXThread_MutexUnlock(&(pool->mutex));
+            continue;
+        }
+
+        /* Nothing anywhere, exit on termination or idle awaiting dispatch */
+        if (pool->terminating) break;
+
+        (void) WXThread_MutexLock(&(pool->mutex));
         pool->idleCount++;
-        while (pool->nextQueue == NULL) {
+        (void) WXThread_MutexUnlock(&(pool->mutex));
+
+        (void) WXThread_MutexLock(&(slot->mutex));
+        slot->idle = TRUE;
+        while ((slot->priorityHead == NULL) && (slot->pendingHead == NULL) &&
+                   (!pool->terminating)) {
             /* Zzzzzzz.... */
             if (pool->workerCount <= pool->minWorkers) {
-                (void) WXThread_CondWait(&(pool->workCond), &(pool->mutex));
+                (void) WXThread_CondWait(&(slot->cond), &(slot->mutex));
             } else {
                 WXThread_GetEpochTime(&ts);
                 ts.tv_sec += pool->lingerIntvl;
-                if ((WXThread_CondTimedWait(&(pool->workCond), &(pool->mutex),
+                if ((WXThread_CondTimedWait(&(slot->cond), &(slot->mutex),
                                             &ts) == WXTRC_TIMEOUT) &&
                         (pool->workerCount > pool->minWorkers)) {
-                        running = FALSE;
+                    running = FALSE;
                     break;
                 }
             }
         }
-        pool->idleCount--;
-
-        /* Exit if idle timeout occurred or termination signalled */
-        if ((!running) || (pool->nextQueue == &terminator)) break;
+        slot->idle = FALSE;
+        if (!running) slot->active = FALSE;
+        (void) WXThread_MutexUnlock(&(slot->mutex));
 
-        /* Extract the next work item */
-        item = pool->nextQueue;
-        pool->nextQueue = item->next;
-
-        /* Execute outside of lock boundaries */
-        (void) WXThread_MutexUnlock(&(pool->mutex));
-        (void) (item->execFn)(item->arg);
         (void) WXThread_MutexLock(&(pool->mutex));
-
-        /* Slice item and signal appropriately */
-        if (pool->queue == item) pool->queue = item->next;
-        if (pool->lastQueue == item) pool->lastQueue = item->prev;
-        if (item->next != NULL) item->next->prev = item->prev;
-        if (item->prev != NULL) item->prev->next = item->next;
-        if (item->hasWaiters) WXThread_CondBroadcast(&(pool->waitCond));
-        WXFree(item);
+        pool->idleCount--;
+        (void) WXThread_MutexUnlock(&(pool->mutex));
     }
 
-    /* Mark end, signal for termination and clean up */
+    /* Mark end (termination exits arrive here still flagged active, the
+     * linger path released its slot above and it may already be claimed) */
+    (void) WXThread_MutexLock(&(slot->mutex));
+    if (running) slot->active = FALSE;
+    (void) WXThread_MutexUnlock(&(slot->mutex));
+
+    (void) WXThread_MutexLock(&(pool->mutex));
     pool->workerCount--;
     if (pool->workerCount == 0) {
         WXThread_CondBroadcast(&(pool->waitCond));
@@ -94,6 +171,40 @@ static void *worker(void *arg) {
     return NULL;
 }
 
+/* Start a worker against an inactive slot, pool mutex held by caller */
+static WXThreadPoolWorker *spawnWorker(WXThreadPool *pool) {
+    WXThreadPoolWorker *slot;
+    size_t idx;
+
+    for (idx = 0; idx < pool->workerSlots; idx++) {
+        slot = pool->workers + idx;
+        if (slot->active) continue;
+
+        /* Claim under the slot guard, an exiting worker may still be in
+         * its shutdown sequence against this slot */
+        (void) WXThread_MutexLock(&(slot->mutex));
+        if (slot->active) {
+            (void) WXThread_MutexUnlock(&(slot->mutex));
+            continue;
+        }
+        slot->active = TRUE;
+        slot->idle = FALSE;
+        (void) WXThread_MutexUnlock(&(slot->mutex));
+
+        if (WXThread_Create(&(slot->thrd), worker, slot) != WXTRC_OK) {
+            (void) WXThread_MutexLock(&(slot->mutex));
+            slot->active = FALSE;
+            (void) WXThread_MutexUnlock(&(slot->mutex));
+            return NULL;
+        }
+        pool->workerCount++;
+        WXSTATS_INCR(poolWorkersStarted);
+        return slot;
+    }
+
+    return NULL;
+}
+
 /**
  * Initialize a thread pool instance.  Baseline set of threads will be started
  * on return of this method (if successful).  Pool will automatically grow and
@@ -112,30 +223,191 @@ static void *worker(void *arg) {
  */
 int WXThreadPool_Init(WXThreadPool *pool, size_t minWorkers, size_t maxWorkers,
                       size_t lingerIntvl) {
-    WXThread thrd;
+    WXThreadPoolWorker *slot;
+    size_t idx;
     int rc;
 
     /* Initialize the pool structure first */
-    pool->queue = pool->nextQueue = pool->lastQueue = NULL;
+    pool->queue = pool->lastQueue = NULL;
     pool->minWorkers = minWorkers;
     pool->maxWorkers = maxWorkers;
     pool->lingerIntvl = lingerIntvl;
     pool->workerCount = pool->idleCount = 0;
+    pool->nextSlot = 0;
+    pool->terminating = FALSE;
+    WXMemPool_Init(&(pool->itemPool), sizeof(WXThreadPoolQueueItem), 0);
     if (((rc = WXThread_MutexInit(&pool->mutex, FALSE)) != WXTRC_OK) ||
-            ((rc = WXThread_CondInit(&pool->workCond)) != WXTRC_OK) ||
             ((rc = WXThread_CondInit(&pool->waitCond)) != WXTRC_OK)) return rc;
 
-    /* Spawn the workers, all are idle at present */
-    while (minWorkers > 0) {
-        if (WXThread_Create(&thrd, worker, pool) == WXTRC_OK) {
-            pool->workerCount++;
+    /* Dispatch slots for the full worker limit, queues and guards up front */
+    pool->workerSlots = maxWorkers;
+    pool->workers = (WXThreadPoolWorker *)
+                WXMalloc(maxWorkers * sizeof(WXThreadPoolWorker));
+    if (pool->workers == NULL) return WXTRC_MEM_ERROR;
+    for (idx = 0; idx < pool->workerSlots; idx++) {
+        slot = pool->workers + idx;
+        slot->pool = pool;
+        slot->priorityHead = slot->priorityTail = NULL;
+        slot->pendingHead = slot->pendingTail = NULL;
+        slot->active = slot->idle = FALSE;
+        if (((rc = WXThread_MutexInit(&(slot->mutex), FALSE)) != WXTRC_OK) ||
+                ((rc = WXThread_CondInit(&(slot->cond))) != WXTRC_OK)) {
+            return rc;
         }
+    }
+
+    /* Spawn the baseline workers, all are idle at present */
+    (void) WXThread_MutexLock(&(pool->mutex));
+    while (minWorkers > 0) {
+        (void) spawnWorker(pool);
         minWorkers--;
     }
+    (void) WXThread_MutexUnlock(&(pool->mutex));
 
     return WXTRC_OK;
 }
 
+/* Common enqueue handling, registers and dispatches a set of work items */
+static int enqueueItems(WXThreadPool *pool, void *(**execFns)(void *),
+                        void **args, size_t count, int priority) {
+    WXThreadPoolQueueItem *item, *head, *tail, *subTail;
+    WXThreadPoolWorker *target, *slot;
+    size_t idx, idle, share, chunk, remaining;
+    int rc;
+
+    if (count == 0) return WXTRC_OK;
+
+    if ((rc = WXThread_MutexLock(&(pool->mutex))) != WXTRC_OK) return rc;
+
+    /* Immediate error if someone is enqueueing against a terminating pool */
+    if (pool->terminating) {
+        (void) WXThread_MutexUnlock(&(pool->mutex));
+        return WXTRC_SYS_ERROR;
+    }
+
+    /* Create the queue items for handoff to the workers (item pool is only
+     * accessed under the mutex, so inside the lock).  All or nothing... */
+    head = tail = NULL;
+    for (idx = 0; idx < count; idx++) {
+        item = (WXThreadPoolQueueItem *) WXMemPool_Alloc(&(pool->itemPool));
+        if (item == NULL) {
+            while ((item = head) != NULL) {
+                head = item->pendingNext;
+                WXMemPool_Release(&(pool->itemPool), item);
+            }
+            (void) WXThread_MutexUnlock(&(pool->mutex));
+            return WXTRC_MEM_ERROR;
+        }
+        item->execFn = execFns[idx];
+        item->arg = args[idx];
+        item->hasWaiters = FALSE;
+        item->pendingNext = NULL;
+
+        if (head == NULL) head = item;
+        else tail->pendingNext = item;
+        tail = item;
+    }
+
+    /* Track the items (for waiters), marking end of chain */
+    for (item = head; item != NULL; item = item->pendingNext) {
+        if (pool->queue == NULL) {
+            pool->queue = item;
+            item->prev = item->next = NULL;
+        } else {
+            pool->lastQueue->next = item;
+            item->prev = pool->lastQueue;
+            item->next = NULL;
+        }
+        pool->lastQueue = item;
+    }
+
+    /* Grow the worker set up-front to cover the burst where possible */
+    idle = 0;
+    for (idx = 0; idx < pool->workerSlots; idx++) {
+        slot = pool->workers + idx;
+        if ((slot->active) && (slot->idle)) idle++;
+    }
+    while ((idle < count) && (pool->workerCount < pool->maxWorkers)) {
+        if (spawnWorker(pool) == NULL) break;
+        idle++;
+    }
+
+    /* Even chunking across the running workers, one lock/wakeup per target
+     * (the steal sweeps rebalance any skew in actual execution times) */
+    share = (pool->workerCount == 0) ? count :
+                (count + pool->workerCount - 1) / pool->workerCount;
+    remaining = count;
+    while (remaining != 0) {
+        /* Dispatch preference: idle worker, then round-robin rotation */
+        target = NULL;
+        for (idx = 0; idx < pool->workerSlots; idx++) {
+            slot = pool->workers + idx;
+            if ((slot->active) && (slot->idle)) {
+                target = slot;
+                break;
+            }
+        }
+
+        /* Lock the target queue, revalidating liveness under its guard (the
+         * linger exits are flagged under the slot mutex and are final) */
+        if (target != NULL) {
+            (void) WXThread_MutexLock(&(target->mutex));
+            if (!target->active) {
+                (void) WXThread_MutexUnlock(&(target->mutex));
+                target = NULL;
+            }
+        }
+        if (target == NULL) {
+            for (idx = 0; idx < pool->workerSlots; idx++) {
+                slot = pool->workers +
+                           ((pool->nextSlot + idx) % pool->workerSlots);
+                (void) WXThread_MutexLock(&(slot->mutex));
+                if (slot->active) {
+                    target = slot;
+                    break;
+                }
+                (void) WXThread_MutexUnlock(&(slot->mutex));
+            }
+            pool->nextSlot++;
+        }
+        if (target == NULL) {
+            /* Complete linger collapse, park on the first slot - the steal
+             * sweep of the next started worker will recover the items */
+            target = pool->workers;
+            (void) WXThread_MutexLock(&(target->mutex));
+        }
+
+        /* Detach the leading chunk of the batch for this target */
+        chunk = (remaining < share) ? remaining : share;
+        subTail = head;
+        for (idx = 1; idx < chunk; idx++) subTail = subTail->pendingNext;
+        item = head;
+        head = subTail->pendingNext;
+        subTail->pendingNext = NULL;
+        remaining -= chunk;
+
+        /* Splice onto the (locked) target lane and wake the worker */
+        if (priority) {
+            if (target->priorityHead == NULL) target->priorityHead = item;
+            else target->priorityTail->pendingNext = item;
+            target->priorityTail = subTail;
+        } else {
+            if (target->pendingHead == NULL) target->pendingHead = item;
+            else target->pendingTail->pendingNext = item;
+            target->pendingTail = subTail;
+        }
+        target->idle = FALSE;
+        (void) WXThread_CondSignal(&(target->cond));
+        (void) WXThread_MutexUnlock(&(target->mutex));
+    }
+
+    /* Not much we can do here if the unlock fails... */
+    (void) WXThread_MutexUnlock(&(pool->mutex));
+
+    WXSTATS_ADD(poolEnqueues, count);
+    return WXTRC_OK;
+}
+
 /**
  * Enqueue a work item onto the thread pool, which might run immediately if
  * idle workers are available, start a new worker if not at the maximum limit
@@ -149,57 +421,50 @@ int WXThreadPool_Init(WXThreadPool *pool, size_t minWorkers, size_t maxWorkers,
  */
 int WXThreadPool_Enqueue(WXThreadPool *pool, void *(*execFn)(void *),
                          void *arg) {
-    WXThreadPoolQueueItem *item;
-    WXThread thrd;
-    int rc;
-
-    /* Immediate error if someone is enqueueing against a terminating pool */
-    if (pool->lastQueue == &terminator) return WXTRC_SYS_ERROR;
-
-    /* Create the queue item for handoff to the workers */
-    item = (WXThreadPoolQueueItem *) WXMalloc(sizeof(WXThreadPoolQueueItem));
-    if (item == NULL) return WXTRC_MEM_ERROR;
-    item->execFn = execFn;
-    item->arg = arg;
-    item->hasWaiters = FALSE;
-
-    /* Enqueue the item, marking active point and moving end of chain */
-    if ((rc = WXThread_MutexLock(&(pool->mutex))) != WXTRC_OK) {
-        WXFree(item);
-        return rc;
-    }
-    if (pool->queue == NULL) {
-        pool->queue = item;
-        item->prev = item->next = NULL;
-    } else {
-        pool->lastQueue->next = item;
-        item->prev = pool->lastQueue;
-        item->next = NULL;
-    }
-    if (pool->nextQueue == NULL) pool->nextQueue = item;
-    pool->lastQueue = item;
-
-    /* Wake an idle thread, start a new one or just leave for later */
-    /* In both cases, ignore error, item will be picked up anyways */
-    if (pool->idleCount != 0) {
-        (void) WXThread_CondSignal(&(pool->workCond));
-    } else if (pool->workerCount < pool->maxWorkers) {
-        if (WXThread_Create(&thrd, worker, pool) == WXTRC_OK) {
-            pool->workerCount++;
-        }
-    }
+    return enqueueItems(pool, &execFn, &arg, 1, FALSE);
+}
 
-    /* Not much we can do here if the unlock fails... */
-    (void) WXThread_MutexUnlock(&(pool->mutex));
+/**
+ * Enqueue a work item onto the high-priority lane of the thread pool.
+ * Identical to the enqueue() method except that workers run priority items
+ * before anything pending in the normal lane, so latency-critical items are
+ * not stuck behind bulk background work.
+ *
+ * @param pool The thread pool to enqueue the work item onto.
+ * @param execFn Function instance to be executed in the allocated worker.
+ * @param arg Opaque object reference to pass to the exec function.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThreadPool_EnqueuePriority(WXThreadPool *pool, void *(*execFn)(void *),
+                                 void *arg) {
+    return enqueueItems(pool, &execFn, &arg, 1, TRUE);
+}
 
-    return WXTRC_OK;
+/**
+ * Enqueue a set of work items onto the thread pool in a single operation.
+ * The entire batch is registered under one pool lock acquisition and spread
+ * over the workers in chunks with a single wakeup per targetted worker,
+ * which is far cheaper than looping on the enqueue() method for large
+ * bursts of small tasks.  On a memory failure, none of the batch items are
+ * enqueued.
+ *
+ * @param pool The thread pool to enqueue the work items onto.
+ * @param execFns Array of function instances to be executed in the workers.
+ * @param args Array of opaque object references to pass to the matching
+ *             exec functions.
+ * @param count Number of entries in the two arrays.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThreadPool_EnqueueBatch(WXThreadPool *pool, void *(**execFns)(void *),
+                              void **args, size_t count) {
+    return enqueueItems(pool, execFns, args, count, FALSE);
 }
 
 /**
  * Wait for the completion of a specific enqueued item, if it is not already
  * complete.  Similar to WXThread_Join for the specific enqueued item.  Note
  * that this is matched according to the original arguments from the enqueue()
- * method, so there is an implication of uniqueness in those arguments.  
+ * method, so there is an implication of uniqueness in those arguments.
  *
  * @param pool The thread pool to wait for the work item from.
  * @param execFn Original execution function as passed to the enqueue() method.
@@ -260,40 +525,47 @@ int WXThreadPool_WaitAll(WXThreadPool *pool) {
 /**
  * Signal termination to all workers in the provided thread pool and wait
  * for all active workers to exit.  This method also blocks any further
- * enqueue() calls and cleans up the thread pool instance (destroys all 
+ * enqueue() calls and cleans up the thread pool instance (destroys all
  * internally allocated resources but not the structure itself).
  *
  * @param pool The thread pool to be terminated.
  * @return One of the WXTRC_* result codes, depending on outcome.
  */
 int WXThreadPool_Terminate(WXThreadPool *pool) {
+    WXThreadPoolWorker *slot;
+    size_t idx;
     int rc;
 
-    /* Again, same idea but in this case push the terminator onto the queue */
+    /* Flag the termination, workers drain all queues before exiting */
     if ((rc = WXThread_MutexLock(&(pool->mutex))) != WXTRC_OK) return rc;
-
-    if (pool->queue == NULL) {
-        pool->queue = &terminator;
-    } else {
-        pool->lastQueue->next = &terminator;
-    }
-    if (pool->nextQueue == NULL) pool->nextQueue = &terminator;
-    pool->lastQueue = &terminator;
+    pool->terminating = TRUE;
 
     /* Wake all workers, if only to terminate */
-    (void) WXThread_CondBroadcast(&(pool->workCond));
+    for (idx = 0; idx < pool->workerSlots; idx++) {
+        slot = pool->workers + idx;
+        (void) WXThread_MutexLock(&(slot->mutex));
+        (void) WXThread_CondSignal(&(slot->cond));
+        (void) WXThread_MutexUnlock(&(slot->mutex));
+    }
 
-    /* Wait until the queue has drained */
+    /* Wait until the workers have drained the queues and exited */
     while (pool->workerCount != 0) {
         (void) WXThread_CondWait(&(pool->waitCond), &(pool->mutex));
     }
-    if (pool->queue != &terminator) abort();
+    if (pool->queue != NULL) abort();
     (void) WXThread_MutexUnlock(&(pool->mutex));
 
-    /* Clean up the threading elements */
+    /* Clean up the threading elements, slots and the item recycler */
+    for (idx = 0; idx < pool->workerSlots; idx++) {
+        slot = pool->workers + idx;
+        (void) WXThread_MutexDestroy(&(slot->mutex));
+        (void) WXThread_CondDestroy(&(slot->cond));
+    }
+    WXFree(pool->workers);
+    pool->workers = NULL;
     (void) WXThread_MutexDestroy(&(pool->mutex));
-    (void) WXThread_CondDestroy(&(pool->workCond));
     (void) WXThread_CondDestroy(&(pool->waitCond));
+    WXMemPool_Destroy(&(pool->itemPool));
 
     return WXTRC_OK;
 }
@@ -15,24 +15,33 @@
 
 /* Well, it's built on the threading wrapper library */
 #include "thread.h"
+#include "mem.h"
 
 /* The pool is exposed (alloc and diags) but the internals are opaque */
 typedef struct WXThreadPoolQueueItem WXThreadPoolQueueItem;
+typedef struct WXThreadPoolWorker WXThreadPoolWorker;
 
 typedef struct WXThreadPool {
     /* Multi-threading elements to support parallel worker access/messaging */
     WXThread_Mutex mutex;
-    WXThread_Cond workCond;
     WXThread_Cond waitCond;
 
-    /* Linked list of queued items (with edge tracking) */
-    WXThreadPoolQueueItem *queue, *nextQueue, *lastQueue;
+    /* Tracking list of enqueued-but-incomplete items (with edge tracking) */
+    WXThreadPoolQueueItem *queue, *lastQueue;
 
     /* Provided configuration parameters for the pool instance */
     size_t minWorkers, maxWorkers, lingerIntvl;
 
     /* For efficiency, the counts of running workers and external waiters */
     size_t workerCount, idleCount;
+
+    /* Recycling allocator for the queue items (guarded by the pool mutex) */
+    WXMemPool itemPool;
+
+    /* Per-worker dispatch slots for low-contention pop/steal scheduling */
+    WXThreadPoolWorker *workers;
+    size_t workerSlots, nextSlot;
+    int terminating;
 } WXThreadPool;
 
 /**
@@ -68,6 +77,38 @@ int WXThreadPool_Init(WXThreadPool *pool, size_t minWorkers, size_t maxWorkers,
 int WXThreadPool_Enqueue(WXThreadPool *pool, void *(*execFn)(void *),
                          void *arg);
 
+/**
+ * Enqueue a work item onto the high-priority lane of the thread pool.
+ * Identical to the enqueue() method except that workers run priority items
+ * before anything pending in the normal lane, so latency-critical items are
+ * not stuck behind bulk background work.
+ *
+ * @param pool The thread pool to enqueue the work item onto.
+ * @param execFn Function instance to be executed in the allocated worker.
+ * @param arg Opaque object reference to pass to the exec function.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThreadPool_EnqueuePriority(WXThreadPool *pool, void *(*execFn)(void *),
+                                 void *arg);
+
+/**
+ * Enqueue a set of work items onto the thread pool in a single operation.
+ * The entire batch is registered under one pool lock acquisition and spread
+ * over the workers in chunks with a single wakeup per targetted worker,
+ * which is far cheaper than looping on the enqueue() method for large
+ * bursts of small tasks.  On a memory failure, none of the batch items are
+ * enqueued.
+ *
+ * @param pool The thread pool to enqueue the work items onto.
+ * @param execFns Array of function instances to be executed in the workers.
+ * @param args Array of opaque object references to pass to the matching
+ *             exec functions.
+ * @param count Number of entries in the two arrays.
+ * @return One of the WXTRC_* result codes, depending on outcome.
+ */
+int WXThreadPool_EnqueueBatch(WXThreadPool *pool, void *(**execFns)(void *),
+                              void **args, size_t count);
+
 /**
  * Wait for the completion of a specific enqueued item, if it is not already
  * complete.  Similar to WXThread_Join for the specific enqueued item.  Note
@@ -40,8 +40,8 @@ int main(int argc, char **argv) {
 
     /* At some point, put the MTraq testcase identifiers in here */
 
-    /* Just play with the local buffer first */
-    WXArray_InitLocal(&array, Misaligned, data, 4);
+    /* Just play with the local buffer first (sized from the block itself) */
+    WXArray_InitInline(&array, Misaligned, data);
 
     tst.ch = '3';
     tst.ptr = three;
@@ -127,5 +127,93 @@ int main(int argc, char **argv) {
     }
     WXArray_Destroy(&array);
 
+    /* Ring-indexed instance on the local block, same content pattern */
+    WXArray_InitRingLocal(&array, Misaligned, data, 4);
+
+    tst.ch = '3'; tst.ptr = three; (void) strcpy(tst.str, three);
+    if (WXArray_Push(&array, &tst) == NULL) {
+        (void) fprintf(stderr, "Failed to push ring\n");
+        exit(1);
+    }
+    tst.ch = '2'; tst.ptr = two; (void) strcpy(tst.str, two);
+    if (WXArray_Unshift(&array, &tst) == NULL) {
+        (void) fprintf(stderr, "Failed to unshift ring\n");
+        exit(1);
+    }
+    tst.ch = '4'; tst.ptr = four; (void) strcpy(tst.str, four);
+    if (WXArray_Push(&array, &tst) == NULL) {
+        (void) fprintf(stderr, "Failed to push ring\n");
+        exit(1);
+    }
+    tst.ch = '1'; tst.ptr = one; (void) strcpy(tst.str, one);
+    if (WXArray_Unshift(&array, &tst) == NULL) {
+        (void) fprintf(stderr, "Failed to unshift ring\n");
+        exit(1);
+    }
+
+    if (array.length != 4) {
+        (void) fprintf(stderr, "Incorrect ring array length\n");
+        exit(1);
+    }
+    scanCounter = 1;
+    if (WXArray_Scan(&array, scanner, "testing") != 12) {
+        (void) fprintf(stderr, "Incorrect ring scan outcome\n");
+        exit(1);
+    }
+
+    if ((WXArray_Shift(&array, &tst) == NULL) || (tst.ptr != one)) {
+        (void) fprintf(stderr, "Incorrect ring shift one\n");
+        exit(1);
+    }
+    if ((WXArray_Pop(&array, &tst) == NULL) || (tst.ptr != four)) {
+        (void) fprintf(stderr, "Incorrect ring pop one\n");
+        exit(1);
+    }
+    if ((WXArray_Pop(&array, &tst) == NULL) || (tst.ptr != three)) {
+        (void) fprintf(stderr, "Incorrect ring pop two\n");
+        exit(1);
+    }
+    if ((WXArray_Shift(&array, &tst) == NULL) || (tst.ptr != two)) {
+        (void) fprintf(stderr, "Incorrect ring shift two\n");
+        exit(1);
+    }
+    WXArray_Destroy(&array);
+
+    /* Cycle a ring work queue hard enough to wrap and spill repeatedly */
+    if (WXArray_InitRing(&array, Misaligned, 4) == NULL) {
+        (void) fprintf(stderr, "Failed to initialize ring array\n");
+        exit(1);
+    }
+    for (idx = 0; idx < 1024; idx++) {
+        tst.ch = 0x20 + (idx & 63);
+        tst.ptr = (void *) (intptr_t) idx;
+        if (WXArray_Push(&array, &tst) == NULL) {
+            (void) fprintf(stderr, "Failed ring queue push %d\n", idx);
+            exit(1);
+        }
+        /* Consume at half rate, queue depth grows and wraps the ring */
+        if ((idx % 2) == 0) continue;
+        if (WXArray_Shift(&array, &tst) == NULL) {
+            (void) fprintf(stderr, "Failed ring queue shift %d\n", idx);
+            exit(1);
+        }
+        if ((intptr_t) tst.ptr != (intptr_t) (idx / 2)) {
+            (void) fprintf(stderr, "Incorrect ring queue order %d\n", idx);
+            exit(1);
+        }
+    }
+    for (idx = 512; idx < 1024; idx++) {
+        if ((WXArray_Shift(&array, &tst) == NULL) ||
+                ((intptr_t) tst.ptr != (intptr_t) idx)) {
+            (void) fprintf(stderr, "Incorrect ring queue drain %d\n", idx);
+            exit(1);
+        }
+    }
+    if (WXArray_Shift(&array, &tst) != NULL) {
+        (void) fprintf(stderr, "Shift from emptied ring queue?\n");
+        exit(1);
+    }
+    WXArray_Destroy(&array);
+
     return 0;
 }
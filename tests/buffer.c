@@ -9,8 +9,12 @@
 
 /* Forward declarations */
 static void testBasics();
+static void testArena();
+static void testMemPool();
 static void testPack();
 static void testUnpack();
+static void testCompiled();
+static void testMapFile();
 
 /**
  * Main testing entry point.  Just a bunch of manipulations of the dynamic
@@ -20,8 +24,12 @@ int main(int argc, char **argv) {
     /* At some point, put the MTraq testcase identifiers in here */
 
     testBasics();
+    testArena();
+    testMemPool();
     testPack();
     testUnpack();
+    testCompiled();
+    testMapFile();
 
     (void) fprintf(stderr, "All tests complete\n");
 
@@ -104,6 +112,32 @@ static void testBasics() {
     }
     WXBuffer_Destroy(&dup);
 
+    /* Borrowed views share the storage, no copy until growth */
+    WXBuffer_Slice(&dup, &buffer, 10, 20);
+    if ((dup.length != 20) || (dup.buffer != buffer.buffer + 10) ||
+            (memcmp(dup.buffer, bigValue + 10, 20) != 0)) {
+       (void) fprintf(stderr, "Incorrect content for slice view\n");
+       exit(1);
+    }
+    if (WXBuffer_Append(&dup, (uint8_t *) bigValue, 40, FALSE) == NULL) {
+       (void) fprintf(stderr, "Unexpected memory error on view append\n");
+       exit(1);
+    }
+    if ((dup.buffer == buffer.buffer + 10) || (dup.length != 60) ||
+            (memcmp(dup.buffer, bigValue + 10, 20) != 0) ||
+            (memcmp(dup.buffer + 20, bigValue, 40) != 0)) {
+       (void) fprintf(stderr, "Incorrect content for detached view\n");
+       exit(1);
+    }
+    WXBuffer_Destroy(&dup);
+
+    /* Out-of-range slices clamp to the source content */
+    WXBuffer_Slice(&dup, &buffer, buffer.length + 10, 20);
+    if (dup.length != 0) {
+       (void) fprintf(stderr, "Incorrect length for clamped slice\n");
+       exit(1);
+    }
+
     WXBuffer_Empty(&buffer);
     if (WXBuffer_Printf(&buffer, "Test '%s' %d", "test", 12) == NULL) {
        (void) fprintf(stderr, "Failed to print to buffer\n");
@@ -117,6 +151,133 @@ static void testBasics() {
     WXBuffer_Destroy(&buffer);
 }
 
+/* Exercise the arena-backed allocation/reset cycles */
+static void testArena() {
+    WXBuffer buffers[8];
+    WXArena arena;
+    int idx, cycle;
+
+    if (!WXArena_Init(&arena, 1024)) {
+       (void) fprintf(stderr, "Unexpected memory error on arena init\n");
+       exit(1);
+    }
+
+    for (cycle = 0; cycle < 4; cycle++) {
+        for (idx = 0; idx < 8; idx++) {
+            if (WXBuffer_InitArena(&buffers[idx], &arena, 32) == NULL) {
+               (void) fprintf(stderr, "Unexpected arena buffer init error\n");
+               exit(1);
+            }
+        }
+        for (idx = 0; idx < 8; idx++) {
+            /* Several appends to force growth carving within the arena */
+            if ((WXBuffer_Printf(&buffers[idx], "cycle %d", cycle) == NULL) ||
+                    (WXBuffer_Printf(&buffers[idx], " buffer %d with content "
+                                     "exceeding the initial allocation",
+                                     idx) == NULL)) {
+               (void) fprintf(stderr, "Unexpected arena buffer append error\n");
+               exit(1);
+            }
+        }
+        for (idx = 0; idx < 8; idx++) {
+            if ((buffers[idx].length < 32) ||
+                    (strncmp((char *) buffers[idx].buffer, "cycle ", 6) != 0)) {
+               (void) fprintf(stderr, "Incorrect arena buffer content\n");
+               exit(1);
+            }
+            /* No-op for arena-backed storage, but must be safe */
+            WXBuffer_Destroy(&buffers[idx]);
+        }
+
+        /* One reset releases the entire cycle */
+        WXArena_Reset(&arena);
+    }
+
+#ifndef WIN32
+    {
+        /* Vectored file write, header + payload in one pass */
+        uint8_t rdBuff[256];
+        WXBuffer *chain[2];
+        int fds[2];
+
+        chain[0] = &buffers[0]; chain[1] = &buffers[1];
+        WXBuffer_Empty(&buffers[0]); WXBuffer_Empty(&buffers[1]);
+        (void) WXBuffer_Append(&buffers[0], (uint8_t *) "hdr:", 4, FALSE);
+        (void) WXBuffer_Append(&buffers[1], (uint8_t *) "payload", 7, FALSE);
+        if (pipe(fds) != 0) {
+           (void) fprintf(stderr, "Unexpected pipe creation failure\n");
+           exit(1);
+        }
+        if (WXBuffer_WriteVFile(chain, 2, fds[1]) != 11) {
+           (void) fprintf(stderr, "Incorrect vectored write count\n");
+           exit(1);
+        }
+        if ((buffers[0].offset != buffers[0].length) ||
+                (buffers[1].offset != buffers[1].length)) {
+           (void) fprintf(stderr, "Vectored write did not consume buffers\n");
+           exit(1);
+        }
+        if ((read(fds[0], rdBuff, sizeof(rdBuff)) != 11) ||
+                (memcmp(rdBuff, "hdr:payload", 11) != 0)) {
+           (void) fprintf(stderr, "Incorrect vectored write content\n");
+           exit(1);
+        }
+        (void) close(fds[0]); (void) close(fds[1]);
+    }
+#endif
+
+    /* Oversized allocations get dedicated blocks */
+    if (WXArena_Alloc(&arena, 4096) == NULL) {
+       (void) fprintf(stderr, "Unexpected oversized arena alloc error\n");
+       exit(1);
+    }
+    if (WXArena_Alloc(&arena, 64) == NULL) {
+       (void) fprintf(stderr, "Unexpected arena alloc error\n");
+       exit(1);
+    }
+    WXArena_Reset(&arena);
+
+    WXArena_Destroy(&arena);
+}
+
+/* Fixed-size record for the slab pool exercise below */
+typedef struct {
+    int tag;
+    double val;
+} PoolRec;
+
+static void testMemPool() {
+    PoolRec *recs[100], *rec;
+    WXMemPool pool;
+    int idx;
+
+    /* Small slabs to force chaining within the allocation run */
+    WXMemPool_Init(&pool, sizeof(PoolRec), 16);
+    for (idx = 0; idx < 100; idx++) {
+        if ((recs[idx] = (PoolRec *) WXMemPool_Alloc(&pool)) == NULL) {
+           (void) fprintf(stderr, "Unexpected memory error on pool alloc\n");
+           exit(1);
+        }
+        recs[idx]->tag = idx;
+        recs[idx]->val = idx * 2.5;
+    }
+    for (idx = 0; idx < 100; idx++) {
+        if ((recs[idx]->tag != idx) || (recs[idx]->val != idx * 2.5)) {
+           (void) fprintf(stderr, "Pool record content corrupted\n");
+           exit(1);
+        }
+    }
+
+    /* Released slots recycle ahead of fresh slab carving */
+    WXMemPool_Release(&pool, recs[42]);
+    if ((rec = (PoolRec *) WXMemPool_Alloc(&pool)) != recs[42]) {
+       (void) fprintf(stderr, "Released pool slot was not recycled\n");
+       exit(1);
+    }
+
+    WXMemPool_Destroy(&pool);
+}
+
 #define BCHK(bffr, compare, case) \
     if ((bffr).length != sizeof(compare)){ \
         (void) fprintf(stderr, \
@@ -525,3 +686,144 @@ static void testUnpack() {
        exit(1);
     }
 }
+
+/* Precompiled formats must behave exactly like their string originals */
+static void testCompiled() {
+    uint8_t localBuffer[64];
+    WXPackFormat *prog;
+    WXBuffer buffer;
+    uint16_t sha, shb;
+    uint64_t llda;
+    uint32_t lda;
+    uint8_t cha;
+
+    WXBuffer_InitLocal(&buffer, localBuffer, sizeof(localBuffer));
+
+    /* Fixed record layout (the motivating wire-protocol header case) */
+    if ((prog = WXBuffer_CompileFormat("CCnnCx")) == NULL) {
+        (void) fprintf(stderr, "ERROR: compile failure for fixed format\n");
+        exit(1);
+    }
+    if (prog->sizeBound != 8) {
+        (void) fprintf(stderr, "ERROR: incorrect compiled size bound\n");
+        exit(1);
+    }
+    WXBuffer_Empty(&buffer);
+    WXBuffer_PackCompiled(&buffer, prog, 1, 6, 0x1234, 0x5678, 0xAB);
+    BCHK(buffer, ((uint8_t[]) { 0x01, 0x06, 0x12, 0x34, 0x56, 0x78,
+                                0xAB, 0x00 }),
+         "compiled fixed packing");
+
+    /* And reuse of the same program, including the unpacking direction */
+    WXBuffer_Empty(&buffer);
+    WXBuffer_PackCompiled(&buffer, prog, 1, 7, 0x4321, 0x8765, 0xCD);
+    if ((WXBuffer_UnpackCompiled(&buffer, prog,
+                                 &cha, &cha, &sha, &shb, &cha) == NULL) ||
+            (sha != 0x4321) || (shb != 0x8765) || (cha != 0xCD)) {
+        (void) fprintf(stderr, "ERROR: invalid compiled unpack\n");
+        exit(1);
+    }
+    WXBuffer_DestroyFormat(prog);
+
+    /* Groups, endian modifiers and argument counts compile through */
+    if ((prog = WXBuffer_CompileFormat("(sN)>2x%")) == NULL) {
+        (void) fprintf(stderr, "ERROR: compile failure for group format\n");
+        exit(1);
+    }
+    if (prog->sizeBound != 0) {
+        (void) fprintf(stderr, "ERROR: unexpected bound for variable count\n");
+        exit(1);
+    }
+    WXBuffer_Empty(&buffer);
+    WXBuffer_PackCompiled(&buffer, prog, 0x1234, 0x13579bdf,
+                          0x4321, 0xeca86420, 2);
+    BCHK(buffer, ((uint8_t[]) { 0x12, 0x34, 0x13, 0x57, 0x9b, 0xdf,
+                                0x43, 0x21, 0xec, 0xa8, 0x64, 0x20,
+                                0x00, 0x00 }),
+         "compiled group packing");
+    WXBuffer_DestroyFormat(prog);
+
+    /* Cross-check a compiled result against the string form */
+    if ((prog = WXBuffer_CompileFormat("yYl<")) == NULL) {
+        (void) fprintf(stderr, "ERROR: compile failure for varint format\n");
+        exit(1);
+    }
+    WXBuffer_Empty(&buffer);
+    WXBuffer_PackCompiled(&buffer, prog, 300, (uint64_t) 2, 0x01234567);
+    WXBuffer_DestroyFormat(prog);
+    if ((WXBuffer_Unpack(&buffer, "yYl<", &lda, &llda, &lda) == NULL)) {
+        (void) fprintf(stderr, "ERROR: invalid compiled/string crossover\n");
+        exit(1);
+    }
+    if (lda != 0x01234567) {
+        (void) fprintf(stderr, "ERROR: compiled varint pack mismatch\n");
+        exit(1);
+    }
+
+    /* Variable group counts cannot be precompiled */
+    if (WXBuffer_CompileFormat("(ss)%") != NULL) {
+        (void) fprintf(stderr, "ERROR: variable group compile should fail\n");
+        exit(1);
+    }
+}
+
+/* Validate memory-mapped file backing and copy-on-grow detachment */
+static void testMapFile() {
+    const char *fileName = "mapfile.tst";
+    WXBuffer buffer;
+    uint8_t data[3000];
+    FILE *fp;
+    int idx;
+
+    /* Generate a recognizable test file */
+    for (idx = 0; idx < sizeof(data); idx++) data[idx] = (uint8_t) (idx % 251);
+    if ((fp = fopen(fileName, "wb")) == NULL) {
+        (void) fprintf(stderr, "ERROR: unable to create map test file\n");
+        exit(1);
+    }
+    if (fwrite(data, 1, sizeof(data), fp) != sizeof(data)) {
+        (void) fprintf(stderr, "ERROR: unable to fill map test file\n");
+        exit(1);
+    }
+    (void) fclose(fp);
+
+    /* Mapping should expose the file content directly */
+    if (WXBuffer_MapFile(&buffer, fileName) == NULL) {
+        (void) fprintf(stderr, "ERROR: unable to map test file\n");
+        exit(1);
+    }
+    if ((buffer.length != sizeof(data)) ||
+            (memcmp(buffer.buffer, data, sizeof(data)) != 0)) {
+        (void) fprintf(stderr, "ERROR: mapped content mismatch\n");
+        exit(1);
+    }
+
+    /* In-place edits are copy-on-write, file remains untouched */
+    buffer.buffer[0] = 0xFF;
+
+    /* Growth detaches the content into heap storage */
+    if (WXBuffer_Append(&buffer, data, sizeof(data), TRUE) == NULL) {
+        (void) fprintf(stderr, "ERROR: unable to grow mapped buffer\n");
+        exit(1);
+    }
+    if ((buffer.length != 2 * sizeof(data)) ||
+            (buffer.buffer[0] != 0xFF) ||
+            (memcmp(buffer.buffer + 1, data + 1, sizeof(data) - 1) != 0) ||
+            (memcmp(buffer.buffer + sizeof(data), data, sizeof(data)) != 0)) {
+        (void) fprintf(stderr, "ERROR: detached map content mismatch\n");
+        exit(1);
+    }
+    WXBuffer_Destroy(&buffer);
+
+    /* Verify the original file was not modified by the mapped edit */
+    if (WXBuffer_MapFile(&buffer, fileName) == NULL) {
+        (void) fprintf(stderr, "ERROR: unable to re-map test file\n");
+        exit(1);
+    }
+    if (memcmp(buffer.buffer, data, sizeof(data)) != 0) {
+        (void) fprintf(stderr, "ERROR: mapped edit leaked to the file\n");
+        exit(1);
+    }
+    WXBuffer_Destroy(&buffer);
+    (void) remove(fileName);
+}
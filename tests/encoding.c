@@ -70,4 +70,53 @@ int main(int argc, char **argv) {
         (void) fprintf(stderr, "Incorrect URI encoding of special chars\n");
         exit(1);
     }
+    buffer.length = 0;
+    if ((WXURL_EscapeURI(&buffer, "abcdefghijklmnopqrstuvwxyz"
+                                  "abcdefghijklmnopqrst/0123456789",
+                         -1) == NULL) ||
+            (buffer.length != 59) ||
+            (strncmp((char *) buffer.buffer,
+                     "abcdefghijklmnopqrstuvwxyz"
+                     "abcdefghijklmnopqrst%2F0123456789", 59) != 0)) {
+        (void) fprintf(stderr, "Incorrect URI encoding of long content\n");
+        exit(1);
+    }
+
+    /* UTF-8 scan/validate kernels, long runs to exercise the word strides */
+    if ((WXUTF8_ScanASCII("abcdef", 6) != 6) ||
+            (WXUTF8_ScanASCII("ab\xC3\xA9zz", 6) != 2) ||
+            (WXUTF8_ScanASCII("\xC3\xA9", 2) != 0)) {
+        (void) fprintf(stderr, "Incorrect ASCII scan of short content\n");
+        exit(1);
+    }
+    if ((WXUTF8_ScanASCII("abcdefghijklmnopqrstuvwxyz0123456789"
+                          "abcdefghijklmnopqrstuvwxyz0123456789", 72) != 72) ||
+            (WXUTF8_ScanASCII("abcdefghijklmnopqrstuvwxyz0123456789"
+                              "abcdefghijklmnop\xD1\xB2zzzzzzzzzzzzzzzzzz",
+                              72) != 52)) {
+        (void) fprintf(stderr, "Incorrect ASCII scan of long content\n");
+        exit(1);
+    }
+    if ((WXUTF8_Validate("abc\xD1\xB2\xE4\xB8\x9D\xF0\x9F\x98\x80z",
+                         13) != 13) ||
+            (WXUTF8_Validate("abcdefghijklmnopqrstuvwxyz0123456789"
+                             "abcdefghijklmnop\xE4\xB8\x9Dzz", 57) != 57)) {
+        (void) fprintf(stderr, "Incorrect validation of valid UTF-8\n");
+        exit(1);
+    }
+    if ((WXUTF8_Validate("ab\xC0\xAF", 4) != 2) ||
+            (WXUTF8_Validate("ab\xE0\x80\xA0", 5) != 2) ||
+            (WXUTF8_Validate("ab\xED\xA0\x80", 5) != 2) ||
+            (WXUTF8_Validate("ab\xF4\x90\x80\x80", 6) != 2) ||
+            (WXUTF8_Validate("ab\xF5\x80\x80\x80", 6) != 2) ||
+            (WXUTF8_Validate("ab\xBFzz", 5) != 2)) {
+        (void) fprintf(stderr, "Incorrect validation of malformed UTF-8\n");
+        exit(1);
+    }
+    if ((WXUTF8_Validate("ab\xE4\xB8", 4) != 2) ||
+            (WXUTF8_Validate("ab\xE4\xB8\x11", 5) != 2) ||
+            (WXUTF8_Validate("ab\xF0\x9F\x98", 5) != 2)) {
+        (void) fprintf(stderr, "Incorrect validation of truncated UTF-8\n");
+        exit(1);
+    }
 }
@@ -8,6 +8,25 @@
 #include "hash.h"
 #include "mem.h"
 
+/* Counting scanner for verifying incremental drain coverage */
+static int countScanner(WXHashTable *table, void *key, void *object,
+                        void *userData) {
+    (*((int *) userData))++;
+    return 0;
+}
+
+/* Ordering scanner, verifies keys arrive in strict insertion order */
+static int orderScanner(WXHashTable *table, void *key, void *object,
+                        void *userData) {
+    int *state = (int *) userData, seq;
+
+    if (sscanf((char *) key, "entry-%d", &seq) != 1) return -1;
+    if (seq <= state[1]) return -1;
+    state[0]++;
+    state[1] = seq;
+    return 0;
+}
+
 /**
  * Main testing entry point.  Just a bunch of manipulations of the hashtable
  * codepoints.
@@ -19,6 +38,7 @@ int main(int argc, char **argv) {
     char bigTable[1024][64], *origKey, *origObj, *val, *cmp;
     WXHashTable hashTable, dupHashTable;
     WXDictionary dict, dupDict;
+    WXInternPool internPool;
     int idx, idy, isSet[1024];
 
     /* Really fill a hashtable */
@@ -168,6 +188,222 @@ int main(int argc, char **argv) {
     WXHash_Destroy(&hashTable);
     WXHash_Destroy(&dupHashTable);
 
+    /* Same workout against the linear-probing storage engine */
+    if (!WXHash_InitTableLinear(&hashTable, -1)) {
+        (void) fprintf(stderr, "Error: unexpected memory failure\n");
+        exit(1);
+    }
+    for (idx = 0; idx < 1024; idx++) {
+        if (!WXHash_InsertEntry(&hashTable, bigTable[idx], bigTable[idx],
+                                NULL, NULL, WXHash_StrHashFn,
+                                WXHash_StrEqualsFn)) {
+            (void) fprintf(stderr, "Linear table insert failure\n");
+            exit(1);
+        }
+        isSet[idx] = 1;
+    }
+    for (idx = 0; idx < 512; idx++) {
+        idy = rand() & 1023;
+        if (WXHash_RemoveEntry(&hashTable, bigTable[idy],
+                               (void **) &origKey, (void **) &origObj,
+                               WXHash_StrHashFn, WXHash_StrEqualsFn)) {
+            if ((!isSet[idy]) || (origKey != bigTable[idy]) ||
+                    (origObj != bigTable[idy])) {
+                (void) fprintf(stderr, "Incorrect linear remove result\n");
+                exit(1);
+            }
+            isSet[idy] = 0;
+        } else if (isSet[idy]) {
+            (void) fprintf(stderr, "No remove for existent linear entry?\n");
+            exit(1);
+        }
+    }
+    for (idx = 0; idx < 1024; idx++) {
+        val = WXHash_GetEntry(&hashTable, bigTable[idx],
+                              WXHash_StrHashFn, WXHash_StrEqualsFn);
+        if (isSet[idx]) {
+            if (val != bigTable[idx]) {
+                (void) fprintf(stderr, "Linear table get mismatch?\n");
+                exit(1);
+            }
+        } else if (val != NULL) {
+            (void) fprintf(stderr, "Linear get data for non-entry?\n");
+            exit(1);
+        }
+    }
+    if (!WXHash_Duplicate(&dupHashTable, &hashTable, NULL)) {
+        (void) fprintf(stderr, "Unexpected memory failure on linear dup\n");
+        exit(1);
+    }
+    for (idx = 0; idx < 1024; idx++) {
+        if (!isSet[idx]) continue;
+        if (WXHash_GetEntry(&dupHashTable, bigTable[idx],
+                            WXHash_StrHashFn,
+                            WXHash_StrEqualsFn) != bigTable[idx]) {
+            (void) fprintf(stderr, "Linear dup table get mismatch?\n");
+            exit(1);
+        }
+    }
+    WXHash_Destroy(&hashTable);
+    WXHash_Destroy(&dupHashTable);
+
+    /* Exercise the bounded (incremental) rehash during growth */
+    if (!WXHash_InitTable(&hashTable, -1)) {
+        (void) fprintf(stderr, "Error: unexpected memory failure\n");
+        exit(1);
+    }
+    WXHash_SetIncremental(&hashTable, TRUE);
+    for (idx = 0; idx < 1024; idx++) {
+        if (!WXHash_PutEntry(&hashTable, bigTable[idx], bigTable[idx],
+                             NULL, NULL, WXHash_StrHashFn,
+                             WXHash_StrEqualsFn)) {
+            (void) fprintf(stderr, "Incremental table put failure\n");
+            exit(1);
+        }
+
+        /* Every entry remains reachable mid-drain */
+        for (idy = 0; idy <= idx; idy += 97) {
+            if (WXHash_GetEntry(&hashTable, bigTable[idy],
+                                WXHash_StrHashFn,
+                                WXHash_StrEqualsFn) != bigTable[idy]) {
+                (void) fprintf(stderr, "Mid-drain get mismatch?\n");
+                exit(1);
+            }
+        }
+    }
+    idy = 0;
+    if ((WXHash_Scan(&hashTable, countScanner, &idy) != 0) || (idy != 1024)) {
+        (void) fprintf(stderr, "Incorrect mid-drain scan count (%d)\n", idy);
+        exit(1);
+    }
+    for (idx = 0; idx < 1024; idx += 2) {
+        if (!WXHash_RemoveEntry(&hashTable, bigTable[idx],
+                                (void **) &origKey, (void **) &origObj,
+                                WXHash_StrHashFn, WXHash_StrEqualsFn) ||
+                (origKey != bigTable[idx])) {
+            (void) fprintf(stderr, "Incremental remove failure\n");
+            exit(1);
+        }
+    }
+    /* Replacement put that may straddle the old/new blocks */
+    for (idx = 1; idx < 1024; idx += 2) {
+        if (!WXHash_PutEntry(&hashTable, bigTable[idx], bigTable[idx],
+                             (void **) &origKey, (void **) &origObj,
+                             WXHash_StrHashFn, WXHash_StrEqualsFn) ||
+                (origKey != bigTable[idx])) {
+            (void) fprintf(stderr, "Incremental replace failure\n");
+            exit(1);
+        }
+    }
+    /* Disabling completes the drain immediately */
+    WXHash_SetIncremental(&hashTable, FALSE);
+    idy = 0;
+    if ((WXHash_Scan(&hashTable, countScanner, &idy) != 0) || (idy != 512)) {
+        (void) fprintf(stderr, "Incorrect post-drain scan count (%d)\n", idy);
+        exit(1);
+    }
+    WXHash_Destroy(&hashTable);
+
+    /* Dense storage mode, scans sweep packed entries in insertion order */
+    {
+        int orderState[2];
+
+        if (!WXHash_InitTable(&hashTable, -1)) {
+            (void) fprintf(stderr, "Error: unexpected memory failure\n");
+            exit(1);
+        }
+        if (!WXHash_SetDense(&hashTable, TRUE)) {
+            (void) fprintf(stderr, "Dense mode enable failure\n");
+            exit(1);
+        }
+        for (idx = 0; idx < 1024; idx++) {
+            if (!WXHash_PutEntry(&hashTable, bigTable[idx], bigTable[idx],
+                                 NULL, NULL, WXHash_StrHashFn,
+                                 WXHash_StrEqualsFn)) {
+                (void) fprintf(stderr, "Dense table put failure\n");
+                exit(1);
+            }
+        }
+        orderState[0] = 0; orderState[1] = -1;
+        if ((WXHash_Scan(&hashTable, orderScanner, orderState) != 0) ||
+                (orderState[0] != 1024)) {
+            (void) fprintf(stderr, "Dense scan order/count failure (%d)\n",
+                           orderState[0]);
+            exit(1);
+        }
+
+        /* Removal debris is skipped and order survives compaction */
+        for (idx = 0; idx < 1024; idx += 2) {
+            if (!WXHash_RemoveEntry(&hashTable, bigTable[idx],
+                                    (void **) &origKey, (void **) &origObj,
+                                    WXHash_StrHashFn, WXHash_StrEqualsFn) ||
+                    (origKey != bigTable[idx])) {
+                (void) fprintf(stderr, "Dense remove failure\n");
+                exit(1);
+            }
+        }
+        orderState[0] = 0; orderState[1] = -1;
+        if ((WXHash_Scan(&hashTable, orderScanner, orderState) != 0) ||
+                (orderState[0] != 512)) {
+            (void) fprintf(stderr, "Dense post-remove scan failure (%d)\n",
+                           orderState[0]);
+            exit(1);
+        }
+
+        /* Replacements update in place, reinsertions append to the order */
+        if (!WXHash_PutEntry(&hashTable, bigTable[1], bigTable[1],
+                             (void **) &origKey, NULL, WXHash_StrHashFn,
+                             WXHash_StrEqualsFn) || (origKey != bigTable[1])) {
+            (void) fprintf(stderr, "Dense replace failure\n");
+            exit(1);
+        }
+        for (idx = 0; idx < 1024; idx += 2) {
+            if (!WXHash_InsertEntry(&hashTable, bigTable[idx], bigTable[idx],
+                                    NULL, NULL, WXHash_StrHashFn,
+                                    WXHash_StrEqualsFn)) {
+                (void) fprintf(stderr, "Dense reinsert failure\n");
+                exit(1);
+            }
+        }
+        idy = 0;
+        if ((WXHash_Scan(&hashTable, countScanner, &idy) != 0) ||
+                (idy != 1024)) {
+            (void) fprintf(stderr, "Dense refill scan count (%d)\n", idy);
+            exit(1);
+        }
+        for (idx = 0; idx < 1024; idx++) {
+            if (WXHash_GetEntry(&hashTable, bigTable[idx],
+                                WXHash_StrHashFn,
+                                WXHash_StrEqualsFn) != bigTable[idx]) {
+                (void) fprintf(stderr, "Dense get mismatch?\n");
+                exit(1);
+            }
+        }
+
+        /* Duplication carries the dense storage across */
+        if (!WXHash_Duplicate(&dupHashTable, &hashTable, NULL)) {
+            (void) fprintf(stderr, "Unexpected memory failure on dense dup\n");
+            exit(1);
+        }
+        idy = 0;
+        if ((WXHash_Scan(&dupHashTable, countScanner, &idy) != 0) ||
+                (idy != 1024)) {
+            (void) fprintf(stderr, "Dense dup scan count (%d)\n", idy);
+            exit(1);
+        }
+        WXHash_Destroy(&dupHashTable);
+
+        /* And disabling reverts to the (equivalent) slot walk */
+        (void) WXHash_SetDense(&hashTable, FALSE);
+        idy = 0;
+        if ((WXHash_Scan(&hashTable, countScanner, &idy) != 0) ||
+                (idy != 1024)) {
+            (void) fprintf(stderr, "Post-dense scan count (%d)\n", idy);
+            exit(1);
+        }
+        WXHash_Destroy(&hashTable);
+    }
+
     /* Repeat for the managed dictionaries */
 
     /* Fill it again, Sam */
@@ -259,6 +495,58 @@ int main(int argc, char **argv) {
     WXDict_Destroy(&dict);
     WXDict_Destroy(&dupDict);
 
+    /* Interned dictionaries collapse repeated strings to shared instances */
+    if (!WXIntern_Init(&internPool, -1)) {
+        (void) fprintf(stderr, "Error: unexpected memory failure\n");
+        exit(1);
+    }
+    if (!WXDict_InitInterned(&dict, -1, TRUE, &internPool)) {
+        (void) fprintf(stderr, "Error: unexpected memory failure\n");
+        exit(1);
+    }
+    for (idx = 0; idx < 1024; idx++) {
+        (void) sprintf(bigTable[idx], "entry-%d", idx & 63);
+        if (!WXDict_PutEntry(&dict, bigTable[idx], "shared-value")) {
+            (void) fprintf(stderr, "Interned dict put failure\n");
+            exit(1);
+        }
+    }
+
+    /* 64 distinct keys plus the one common value in the pool */
+    if (internPool.strings.entryCount != 65) {
+        (void) fprintf(stderr, "Incorrect intern pool count %d\n",
+                               internPool.strings.entryCount);
+        exit(1);
+    }
+
+    /* Matching content resolves to pointer-identical instances */
+    val = (char *) WXDict_GetEntry(&dict, "entry-1");
+    cmp = (char *) WXDict_GetEntry(&dict, "entry-2");
+    if ((val == NULL) || (val != cmp)) {
+        (void) fprintf(stderr, "Interned values are not shared?\n");
+        exit(1);
+    }
+
+    /* Duplicates share the backing pool, values included */
+    if (!WXDict_Duplicate(&dupDict, &dict)) {
+        (void) fprintf(stderr, "Unexpected memory failure on duplicate\n");
+        exit(1);
+    }
+    if (WXDict_GetEntry(&dupDict, "entry-1") != (const char *) val) {
+        (void) fprintf(stderr, "Duplicated intern values are not shared?\n");
+        exit(1);
+    }
+
+    /* All references release back through the destroys */
+    WXDict_Destroy(&dict);
+    WXDict_Destroy(&dupDict);
+    if (internPool.strings.entryCount != 0) {
+        (void) fprintf(stderr, "Leftover intern pool entries %d\n",
+                               internPool.strings.entryCount);
+        exit(1);
+    }
+    WXIntern_Destroy(&internPool);
+
     (void) fprintf(stdout, "All tests passed\n");
     exit(0);
 }
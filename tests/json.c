@@ -100,15 +100,91 @@ static struct ParseErrorDef {
 #define PARSE_ERROR_COUNT \
                (int) (sizeof(parserErrorConds) / sizeof(struct ParseErrorDef))
 
+/* Streaming decode handler, appends a compact trace of the parse events */
+static int streamTraceHandler(WXJSONEvent *event, void *userData) {
+    WXBuffer *trace = (WXBuffer *) userData;
+    char wrk[64];
+
+    (void) WXBuffer_Printf(trace, "%d", event->depth);
+    if (event->name != NULL) {
+        (void) WXBuffer_Printf(trace, "%s", event->name);
+    }
+    switch (event->type) {
+        case WXJSONEVT_OBJECT_START:
+            (void) WXBuffer_Append(trace, "{", 1, TRUE);
+            break;
+        case WXJSONEVT_OBJECT_END:
+            (void) WXBuffer_Append(trace, "}", 1, TRUE);
+            break;
+        case WXJSONEVT_ARRAY_START:
+            (void) WXBuffer_Append(trace, "[", 1, TRUE);
+            break;
+        case WXJSONEVT_ARRAY_END:
+            (void) WXBuffer_Append(trace, "]", 1, TRUE);
+            break;
+        case WXJSONEVT_SCALAR:
+            switch (event->value.type) {
+                case WXJSONVALUE_TRUE:
+                    (void) WXBuffer_Append(trace, "T", 1, TRUE);
+                    break;
+                case WXJSONVALUE_FALSE:
+                    (void) WXBuffer_Append(trace, "F", 1, TRUE);
+                    break;
+                case WXJSONVALUE_NULL:
+                    (void) WXBuffer_Append(trace, "N", 1, TRUE);
+                    break;
+                case WXJSONVALUE_INT:
+                    (void) sprintf(wrk, "%lld", event->value.value.ival);
+                    (void) WXBuffer_Printf(trace, "%s", wrk);
+                    break;
+                case WXJSONVALUE_DOUBLE:
+                    (void) sprintf(wrk, "%g", event->value.value.dval);
+                    (void) WXBuffer_Printf(trace, "%s", wrk);
+                    break;
+                case WXJSONVALUE_STRING:
+                    (void) WXBuffer_Printf(trace, "'%s'",
+                                           event->value.value.sval);
+                    break;
+                default:
+                    (void) WXBuffer_Append(trace, "?", 1, TRUE);
+                    break;
+            }
+            break;
+    }
+    (void) WXBuffer_Append(trace, ";", 1, TRUE);
+    return TRUE;
+}
+
+/* Companion handler for halt testing, stops after a scalar count */
+/* Collection sink for verifying the streaming encoder */
+static WXBuffer sinkBuffer;
+static int sinkCallCount = 0;
+static int collectSink(uint8_t *content, size_t length, void *userData) {
+    sinkCallCount++;
+    if (WXBuffer_Append(&sinkBuffer, content, length, TRUE) == NULL) return -1;
+    return 0;
+}
+
+static int streamHaltHandler(WXJSONEvent *event, void *userData) {
+    int *counter = (int *) userData;
+
+    if (event->type == WXJSONEVT_SCALAR) {
+        if (--(*counter) <= 0) return FALSE;
+    }
+    return TRUE;
+}
+
 /**
  * Main testing entry point.  Lots of parsing is about to follow...
  */
 int main(int argc, char **argv) {
     WXJSONValue *value, *sub, *subsub, *arrPtr;
+    WXJSONErrorCode strmRc;
+    unsigned int lineNum;
     WXJSONToken *token;
     WXJSONLexer lex;
     WXBuffer buffer;
-    int idx;
+    int idx, haltCount;
 
     /* At some point, put the MTraq testcase identifiers in here */
 
@@ -519,6 +595,127 @@ int main(int argc, char **argv) {
     WXJSON_Destroy(value);
     WXBuffer_Empty(&buffer);
 
+    /* Arena decode, same tree content with single-release teardown */
+    value = WXJSON_DecodeArena(bigJSON);
+    if ((value == NULL) || (value->type != WXJSONVALUE_OBJECT)) {
+        (void) fprintf(stderr, "Failed to arena-parse the big document\n");
+        exit(1);
+    }
+    sub = WXJSON_Find(value, "occ_obj.int_key");
+    if ((sub == NULL) || (sub->type != WXJSONVALUE_INT) ||
+            (sub->value.ival != 12345)) {
+        (void) fprintf(stderr, "Find failure on arena-parsed object\n");
+        exit(1);
+    }
+    sub = WXJSON_Find(value, "occ_obj.str_key");
+    if ((sub == NULL) || (sub->type != WXJSONVALUE_STRING) ||
+            (strcmp(sub->value.sval, "abcdefg") != 0)) {
+        (void) fprintf(stderr, "String failure on arena-parsed object\n");
+        exit(1);
+    }
+    sub = WXJSON_Find(value, "occ_arr");
+    if ((sub == NULL) || (sub->type != WXJSONVALUE_ARRAY) ||
+            (sub->value.aval.length != 6)) {
+        (void) fprintf(stderr, "Array failure on arena-parsed object\n");
+        exit(1);
+    }
+    sub = WXJSON_Find(value, "empty_obj");
+    if ((sub == NULL) || (sub->type != WXJSONVALUE_OBJECT) ||
+            (sub->value.oval.entryCount != 0)) {
+        (void) fprintf(stderr, "Empty object failure on arena parse\n");
+        exit(1);
+    }
+    WXJSON_Destroy(value);
+
+    for (idx = 0; idx < PARSE_ERROR_COUNT; idx++) {
+        value = WXJSON_DecodeArena(parserErrorConds[idx].content);
+        if ((value == NULL) || (value->type != WXJSONVALUE_ERROR) ||
+                (value->value.error.errorCode !=
+                                  parserErrorConds[idx].errorCode)) {
+            (void) fprintf(stderr, "Incorrect arena parse error result\n");
+            exit(1);
+        }
+        WXJSON_Destroy(value);
+    }
+
+    /* Streaming decode, verify event delivery order/content via trace */
+    strmRc = WXJSON_DecodeStream("{\"a\": [1, {\"b\": \"x\"}, true],"
+                                 " \"c\": null}",
+                                 streamTraceHandler, &buffer, NULL);
+    if ((strmRc != WXJSONERR_NONE_OK) ||
+            (strcmp((char *) buffer.buffer,
+                    "0{;1a[;21;2{;3b'x';2};2T;1a];1cN;0};") != 0)) {
+        (void) fprintf(stderr, "Incorrect streaming decode trace (%d): %s\n",
+                       strmRc, buffer.buffer);
+        exit(1);
+    }
+    WXBuffer_Empty(&buffer);
+
+    strmRc = WXJSON_DecodeStream("{\"mt_obj\": {}, \"mt_arr\": []}",
+                                 streamTraceHandler, &buffer, NULL);
+    if ((strmRc != WXJSONERR_NONE_OK) ||
+            (strcmp((char *) buffer.buffer,
+                    "0{;1mt_obj{;1mt_obj};1mt_arr[;1mt_arr];0};") != 0)) {
+        (void) fprintf(stderr, "Incorrect empty container trace (%d): %s\n",
+                       strmRc, buffer.buffer);
+        exit(1);
+    }
+    WXBuffer_Empty(&buffer);
+
+    /* Streaming parse errors surface the same codes (and line numbers) */
+    for (idx = 0; idx < PARSE_ERROR_COUNT; idx++) {
+        strmRc = WXJSON_DecodeStream(parserErrorConds[idx].content,
+                                     streamTraceHandler, &buffer, &lineNum);
+        if (strmRc != parserErrorConds[idx].errorCode) {
+            (void) fprintf(stderr, "Incorrect stream error code %d vs %d\n",
+                           strmRc, parserErrorConds[idx].errorCode);
+            exit(1);
+        }
+        if (lineNum != 1) {
+            (void) fprintf(stderr, "Incorrect stream error line number\n");
+            exit(1);
+        }
+        WXBuffer_Empty(&buffer);
+    }
+
+    /* Callback halt terminates the parse without error */
+    haltCount = 3;
+    strmRc = WXJSON_DecodeStream(bigJSON, streamHaltHandler, &haltCount, NULL);
+    if ((strmRc != WXJSONERR_NONE_OK) || (haltCount != 0)) {
+        (void) fprintf(stderr, "Incorrect streaming halt outcome (%d/%d)\n",
+                       strmRc, haltCount);
+        exit(1);
+    }
+
+    /* Streamed encoding must byte-match the buffered form */
+    value = WXJSON_Decode(bigJSON);
+    WXBuffer_Empty(&buffer);
+    if (WXJSON_Encode(&buffer, value, FALSE) == NULL) {
+        (void) fprintf(stderr, "Unexpected encoding error for sink compare\n");
+        exit(1);
+    }
+    if (WXBuffer_Init(&sinkBuffer, 1024) == NULL) {
+        (void) fprintf(stderr, "Unexpected sink buffer allocation failure\n");
+        exit(1);
+    }
+    if (!WXJSON_EncodeToSink(value, FALSE, 64, collectSink, NULL)) {
+        (void) fprintf(stderr, "Unexpected streaming encoding error\n");
+        exit(1);
+    }
+    if (sinkCallCount < 2) {
+        (void) fprintf(stderr, "Streamed encoding did not segment output\n");
+        exit(1);
+    }
+    if ((sinkBuffer.length != buffer.length - 1) ||
+            (memcmp(sinkBuffer.buffer, buffer.buffer,
+                    sinkBuffer.length) != 0)) {
+        (void) fprintf(stderr, "Streamed/buffered encoding mismatch\n");
+        exit(1);
+    }
+    WXBuffer_Destroy(&sinkBuffer);
+    WXJSON_Destroy(value);
+    WXBuffer_Empty(&buffer);
+
     /* One last output for checking prettiness */
     value = WXJSON_Decode(bigJSON);
     WXJSON_Encode(&buffer, value, TRUE);
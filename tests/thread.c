@@ -7,6 +7,7 @@
  */
 #include "thread.h"
 #include "threadpool.h"
+#include "concurrenthash.h"
 #include "log.h"
 
 /* Two elements to handle thread testing and static initializers */
@@ -135,6 +136,41 @@ static void keyDestructor(void *arg) {
     destructs[slot] = TRUE;
 }
 
+/* Reader/writer lock test elements */
+static WXThread_RwLock rwLock;
+static int rwValue = 0, rwActiveReaders = 0, rwMaxReaders = 0;
+
+/* Shared readers verify the written value and track their overlap */
+static void *rwReaderHandler(void *arg) {
+    if (WXThread_RwLockReadLock(&rwLock) != WXTRC_OK) {
+        (void) fprintf(stderr, "Failed to take shared read lock\n");
+        exit(1);
+    }
+
+    (void) WXThread_MutexLock(&globalLock);
+    rwActiveReaders++;
+    if (rwActiveReaders > rwMaxReaders) rwMaxReaders = rwActiveReaders;
+    (void) WXThread_MutexUnlock(&globalLock);
+
+    /* Writer completed before any reader could enter */
+    if (rwValue != 42) {
+        (void) fprintf(stderr, "Reader saw incomplete write\n");
+        exit(1);
+    }
+    WXThread_USleep(500000L);
+
+    (void) WXThread_MutexLock(&globalLock);
+    rwActiveReaders--;
+    (void) WXThread_MutexUnlock(&globalLock);
+
+    if (WXThread_RwLockUnlock(&rwLock) != WXTRC_OK) {
+        (void) fprintf(stderr, "Failed to release shared read lock\n");
+        exit(1);
+    }
+
+    return NULL;
+}
+
 static int lastTmExit = 0;
 
 /* Worker thread waits for the arg-indicated amount of time */
@@ -149,6 +185,69 @@ static void *worker(void *arg) {
     return NULL;
 }
 
+/* Hammer the concurrent hashtable from several threads at once */
+#define CHASH_THREADS 4
+#define CHASH_KEYS_PER_THREAD 4096
+
+static WXConcurrentHash cHashTable;
+
+/* Integer keys, mixed so the stripe-selection bits actually vary */
+static unsigned int cHashKeyFn(void *key) {
+    return ((unsigned int) (uintptr_t) key) * 2654435761U;
+}
+static int cHashEqualsFn(void *keya, void *keyb) {
+    return (keya == keyb);
+}
+
+static int cHashScanCounter(WXHashTable *table, void *key, void *obj,
+                            void *userData) {
+    *((int *) userData) += 1;
+    return 0;
+}
+
+/* Each thread owns a disjoint key range: insert, verify, remove half */
+static void *cHashThreadHandler(void *arg) {
+    intptr_t base = ((intptr_t) arg) * CHASH_KEYS_PER_THREAD, key;
+    int idx;
+
+    for (idx = 1; idx <= CHASH_KEYS_PER_THREAD; idx++) {
+        key = base + idx;
+        if (!WXCHash_PutEntry(&cHashTable, (void *) key, (void *) key,
+                              NULL, NULL, cHashKeyFn, cHashEqualsFn)) {
+            (void) fprintf(stderr, "Failed to put concurrent hash entry\n");
+            exit(1);
+        }
+        /* Contended logging exercise for the asynchronous backend */
+        if ((idx % 512) == 0) {
+            WXLog_Debug("chash thread %d at %d inserts",
+                        (int) (base / CHASH_KEYS_PER_THREAD), idx);
+        }
+        /* And raw capture points for the deferred trace rings */
+        if ((idx % 1024) == 0) {
+            WXLog_TraceFast("chash thread %ld trace at %ld",
+                            base / CHASH_KEYS_PER_THREAD, idx, 0, 0);
+        }
+    }
+    for (idx = 1; idx <= CHASH_KEYS_PER_THREAD; idx++) {
+        key = base + idx;
+        if (WXCHash_GetEntry(&cHashTable, (void *) key,
+                             cHashKeyFn, cHashEqualsFn) != (void *) key) {
+            (void) fprintf(stderr, "Missing/bad concurrent hash entry\n");
+            exit(1);
+        }
+    }
+    for (idx = 2; idx <= CHASH_KEYS_PER_THREAD; idx += 2) {
+        key = base + idx;
+        if (!WXCHash_RemoveEntry(&cHashTable, (void *) key, NULL, NULL,
+                                 cHashKeyFn, cHashEqualsFn)) {
+            (void) fprintf(stderr, "Failed concurrent hash entry removal\n");
+            exit(1);
+        }
+    }
+
+    return NULL;
+}
+
 /* Just so I can embed in the if() */
 static int blip() {
     WXThread_USleep(100000);
@@ -162,9 +261,12 @@ int main(int argc, char **argv) {
     int idx, thrstata, thrstatb, thrstatc;
     WXThread tid, tida, tidb, tidc, btids[5];
     WXThread_TimeSpec start, end;
+    WXThread_StopWatch watch;
     WXThread_Mutex mutex;
     WXThread_Cond cond;
-    WXThreadPool pool;
+    WXThreadPool pool, prPool;
+    void *(*batchFns[4])(void *);
+    void *batchArgs[4];
     int64_t net;
     void *ret;
 
@@ -189,6 +291,19 @@ int main(int argc, char **argv) {
         exit(1);
     }
 
+    /* Monotonic clock never runs backwards, stopwatch should track sleeps */
+    if (WXThread_MonotonicTime() > WXThread_MonotonicTime()) {
+        (void) fprintf(stderr, "Monotonic time moved backwards...\n");
+        exit(1);
+    }
+    WXThread_StopWatchStart(&watch);
+    WXThread_USleep(100000L);
+    net = (int64_t) WXThread_StopWatchElapsed(&watch);
+    if ((net < 100000000L) || (net > 10000000000L)) {
+        (void) fprintf(stderr, "Stopwatch interval out of bounds...\n");
+        exit(1);
+    }
+
     /* Am I talking to myself?  Yes, I am.... */
     if (!WXThread_Equal(WXThread_Self(), WXThread_Self())) {
         (void) fprintf(stderr, "Hmmmm, I'm not equivalent with myself...\n");
@@ -235,6 +350,83 @@ int main(int argc, char **argv) {
         exit(1);
     }
 
+    /* Adaptive variant follows exactly the same contract */
+    if (WXThread_MutexInitAdaptive(&mutex) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to initialize the adaptive mutex\n");
+        exit(1);
+    }
+    if (WXThread_MutexLock(&mutex) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to lock the adaptive mutex\n");
+        exit(1);
+    }
+    if (WXThread_MutexTryLock(&mutex) != WXTRC_BUSY) {
+        (void) fprintf(stderr, "Not busy for adaptive try\n");
+        exit(1);
+    }
+    if (WXThread_MutexUnlock(&mutex) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to unlock the adaptive mutex\n");
+        exit(1);
+    }
+    if (WXThread_MutexDestroy(&mutex) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to destroy the adaptive mutex\n");
+        exit(1);
+    }
+
+    /* Reader/writer locking, writer excludes, readers overlap */
+    if (WXThread_RwLockInit(&rwLock) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to initialize the rwlock\n");
+        exit(1);
+    }
+    if (WXThread_RwLockWriteLock(&rwLock) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to write-lock the rwlock\n");
+        exit(1);
+    }
+    for (idx = 0; idx < 3; idx++) {
+        if (WXThread_Create(&btids[idx], rwReaderHandler, NULL) != WXTRC_OK) {
+            (void) fprintf(stderr, "Failed to create reader thread %d\n", idx);
+            exit(1);
+        }
+    }
+
+    /* Readers are parked on the exclusive hold, complete the 'write' */
+    WXThread_USleep(250000L);
+    rwValue = 42;
+    if (WXThread_RwLockUnlock(&rwLock) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to release the write lock\n");
+        exit(1);
+    }
+
+    /* Shared holds now block exclusive access attempts */
+    WXThread_USleep(250000L);
+    if (WXThread_RwLockTryWriteLock(&rwLock) != WXTRC_BUSY) {
+        (void) fprintf(stderr, "Not busy for write try under readers\n");
+        exit(1);
+    }
+
+    for (idx = 0; idx < 3; idx++) {
+        if (WXThread_Join(btids[idx], &ret) != WXTRC_OK) {
+            (void) fprintf(stderr, "Failed to join reader thread %d\n", idx);
+            exit(1);
+        }
+    }
+    if (rwMaxReaders < 2) {
+        (void) fprintf(stderr, "Readers never overlapped in shared mode\n");
+        exit(1);
+    }
+    if (WXThread_RwLockTryReadLock(&rwLock) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to read-lock the free rwlock\n");
+        exit(1);
+    }
+    if (WXThread_RwLockUnlock(&rwLock) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to release the read lock\n");
+        exit(1);
+    }
+    if (WXThread_RwLockDestroy(&rwLock) != WXTRC_OK) {
+        (void) fprintf(stderr, "Unable to destroy the rwlock\n");
+        exit(1);
+    }
+    (void) fprintf(stdout, "Mutex/rwlock primitives completed\n\n");
+
     /* Increment test using a bunch of threads */
     thrstata = thrstatb = thrstatc = 1;
     if (WXThread_MutexLock(&globalLock) != WXTRC_OK) {
@@ -399,6 +591,54 @@ int main(int argc, char **argv) {
         }
     }
 
+    /* Asynchronous logging from here on, small ring to force producer waits */
+    WXLog_InitAsync(NULL, NULL, 8);
+
+    /* With deferred trace capture active in the worker threads */
+    WXLog_EnableTrace(16);
+
+    /* Pound on the striped hashtable from competing threads */
+    WXLog_Info("Starting concurrent hashtable tests");
+    if (!WXCHash_InitTable(&cHashTable, 1024)) {
+        (void) fprintf(stderr, "Failed to initialize concurrent hashtable\n");
+        exit(1);
+    }
+    for (idx = 0; idx < CHASH_THREADS; idx++) {
+        if (WXThread_Create(&btids[idx], cHashThreadHandler,
+                            (void *) (intptr_t) idx) != WXTRC_OK) {
+            (void) fprintf(stderr, "Failed to create chash thread %d\n", idx);
+            exit(1);
+        }
+    }
+    for (idx = 0; idx < CHASH_THREADS; idx++) {
+        if (WXThread_Join(btids[idx], &ret) != WXTRC_OK) {
+            (void) fprintf(stderr, "Failed to join chash thread %d\n", idx);
+            exit(1);
+        }
+    }
+
+    /* Worker rings released with their threads, capture and render ours
+     * (cheap record now, full formatting only happens in the dump) */
+    WXLog_TraceFast("chash workers joined, %ld keys total",
+                    (long) CHASH_THREADS * CHASH_KEYS_PER_THREAD, 0, 0, 0);
+    WXLog_TraceBinary("chash key sample", (uint8_t *) "chash-0-00000000",
+                      0, 16);
+    WXLog_TraceDump(WXLOG_DEBUG);
+    WXLog_EnableTrace(0);
+
+    /* Each thread left behind its odd-keyed half */
+    thrstata = 0;
+    if (WXCHash_Scan(&cHashTable, cHashScanCounter, &thrstata) != 0) {
+        (void) fprintf(stderr, "Unexpected concurrent hash scan interrupt\n");
+        exit(1);
+    }
+    if (thrstata != CHASH_THREADS * CHASH_KEYS_PER_THREAD / 2) {
+        (void) fprintf(stderr, "Incorrect concurrent hash residual count %d\n",
+                               thrstata);
+        exit(1);
+    }
+    WXCHash_Destroy(&cHashTable);
+
     /* Might as well test thread-pooling in here too */
 
     WXLog_Info("Starting threadpool tests");
@@ -505,6 +745,70 @@ int main(int argc, char **argv) {
 
     WXLog_Info("Exited wait all on remainder");
 
+    WXLog_Info("Queueing batch of 4 jobs in a single call");
+
+    /* Let the workers park so the growth count below is predictable */
+    WXThread_USleep(500000L);
+
+    /* Batch submission, whole set registered/dispatched in one pass */
+    for (idx = 0; idx < 4; idx++) batchFns[idx] = worker;
+    batchArgs[0] = (void *) (intptr_t) 1;
+    batchArgs[1] = (void *) (intptr_t) 2;
+    batchArgs[2] = (void *) (intptr_t) 1;
+    batchArgs[3] = (void *) (intptr_t) 2;
+    if (WXThreadPool_EnqueueBatch(&pool, batchFns, batchArgs, 4) != WXTRC_OK) {
+        (void) fprintf(stderr, "Failed to enqueue worker batch\n");
+        exit(1);
+    }
+
+    /* Burst coverage should have regrown the worker set */
+    if (pool.workerCount != 4) {
+        (void) fprintf(stderr, "Incorrect worker count on batch %ld\n",
+                               pool.workerCount);
+        exit(1);
+    }
+
+    if (WXThreadPool_WaitAll(&pool) != WXTRC_OK) {
+        (void) fprintf(stderr, "Failed in batch waitall case\n");
+        exit(1);
+    }
+    if (pool.queue != NULL) {
+        (void) fprintf(stderr, "Queue left after batch waitAll()?\n");
+        exit(1);
+    }
+
+    WXLog_Info("Exited wait all on batch");
+
+    /* Single-worker pool to verify the priority lane ordering */
+    if (WXThreadPool_Init(&prPool, 1, 1, 5) != WXTRC_OK) {
+        (void) fprintf(stderr, "Failed to initialize priority test pool\n");
+        exit(1);
+    }
+    if ((WXThreadPool_Enqueue(&prPool, worker,
+                              (void *) (intptr_t) 3) != WXTRC_OK) ||
+            (blip()) ||
+            (WXThreadPool_Enqueue(&prPool, worker,
+                                  (void *) (intptr_t) 2) != WXTRC_OK) ||
+            (WXThreadPool_EnqueuePriority(&prPool, worker,
+                                  (void *) (intptr_t) 1) != WXTRC_OK)) {
+        (void) fprintf(stderr, "Failed to populate priority queues\n");
+        exit(1);
+    }
+    if (WXThreadPool_WaitAll(&prPool) != WXTRC_OK) {
+        (void) fprintf(stderr, "Failed in priority waitall case\n");
+        exit(1);
+    }
+
+    /* Priority item jumped the lane, normal item finished last */
+    if (lastTmExit != 2) {
+        (void) fprintf(stderr, "Incorrect exit order for priority lane\n");
+        exit(1);
+    }
+    if (WXThreadPool_Terminate(&prPool) != WXTRC_OK) {
+        (void) fprintf(stderr, "Failed in priority pool termination\n");
+        exit(1);
+    }
+
     /* Mess with limits */
     pool.maxWorkers = 2;
 
@@ -541,5 +845,10 @@ int main(int argc, char **argv) {
         exit(1);
     }
 
+    /* Drain the asynchronous logger and return to synchronous operation */
+    WXLog_Flush();
+    WXLog_Shutdown();
+    WXLog_Info("Post-shutdown logging is synchronous again");
+
     (void) fprintf(stderr, "All tests passed\n");
 }
@@ -7,6 +7,7 @@
  */
 #include "xml.h"
 #include "xmlint.h"
+#include "encoding.h"
 #include "mem.h"
 
 #define TEST_TOKEN(exp, msg) \
@@ -31,7 +32,15 @@
     } \
     WXFree(lex.lastToken.val);
 
-static char *bigXML = 
+#define TEST_READER_EVENT(exp, msg) \
+    evt = WXML_ReaderNext(&reader, errorMsg, sizeof(errorMsg)); \
+    if (evt != exp) { \
+        (void) fprintf(stderr, "Error: %s (%d vs %d): %s\n", msg, \
+                       evt, exp, errorMsg); \
+        exit(1); \
+    }
+
+static char *bigXML =
     "<?xml version=\"1.0\"?>\n"
     "<!-- This is a pretty big bit of XML to test the lexer -->\n"
     "<!DOCTYPE test SYSTEM \"test.dtd\">\n"
@@ -86,10 +95,12 @@ static struct ParseErrorDef {
  * Main testing entry point.  Lots of parsing is about to follow...
  */
 int main(int argc, char **argv) {
-    WXMLElement *doc, *child;
+    WXMLElement *doc, *child, *sub;
     WXMLAttribute *attr;
     char errorMsg[1024];
     WXMLTokenType type;
+    WXMLEventType evt;
+    WXMLReader reader;
     WXBuffer buffer;
     WXMLLexer lex;
     int idx;
@@ -303,6 +314,158 @@ int main(int argc, char **argv) {
     (void) fprintf(stdout, "\n%s\n", buffer.buffer);
     WXML_Destroy(doc);
 
+    /* Streaming reader pass over the same big document */
+    if (!WXML_ReaderInit(&reader, bigXML)) {
+        (void) fprintf(stderr, "Failed to initialize streaming reader\n");
+        exit(1);
+    }
+    TEST_READER_EVENT(WXMLEVT_ELEMENT_START, "Reader root open")
+    if ((reader.depth != 1) || (reader.current->namespace == NULL) ||
+            (strcmp(reader.current->namespace->href, "test:xml") != 0) ||
+            (strcmp(reader.current->name, "root") != 0)) {
+        (void) fprintf(stderr, "Invalid reader root element details\n");
+        exit(1);
+    }
+    TEST_READER_EVENT(WXMLEVT_CONTENT, "Reader root text")
+    if (strcmp(reader.text, "mixed text\n    ") != 0) {
+        (void) fprintf(stderr, "Incorrect reader root text fragment\n");
+        exit(1);
+    }
+    TEST_READER_EVENT(WXMLEVT_ELEMENT_START, "Reader empty open")
+    if ((reader.depth != 2) ||
+            (strcmp(reader.current->name, "empty") != 0) ||
+            (reader.current->attributes == NULL) ||
+            (strcmp(reader.current->attributes->name, "attr") != 0) ||
+            (reader.current->attributes->value != NULL)) {
+        (void) fprintf(stderr, "Invalid reader empty element details\n");
+        exit(1);
+    }
+    TEST_READER_EVENT(WXMLEVT_ELEMENT_END, "Reader empty close")
+    TEST_READER_EVENT(WXMLEVT_CONTENT, "Reader second text")
+    TEST_READER_EVENT(WXMLEVT_ELEMENT_START, "Reader notsoempty open")
+    sub = WXML_ReaderPromote(&reader, FALSE, errorMsg, sizeof(errorMsg));
+    if (sub == NULL) {
+        (void) fprintf(stderr, "Failed to promote subtree: %s\n", errorMsg);
+        exit(1);
+    }
+    if ((strcmp(sub->name, "notsoempty") != 0) || (sub->parent != NULL) ||
+            (strcmp(sub->content, "'$content%\"<") != 0) ||
+            (sub->attributes == NULL) ||
+            (strcmp(sub->attributes->value, "<&yo>") != 0)) {
+        (void) fprintf(stderr, "Invalid promoted subtree details\n");
+        exit(1);
+    }
+    WXML_Destroy(sub);
+    TEST_READER_EVENT(WXMLEVT_CONTENT, "Reader third text")
+    TEST_READER_EVENT(WXMLEVT_ELEMENT_END, "Reader root close")
+    if ((reader.current == NULL) ||
+            (strcmp(reader.current->name, "root") != 0)) {
+        (void) fprintf(stderr, "Invalid reader closing element details\n");
+        exit(1);
+    }
+    TEST_READER_EVENT(WXMLEVT_DOC_END, "Reader document end")
+    WXML_ReaderDestroy(&reader);
+
+    /* The reader should produce identical errors to the DOM parser */
+    for (idx = 0; idx < PARSE_ERROR_COUNT; idx++) {
+        if (!WXML_ReaderInit(&reader, parserErrorConds[idx].content)) {
+            (void) fprintf(stderr, "Failed to initialize streaming reader\n");
+            exit(1);
+        }
+        do {
+            evt = WXML_ReaderNext(&reader, errorMsg, sizeof(errorMsg));
+        } while ((evt != WXMLEVT_ERROR) && (evt != WXMLEVT_DOC_END));
+        if ((evt != WXMLEVT_ERROR) ||
+                (strstr(errorMsg, parserErrorConds[idx].exp) == NULL)) {
+            (void) fprintf(stderr, "%d: Incorrect reader error: %s (exp %s)\n",
+                           idx, errorMsg, parserErrorConds[idx].exp);
+            exit(1);
+        }
+        WXML_ReaderDestroy(&reader);
+    }
+
+    (void) fprintf(stderr, "Streaming reader tests complete\n");
+
+    /* Arena-backed parse of the same document, single-release teardown */
+    doc = WXML_DecodeArena(bigXML, FALSE, errorMsg, sizeof(errorMsg));
+    if (doc == NULL) {
+        (void) fprintf(stderr, "Failed to arena-parse document: %s\n",
+                       errorMsg);
+        exit(1);
+    }
+    if ((doc->arena == NULL) || (doc->namespace == NULL) ||
+            (strcmp(doc->namespace->href, "test:xml") != 0) ||
+            (strcmp(doc->name, "root") != 0) ||
+            (strcmp(doc->content, "mixed text\n    \n    \n") != 0)) {
+        (void) fprintf(stderr, "Invalid arena-parsed root element\n");
+        exit(1);
+    }
+    child = (WXMLElement *) WXML_Find(doc, "/notsoempty", FALSE);
+    if ((child == NULL) || (child->arena != NULL) ||
+            (strcmp(child->content, "'$content%\"<") != 0) ||
+            (child->attributes == NULL) ||
+            (strcmp(child->attributes->value, "<&yo>") != 0)) {
+        (void) fprintf(stderr, "Invalid arena-parsed child element\n");
+        exit(1);
+    }
+    WXBuffer_Empty(&buffer);
+    WXML_Encode(&buffer, child, FALSE);
+    if (strstr((char *) buffer.buffer, "sqattr=\"&lt;&amp;yo&gt;\"") == NULL) {
+        (void) fprintf(stderr, "Incorrect encoding of arena-parsed element\n");
+        exit(1);
+    }
+    WXML_Destroy(doc);
+
+    /* Arena parsing should fail identically to the standard parser */
+    for (idx = 0; idx < PARSE_ERROR_COUNT; idx++) {
+        doc = WXML_DecodeArena(parserErrorConds[idx].content, FALSE, errorMsg,
+                               sizeof(errorMsg));
+        if ((doc != NULL) ||
+                (strstr(errorMsg, parserErrorConds[idx].exp) == NULL)) {
+            (void) fprintf(stderr, "%d: Incorrect arena error: %s (exp %s)\n",
+                           idx, errorMsg, parserErrorConds[idx].exp);
+            exit(1);
+        }
+    }
+
+    (void) fprintf(stderr, "Arena parse tests complete\n");
+
+    /* Long runs to push the escapers through the word-at-a-time scan */
+    WXBuffer_Empty(&buffer);
+    if (WXML_EscapeContent(&buffer,
+                           "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa<"
+                           "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb&"
+                           "cccccccccccccccccccccccccccccccc",
+                           -1, FALSE) == NULL) {
+        (void) fprintf(stderr, "Memory failure on long content escape\n");
+        exit(1);
+    }
+    if (WXBuffer_Append(&buffer, "\0", 1, TRUE) == NULL) exit(1);
+    if (strcmp((char *) buffer.buffer,
+               "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa&lt;"
+               "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb&amp;"
+               "cccccccccccccccccccccccccccccccc") != 0) {
+        (void) fprintf(stderr, "Incorrect long content escape result\n");
+        exit(1);
+    }
+    WXBuffer_Empty(&buffer);
+    if (WXML_EscapeAttribute(&buffer,
+                             "dddddddddddddddddddddddddddddddd\""
+                             "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",
+                             -1, FALSE) == NULL) {
+        (void) fprintf(stderr, "Memory failure on long attribute escape\n");
+        exit(1);
+    }
+    if (WXBuffer_Append(&buffer, "\0", 1, TRUE) == NULL) exit(1);
+    if (strcmp((char *) buffer.buffer,
+               "dddddddddddddddddddddddddddddddd&quot;"
+               "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee") != 0) {
+        (void) fprintf(stderr, "Incorrect long attribute escape result\n");
+        exit(1);
+    }
+
+    (void) fprintf(stderr, "Escape scan tests complete\n");
+
     /* Visual check for deeply nested layout */
     /* Note that this can support retaining since there's no extra space */
     WXBuffer_Empty(&buffer);